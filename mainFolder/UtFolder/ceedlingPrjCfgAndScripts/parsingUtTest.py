@@ -6,16 +6,21 @@ Created on Thu Feb 20 18:37:13 2025
 """
 
 import os
+import posixpath
 import re
 import sys
 import shutil
 import subprocess
+import threading
+from concurrent.futures import ThreadPoolExecutor
+from contextlib import contextmanager
 
 UNIT_TEST_COLLECTION = "../utCollection"
 UNIT_TEST_PREFIX = "TEST_"
 UNIT_EXECUTION_FOLDER = "utExecutionAndResults/utUnderTest"
 UNIT_EXECUTION_FOLDER_BUILD = "utExecutionAndResults/utUnderTest/build"
 UNIT_RESULT_FOLDER = "utExecutionAndResults/utResults"
+UNIT_WORKSPACE_FOLDER = "utExecutionAndResults/utWorkspaces"
 PROJECT = "project.yml"
 
 # Find the position of the script removing its name and the disk
@@ -23,13 +28,24 @@ SCRIPT_PATH = os.path.abspath(__file__)
 SCRIPT_DIRECTORY_PATH = os.path.dirname(SCRIPT_PATH)
 RELATIVE_PATH = SCRIPT_DIRECTORY_PATH.split(":", 1)[-1].lstrip("\\/")
 NORMALIZED_PATH = RELATIVE_PATH.replace("\\", "/")
-
-DOCKER_BASE = ["docker", "run", "-it", "--rm","-v", "/c/" + NORMALIZED_PATH + ":/home/dev/project","throwtheswitch/madsciencelab-plugins:latest"]
+# Docker Desktop on Windows mounts the disk as /c/, on Linux the path is already POSIX
+HOST_PROJECT = "/c/" + NORMALIZED_PATH if os.name == "nt" else SCRIPT_DIRECTORY_PATH
+
+CONTAINER_PROJECT = "/home/dev/project"
+DOCKER_IMAGE = "throwtheswitch/madsciencelab-plugins:latest"
+# One container per session, kept alive by an idle process; the units are
+# built in it through "docker exec", without a TTY
+CONTAINER_NAME = f"ceedling-ut-{os.getpid()}"
+DOCKER_START = ["docker", "run", "-d", "--rm", "--name", CONTAINER_NAME,
+                "-v", HOST_PROJECT + ":" + CONTAINER_PROJECT,
+                "--entrypoint", "sleep", DOCKER_IMAGE, "infinity"]
+DOCKER_STOP = ["docker", "stop", "-t", "0", CONTAINER_NAME]
 CEEDLING_GCOV_ALL = ["ceedling", "gcov:all"]
 CEEDLING_CLEAN = ["ceedling", "clean"]
 
-DOCKER_GCOV_ALL = DOCKER_BASE + CEEDLING_GCOV_ALL
-DOCKER_CLEAN = DOCKER_BASE + CEEDLING_CLEAN
+# Native mode (--native): Ceedling and the gcov toolchain of the host, no Docker
+NATIVE_TOOLS = ["ceedling", "gcc", "gcov", "gcovr"]
+native_mode = False
 # ==============================
 # CONFIGURATION & MODULE LIST
 # ==============================
@@ -237,7 +253,7 @@ def clear_folder(folder_path: str):
 
     print(f"✅ Folder '{folder_path}' cleared successfully.")
 
-def updateUnitUnderTest(unitMetaData,unitName):
+def injectUnitUnderTest(unitMetaData,unitName):
     if not unitMetaData:
         print(f"No entry found with nome_funzione = {unitName}")
         sys.exit(1)
@@ -255,14 +271,166 @@ def updateUnitUnderTest(unitMetaData,unitName):
                 os.path.join(UNIT_TEST_COLLECTION, f"TEST_{function_name}", "src", f"{function_name}.c"),
                 extracted_body,
             )
+
+
+def updateUnitUnderTest(unitMetaData,unitName):
+    injectUnitUnderTest(unitMetaData, unitName)
     clear_folder(UNIT_EXECUTION_FOLDER)
     copy_folder_contents(UNIT_TEST_COLLECTION +"/"+ UNIT_TEST_PREFIX + unitName, UNIT_EXECUTION_FOLDER)
 
 
 
-def run_bash_cmd(cmd):
+# ==============================
+# PARALLEL EXECUTION ("all")
+# ==============================
+LOG_LOCK = threading.Lock()
+
+
+def log_line(text):
+    # One line at a time, so that the workers' lines never mix
+    with LOG_LOCK:
+        print(text, flush=True)
+
+
+def prepare_workspace(unitName, jobs):
+    """
+    Builds the private workspace of a unit:
+
+        utWorkspaces/<unit>/project.yml, mixin/, src/, test/, build/
+
+    project.yml is the shared one with the utUnderTest paths moved to the
+    workspace root and the Ceedling threads split among the workers.
+    """
+    workspace = os.path.join(UNIT_WORKSPACE_FOLDER, unitName).replace("\\", "/")
+    if os.path.exists(workspace):
+        shutil.rmtree(workspace)
+    copy_folder_contents(UNIT_TEST_COLLECTION + "/" + UNIT_TEST_PREFIX + unitName, workspace)
+    copy_folder_contents("mixin", os.path.join(workspace, "mixin"))
+
+    with open(PROJECT, "r", encoding="utf-8") as file:
+        project = file.read()
+    project = project.replace(UNIT_EXECUTION_FOLDER + "/", "")
+    threads = max(1, (os.cpu_count() or 1) // jobs)
+    project = re.sub(r"(:(?:test|compile)_threads:)[ \t]*\d+", rf"\g<1> {threads}", project)
+    with open(os.path.join(workspace, PROJECT), "w", encoding="utf-8") as file:
+        file.write(project)
+    return workspace
+
+
+def run_unit_in_workspace(unitName, workspace):
+    """
+    Runs gcov:all of one unit in its workspace and collects the results.
+    Every output line is prefixed with the unit name. Returns the exit code.
+    """
+    prefix = f"[{unitName}] "
+    cmd, cwd = ceedling_command(workspace, CEEDLING_GCOV_ALL)
     try:
-        subprocess.run(cmd, check=True)
+        proc = subprocess.Popen(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                text=True, encoding="utf-8", errors="replace")
+        for line in proc.stdout:
+            log_line(prefix + line.rstrip("\n"))
+        returncode = proc.wait()
+    except OSError as e:
+        log_line(f"{prefix}❌ Ceedling could not start: {e}")
+        return 1
+
+    build = os.path.join(workspace, "build")
+    if os.path.isdir(build):
+        results = os.path.join(UNIT_RESULT_FOLDER, unitName + "Results")
+        shutil.copytree(build, results, dirs_exist_ok=True)
+        log_line(f"{prefix}results in {results}")
+    log_line(f"{prefix}{'✅ passed' if returncode == 0 else f'❌ failed (exit code {returncode})'}")
+    return returncode
+
+
+def run_all_units(jobs):
+    # Staging is quick and prints a lot: done in order before the workers start
+    units = []
+    for module in moduli:
+        function_name = module["nome_funzione"]
+        print(f"▶ Staging unit: {function_name}")
+        injectUnitUnderTest([module], function_name)
+        units.append((function_name, prepare_workspace(function_name, jobs)))
+
+    print(f"▶ Running {len(units)} units, {jobs} at a time")
+    with ThreadPoolExecutor(max_workers=jobs) as pool:
+        codes = list(pool.map(lambda unit: run_unit_in_workspace(*unit), units))
+
+    failed = [name for (name, _), code in zip(units, codes) if code != 0]
+    print(f"Units: {len(units)}, passed: {len(units) - len(failed)}, failed: {len(failed)}")
+    for name in failed:
+        print(f"❌ {name}")
+    return 1 if failed else 0
+
+
+def parse_jobs(args):
+    """
+    Removes -j/--jobs N from args and returns N (default: one per CPU).
+    """
+    jobs = os.cpu_count() or 1
+    for flag in ("-j", "--jobs"):
+        if flag in args:
+            idx = args.index(flag)
+            try:
+                jobs = int(args[idx + 1])
+            except (IndexError, ValueError):
+                print(f"❌ {flag} needs a number of workers")
+                sys.exit(1)
+            del args[idx:idx + 2]
+    return max(1, jobs)
+
+
+# ==============================
+# CEEDLING CONTAINER
+# ==============================
+def check_native_toolchain():
+    missing = [tool for tool in NATIVE_TOOLS if shutil.which(tool) is None]
+    if missing:
+        print(f"❌ Native mode: {', '.join(missing)} not found in PATH")
+        sys.exit(1)
+    for tool in NATIVE_TOOLS:
+        print(f"▶ {tool}: {shutil.which(tool)}")
+
+
+@contextmanager
+def ceedling_session():
+    """
+    Starts the session container and always removes it at the end, also on
+    errors and Ctrl+C. The Ceedling commands of the session run in it.
+    In native mode only checks the host toolchain.
+    """
+    if native_mode:
+        check_native_toolchain()
+        yield
+        return
+
+    print(f"▶ Starting container {CONTAINER_NAME}")
+    try:
+        subprocess.run(DOCKER_START, check=True, stdout=subprocess.DEVNULL)
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(f"❌ Docker container could not start: {e}")
+        sys.exit(1)
+    try:
+        yield
+    finally:
+        subprocess.run(DOCKER_STOP, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        print(f"✅ Container {CONTAINER_NAME} removed.")
+
+
+def ceedling_command(workdir, ceedling_cmd):
+    """
+    Command and working directory running ceedling_cmd in workdir, a folder
+    relative to the script one: on the host or in the session container.
+    """
+    if native_mode:
+        return ceedling_cmd, workdir
+    container_dir = posixpath.normpath(posixpath.join(CONTAINER_PROJECT, workdir.replace("\\", "/")))
+    return ["docker", "exec", "-w", container_dir, CONTAINER_NAME] + ceedling_cmd, None
+
+
+def run_bash_cmd(cmd, cwd=None):
+    try:
+        subprocess.run(cmd, check=True, cwd=cwd)
     except subprocess.CalledProcessError as e:
         print("Ceedling has failed:", e)
 
@@ -271,7 +439,7 @@ def print_help():
     script_name = os.path.basename(sys.argv[0])
     help_text = f"""
 Usage:
-  python {script_name} <function_name|all>
+  python {script_name} <function_name|all> [-j N] [--native]
   python {script_name} -h | --help | help
 
 Description:
@@ -281,7 +449,10 @@ Description:
       after the marker: /* FUNCTION TO TEST */
     - Copies the unit test project into:
         {UNIT_EXECUTION_FOLDER}
-    - Runs Ceedling inside the Docker container
+      or, with 'all', each unit into its own workspace under:
+        {UNIT_WORKSPACE_FOLDER}
+    - Runs Ceedling inside one Docker container started for the whole run
+      and removed at the end, or with --native directly on the host
     - Collects build and coverage results into:
         {UNIT_RESULT_FOLDER}
 
@@ -291,42 +462,45 @@ Arguments:
   all                  Run the process for all modules listed in 'moduli'.
 
 Options:
+  -j, --jobs N         Units run at the same time with 'all' (default: one per CPU).
+                       Each unit has its own workspace and build folder, its
+                       output lines are prefixed with [<function_name>].
+  --native             Run the Ceedling, gcc, gcov and gcovr found in PATH
+                       instead of the Docker container (e.g. Linux build agents).
   -h, --help, help     Show this help message and exit.
 
 Examples:
   python {script_name} monitoring
   python {script_name} all
+  python {script_name} all -j 4
+  python {script_name} all --native
 """
     print(help_text.strip())
 
 
 if __name__ == "__main__":
     # ---- handle missing args / help ----
-    if len(sys.argv) < 2:
+    args = sys.argv[1:]
+    jobs = parse_jobs(args)
+    if "--native" in args:
+        args.remove("--native")
+        native_mode = True
+    if len(args) < 1:
         print_help()
         sys.exit(1)
 
-    if sys.argv[1] in ("-h", "--help", "help"):
+    if args[0] in ("-h", "--help", "help"):
         print_help()
         sys.exit(0)
 
-    unitToTest = extract_function_name(sys.argv[1])
+    unitToTest = extract_function_name(args[0])
     print(f"You passed the argument: {unitToTest}")
 
     if unitToTest == "all":
-        # ✅ Run for all modules in the dictionary
-        for module in moduli:
-            function_name = module["nome_funzione"]
-            print(f"▶ Processing unit: {function_name}")
-            updateUnitUnderTest([module], function_name)
-
-            run_bash_cmd(DOCKER_CLEAN)
-            run_bash_cmd(DOCKER_GCOV_ALL)
-
-            copy_folder_contents(
-                UNIT_EXECUTION_FOLDER_BUILD,
-                os.path.join(UNIT_RESULT_FOLDER, function_name + "Results")
-            )
+        # ✅ Run for all modules in the dictionary, in parallel workspaces
+        with ceedling_session():
+            exitCode = run_all_units(max(1, min(jobs, len(moduli))))
+        sys.exit(exitCode)
     else:
         # ✅ Run only for the selected unit
         unitMetaData = [m for m in moduli if m["nome_funzione"] == unitToTest]
@@ -335,8 +509,9 @@ if __name__ == "__main__":
             sys.exit(1)
 
         updateUnitUnderTest(unitMetaData, unitToTest)
-        run_bash_cmd(DOCKER_CLEAN)
-        run_bash_cmd(DOCKER_BASE + ["ceedling", "gcov:" + unitToTest])
+        with ceedling_session():
+            # clean and gcov in one Ceedling run: one Ruby start instead of two
+            run_bash_cmd(*ceedling_command(".", CEEDLING_CLEAN + ["gcov:" + unitToTest]))
         copy_folder_contents(
             UNIT_EXECUTION_FOLDER_BUILD,
             os.path.join(UNIT_RESULT_FOLDER, unitToTest + "Results")
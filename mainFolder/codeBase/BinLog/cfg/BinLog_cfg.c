@@ -0,0 +1,38 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "BinLog_cfg.h"
+
+/* Implementazione di esempio per l'host: orologio monotono del sistema operativo.
+ * Sul target qui va un timer libero a 1 MHz (o un contatore di cicli scalato).
+ */
+uint32_t BinLog_TimestampProject_us(void)
+{
+    struct timespec now;
+
+    if (0 != clock_gettime(CLOCK_MONOTONIC, &now))
+    {
+        return 0u;
+    }
+
+    return (uint32_t)(((uint32_t)now.tv_sec * 1000000u) + ((uint32_t)now.tv_nsec / 1000u));
+}
+
+/* Implementazione di esempio per l'host: i record vanno in coda a BINLOG_FILE,
+ * da leggere con tools/binLogDecode.py. Sul target qui va la UART di debug.
+ */
+void BinLog_OutputProject(const uint8_t *data, uint16_t len)
+{
+    static FILE *logFile = NULL;
+
+    if (NULL == logFile)
+    {
+        logFile = fopen(BINLOG_FILE, "ab");
+    }
+
+    if (NULL != logFile)
+    {
+        (void)fwrite(data, 1u, len, logFile);
+        (void)fflush(logFile);
+    }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file BinLog.h
+ * @brief Public interface of the deferred binary log.
+ *
+ * @details
+ * A log point stores a log ID, a timestamp and up to four raw 32-bit
+ * arguments into a lock-free ring: no formatting and no format string in
+ * the image. The format strings stay in the sources; tools/binLogGen.py
+ * extracts them at build time into the ID header (BinLog_ids.h) and a side
+ * table (BinLog_strings.csv) that tools/binLogDecode.py uses to render the
+ * records on the host.
+ *
+ * The module exposes:
+ * - The log point macros BINLOG0() .. BINLOG4().
+ * - An initialization function marking the start of a log.
+ * - A cyclic function sending the records out through BINLOG_OUTPUT_PROJECT.
+ * - A drain function serializing the records into a buffer.
+ *
+ * Log points may run in any task or interrupt: the ring is multi-producer.
+ * BinLog_MainFunction() / BinLog_Drain() shall run in one task only.
+ */
+
+#ifndef BIN_LOG_H
+#define BIN_LOG_H
+
+#include <stdint.h>
+#include "BinLog_cfg.h"
+#include "BinLog_ids.h"
+
+/** Arguments a record can carry. */
+#define BINLOG_MAX_ARGS                4u
+
+/** Reserved ID: start of a log, argument 0 is BINLOG_TABLE_CRC of the image. */
+#define BINLOG_ID_START                0u
+
+/** Reserved ID: argument 0 records were overwritten before being drained. */
+#define BINLOG_ID_LOST                 1u
+
+/**
+ * @brief Log points.
+ *
+ * @details
+ * BINLOGn(NAME, "format", arg1, .., argn) stores BINLOG_ID_NAME and the n
+ * arguments, each converted to uint32_t. The format is printf-like (%u, %d,
+ * %x, %X, %c with flags and width, one conversion per argument) and never
+ * reaches the compiler output: a log point whose NAME is missing from
+ * BinLog_ids.h does not build until the table is generated again (make gen).
+ * The arguments are not evaluated when BINLOG_ENABLED is 0.
+ */
+#if (BINLOG_ENABLED != 0)
+#define BINLOG0(name, fmt)                 BinLog_Write(BINLOG_ID_##name, 0u, 0u, 0u, 0u, 0u)
+#define BINLOG1(name, fmt, a)              BinLog_Write(BINLOG_ID_##name, 1u, (uint32_t)(a), 0u, 0u, 0u)
+#define BINLOG2(name, fmt, a, b)           BinLog_Write(BINLOG_ID_##name, 2u, (uint32_t)(a), (uint32_t)(b), 0u, 0u)
+#define BINLOG3(name, fmt, a, b, c)        BinLog_Write(BINLOG_ID_##name, 3u, (uint32_t)(a), (uint32_t)(b), \
+                                                        (uint32_t)(c), 0u)
+#define BINLOG4(name, fmt, a, b, c, d)     BinLog_Write(BINLOG_ID_##name, 4u, (uint32_t)(a), (uint32_t)(b), \
+                                                        (uint32_t)(c), (uint32_t)(d))
+#else
+#define BINLOG0(name, fmt)                 ((void)0)
+#define BINLOG1(name, fmt, a)              ((void)0)
+#define BINLOG2(name, fmt, a, b)           ((void)0)
+#define BINLOG3(name, fmt, a, b, c)        ((void)0)
+#define BINLOG4(name, fmt, a, b, c, d)     ((void)0)
+#endif
+
+/**
+ * @brief Start a log.
+ *
+ * @details
+ * Drops the records not drained yet and stores a #BINLOG_ID_START record
+ * with BINLOG_TABLE_CRC, so that the decoder can tell a log written by an
+ * image built from another string table. Call once at startup, before the
+ * tasks with log points run.
+ *
+ * @return None.
+ */
+void BinLog_Init(void);
+
+/**
+ * @brief Store one record (called by the BINLOGn() macros).
+ *
+ * @details
+ * Reserves the next slot of the ring with one atomic increment, fills it and
+ * publishes it. When the ring is full the oldest record is overwritten; the
+ * drain reports the overwritten records with a #BINLOG_ID_LOST record.
+ *
+ * @param id_u16   Log ID (BINLOG_ID_*).
+ * @param nArgs_u8 Arguments used, 0 .. #BINLOG_MAX_ARGS.
+ * @param a0_u32   Arguments, 0 when unused.
+ * @param a1_u32   "
+ * @param a2_u32   "
+ * @param a3_u32   "
+ *
+ * @return None.
+ */
+void BinLog_Write(uint16_t id_u16, uint8_t nArgs_u8, uint32_t a0_u32, uint32_t a1_u32, uint32_t a2_u32,
+                  uint32_t a3_u32);
+
+/**
+ * @brief Serialize the published records into a buffer.
+ *
+ * @details
+ * Records are written oldest first, little endian: ID (2 bytes), argument
+ * count (1), reserved (1), timestamp in us (4), then 4 bytes per argument.
+ * Only whole records are written. A record still being written by a
+ * preempted log point stops the drain until the next call.
+ *
+ * @param out_pu8  Output buffer.
+ * @param size_u16 Size of out_pu8, at least one record of #BINLOG_MAX_ARGS arguments (24 bytes).
+ *
+ * @return Bytes written to out_pu8, 0 when no record is ready.
+ */
+uint16_t BinLog_Drain(uint8_t *out_pu8, uint16_t size_u16);
+
+/**
+ * @brief Send the published records out.
+ *
+ * @details
+ * Drains the ring in chunks of BINLOG_DRAIN_CHUNK bytes through
+ * BINLOG_OUTPUT_PROJECT. Call from a background task: the formatting cost
+ * is paid by the host decoder, the output cost here, never at the log points.
+ *
+ * @return None.
+ */
+void BinLog_MainFunction(void);
+
+#endif /* BIN_LOG_H */
@@ -0,0 +1,45 @@
+#ifndef BIN_LOG_PRIV_H
+#define BIN_LOG_PRIV_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "BinLog.h"
+
+#define BINLOG_RING_MASK               (BINLOG_RING_SLOTS - 1u)
+
+/* Byte di un record serializzato: intestazione, poi 4 per argomento */
+#define BINLOG_REC_HDR_SIZE            8u
+#define BINLOG_REC_MAX_SIZE            (BINLOG_REC_HDR_SIZE + (4u * BINLOG_MAX_ARGS))
+
+_Static_assert((BINLOG_RING_SLOTS & BINLOG_RING_MASK) == 0u, "BINLOG_RING_SLOTS deve essere una potenza di 2");
+_Static_assert(BINLOG_DRAIN_CHUNK >= BINLOG_REC_MAX_SIZE, "BINLOG_DRAIN_CHUNK deve contenere un record intero");
+
+typedef struct
+{
+    uint16_t id_u16;
+    uint8_t  nArgs_u8;
+    uint32_t time_u32;
+    uint32_t args_au32[BINLOG_MAX_ARGS];
+} BinLog_Record_t;
+
+/* Slot del ring: seq vale indice + 1 del record contenuto quando e' completo,
+ * 0 mentre un punto di log lo sta scrivendo.
+ */
+typedef struct
+{
+    atomic_uint_least32_t seq;
+    BinLog_Record_t       rec;
+} BinLog_Slot_t;
+
+/* Stato del ring (definito in BinLog.c) */
+typedef struct
+{
+    BinLog_Slot_t         slots[BINLOG_RING_SLOTS];
+    atomic_uint_least32_t writeIdx;    /* Prossimo record riservato dai punti di log */
+    uint32_t              readIdx;     /* Prossimo record da scaricare, solo BinLog_Drain */
+    uint32_t              lost;        /* Record sovrascritti non ancora segnalati */
+} BinLog_Ring_t;
+
+extern BinLog_Ring_t BinLog_Ring;
+
+#endif /* BIN_LOG_PRIV_H */
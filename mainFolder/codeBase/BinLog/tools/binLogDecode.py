@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+"""
+Host decoder of the BinLog records.
+
+Reads the records written by BinLog_Drain() (e.g. the BINLOG_FILE of a host
+build, or a capture of the debug UART) and renders them with the formats of
+the string table generated by tools/binLogGen.py:
+
+    <time [s]>  <source>  <message>
+
+Times are relative to the first record, 32-bit timestamp wraps included.
+
+Usage:
+    python binLogDecode.py <BinLog_strings.csv> <log file>
+"""
+
+import re
+import struct
+import sys
+
+ID_START = 0
+ID_LOST = 1
+
+REC_HDR = struct.Struct("<HBBI")
+
+# Length modifiers mean nothing to a raw 32-bit argument and Python does not know them
+MODIFIER_RE = re.compile(r"(%[-+ #0]*[0-9]*(?:\.[0-9]+)?)(?:hh|h|ll|l)([a-zA-Z])")
+CONVERSION_RE = re.compile(r"%(?:%|[-+ #0]*[0-9]*(?:\.[0-9]+)?([a-zA-Z]))")
+
+
+def load_table(path):
+    table, crc = {}, None
+    with open(path, "r", encoding="utf-8") as file:
+        for line in file:
+            line = line.rstrip("\n")
+            if line.startswith("# crc "):
+                crc = int(line[6:], 16)
+            if not line or line.startswith("#"):
+                continue
+            ident, name, n_args, source, fmt = line.split(";", 4)
+            fmt = MODIFIER_RE.sub(r"\1\2", fmt.encode("utf-8").decode("unicode_escape"))
+            table[int(ident)] = {"name": name, "args": int(n_args), "source": source, "fmt": fmt}
+    return table, crc
+
+
+def render(fmt, args):
+    # Signed conversions see the argument as int32_t, %c as a character
+    values = []
+    for match, raw in zip((m for m in CONVERSION_RE.finditer(fmt) if m.group(1)), args):
+        conv = match.group(1)
+        if conv in "di":
+            values.append(raw - (1 << 32) if raw & 0x80000000 else raw)
+        elif conv == "c":
+            values.append(chr(raw & 0xFF))
+        else:
+            values.append(raw)
+    try:
+        return fmt.rstrip("\n") % tuple(values)
+    except (TypeError, ValueError):
+        return f"{fmt!r} % {args}"
+
+
+def decode(table, crc, data):
+    out = []
+    pos, first, last, elapsed = 0, None, 0, 0
+    while pos + REC_HDR.size <= len(data):
+        ident, n_args, _, time_us = REC_HDR.unpack_from(data, pos)
+        end = pos + REC_HDR.size + 4 * n_args
+        if n_args > 4 or end > len(data):
+            out.append(f"--- truncated record at byte {pos}")
+            break
+        args = list(struct.unpack_from(f"<{n_args}I", data, pos + REC_HDR.size))
+        pos = end
+
+        if first is None:
+            first = last = time_us
+        elapsed += (time_us - last) & 0xFFFFFFFF
+        last = time_us
+        stamp = f"{elapsed / 1e6:12.6f}"
+
+        if ident == ID_START:
+            note = "" if crc is None or args[0] == crc else f" - built with table 0x{args[0]:08X}, decoding with 0x{crc:08X}"
+            out.append(f"{stamp}  --- log start{note}")
+        elif ident == ID_LOST:
+            out.append(f"{stamp}  --- {args[0]} records lost")
+        elif ident in table:
+            point = table[ident]
+            out.append(f"{stamp}  {point['source']:<18} {render(point['fmt'], args)}")
+        else:
+            out.append(f"{stamp}  unknown log ID {ident}: {' '.join(f'0x{a:X}' for a in args)}")
+    return out
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    try:
+        strings, table_crc = load_table(sys.argv[1])
+        with open(sys.argv[2], "rb") as log:
+            raw = log.read()
+    except (OSError, ValueError) as e:
+        print(f"❌ {e}")
+        sys.exit(1)
+
+    for text in decode(strings, table_crc, raw):
+        print(text)
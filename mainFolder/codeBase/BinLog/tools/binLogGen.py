@@ -0,0 +1,167 @@
+# -*- coding: utf-8 -*-
+"""
+Log string table generator for the BinLog module.
+
+Scans C sources for the log points BINLOG0(NAME, "format") .. BINLOG4(NAME,
+"format", a, b, c, d) and writes:
+    - BinLog_ids.h       : BINLOG_ID_<NAME> per log point and BINLOG_TABLE_CRC,
+                           the only part of the log points that reaches the image
+    - BinLog_strings.csv : ID, name, argument count, source file and format of
+                           every log point, read by tools/binLogDecode.py
+
+A NAME may be used at several places with the same format. IDs follow the
+name order, from 2 on (0 and 1 are BINLOG_ID_START and BINLOG_ID_LOST).
+
+Usage:
+    python binLogGen.py <output_dir> <c_source>...
+"""
+
+import os
+import re
+import sys
+import zlib
+
+GEN_HEADER = "BinLog_ids.h"
+GEN_TABLE = "BinLog_strings.csv"
+
+FIRST_ID = 2
+MAX_ID = 0xFFFF
+
+BANNER = """/*
+ * GENERATED FILE - DO NOT EDIT.
+ * Source : {src}
+ * Tool   : tools/binLogGen.py
+ */
+"""
+
+# BINLOGn( NAME , "format" [, args] ) - the arguments are checked by the compiler
+LOG_POINT_RE = re.compile(r'\bBINLOG([0-4])\s*\(\s*([A-Za-z_][A-Za-z0-9_]*)\s*,\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)')
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+
+# Conversions the decoder can render from a raw 32-bit argument
+CONVERSION_RE = re.compile(r"%(%|[-+ #0]*[0-9]*(?:\.[0-9]+)?(?:hh|h|ll|l)?([a-zA-Z]))")
+CONVERSIONS = "diuxXc"
+
+
+def strip_comments(text):
+    """Blank out comments, keeping strings and line numbers."""
+    out = []
+    i = 0
+    while i < len(text):
+        if text.startswith("//", i):
+            end = text.find("\n", i)
+            end = len(text) if end < 0 else end
+            out.append(" " * (end - i))
+            i = end
+        elif text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            end = len(text) if end < 0 else end + 2
+            out.append(re.sub(r"[^\n]", " ", text[i:end]))
+            i = end
+        elif text[i] in "\"'":
+            quote = text[i]
+            j = i + 1
+            while j < len(text) and text[j] != quote and text[j] != "\n":
+                j += 2 if text[j] == "\\" else 1
+            out.append(text[i:j + 1])
+            i = j + 1
+        else:
+            out.append(text[i])
+            i += 1
+    return "".join(out)
+
+
+def count_conversions(fmt, where):
+    count = 0
+    for match in CONVERSION_RE.finditer(fmt):
+        if match.group(1) == "%":
+            continue
+        if match.group(2) not in CONVERSIONS:
+            raise ValueError(f"{where}: conversion '%{match.group(1)}' cannot render a raw 32-bit argument")
+        count += 1
+    if "%" in CONVERSION_RE.sub("", fmt):
+        raise ValueError(f"{where}: incomplete conversion in \"{fmt}\"")
+    return count
+
+
+def scan(paths):
+    points = {}
+    for path in paths:
+        with open(path, "r", encoding="utf-8") as file:
+            text = strip_comments(file.read())
+        for match in LOG_POINT_RE.finditer(text):
+            n_args = int(match.group(1))
+            name = match.group(2)
+            fmt = "".join(STRING_RE.findall(match.group(3)))
+            line = text.count("\n", 0, match.start()) + 1
+            where = f"{path}:{line}"
+
+            if count_conversions(fmt, where) != n_args:
+                raise ValueError(f"{where}: BINLOG{n_args}({name}) format \"{fmt}\" does not take {n_args} arguments")
+            if name in points:
+                first = points[name]
+                if (first["fmt"], first["args"]) != (fmt, n_args):
+                    raise ValueError(f"{where}: {name} already logged with another format at {first['where']}")
+                continue
+            points[name] = {"name": name, "fmt": fmt, "args": n_args, "where": where,
+                            "module": os.path.basename(path)}
+
+    table = sorted(points.values(), key=lambda p: p["name"])
+    if FIRST_ID + len(table) > MAX_ID + 1:
+        raise ValueError("too many log points for 16-bit IDs")
+    for idx, point in enumerate(table):
+        point["id"] = FIRST_ID + idx
+    return table
+
+
+def gen_table(table):
+    # No line numbers: editing a source around its log points leaves the table (and its CRC) alone
+    rows = [f"{p['id']};{p['name']};{p['args']};{p['module']};{p['fmt']}" for p in table]
+    crc = zlib.crc32("\n".join(rows).encode("utf-8")) & 0xFFFFFFFF
+    out = ["# GENERATED FILE - DO NOT EDIT. Tool: tools/binLogGen.py",
+           f"# crc 0x{crc:08X}",
+           "# id;name;args;source;format"]
+    return "\n".join(out + rows) + "\n", crc
+
+
+def gen_header(table, crc, src):
+    out = [BANNER.format(src=src)]
+    out.append("#ifndef BIN_LOG_IDS_H")
+    out.append("#define BIN_LOG_IDS_H\n")
+    out.append("/* CRC32 of BinLog_strings.csv: logged by BinLog_Init, checked by the decoder */")
+    out.append(f"#define BINLOG_TABLE_CRC 0x{crc:08X}u\n")
+    for p in table:
+        out.append(f"/* {p['module']}: \"{p['fmt']}\" */")
+        out.append(f"#define BINLOG_ID_{p['name']} {p['id']}u")
+    out.append("\n#endif /* BIN_LOG_IDS_H */\n")
+    return "\n".join(out)
+
+
+def write_if_changed(path, content):
+    # Keep timestamps stable when nothing changes to avoid useless rebuilds
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as file:
+            if file.read() == content:
+                print(f"✅ '{path}' up to date.")
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as file:
+        file.write(content)
+    print(f"✅ '{path}' generated.")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    out_dir, sources = sys.argv[1], sys.argv[2:]
+    try:
+        log_points = scan(sources)
+    except (OSError, ValueError) as e:
+        print(f"❌ {e}")
+        sys.exit(1)
+
+    table_text, table_crc = gen_table(log_points)
+    src = ", ".join(os.path.basename(path) for path in sources)
+    write_if_changed(os.path.join(out_dir, GEN_HEADER), gen_header(log_points, table_crc, src))
+    write_if_changed(os.path.join(out_dir, GEN_TABLE), table_text)
@@ -0,0 +1,146 @@
+#include "BinLog_Drain.h"
+#include "BinLog_priv.h"
+
+BinLog_Ring_t BinLog_Ring;
+
+/* Helper locali */
+static uint16_t BinLog_Put32(uint8_t *out, uint16_t pos, uint32_t value)
+{
+    out[pos]      = (uint8_t)value;
+    out[pos + 1u] = (uint8_t)(value >> 8);
+    out[pos + 2u] = (uint8_t)(value >> 16);
+    out[pos + 3u] = (uint8_t)(value >> 24);
+    return (uint16_t)(pos + 4u);
+}
+
+static uint16_t BinLog_PutRecord(uint8_t *out, uint16_t pos, const BinLog_Record_t *rec)
+{
+    uint8_t arg;
+
+    out[pos]      = (uint8_t)rec->id_u16;
+    out[pos + 1u] = (uint8_t)(rec->id_u16 >> 8);
+    out[pos + 2u] = rec->nArgs_u8;
+    out[pos + 3u] = 0u;
+    pos = BinLog_Put32(out, (uint16_t)(pos + 4u), rec->time_u32);
+
+    for (arg = 0u; arg < rec->nArgs_u8; arg++)
+    {
+        pos = BinLog_Put32(out, pos, rec->args_au32[arg]);
+    }
+    return pos;
+}
+
+void BinLog_Init(void)
+{
+    uint32_t idx;
+
+    for (idx = 0u; idx < BINLOG_RING_SLOTS; idx++)
+    {
+        atomic_store_explicit(&BinLog_Ring.slots[idx].seq, 0u, memory_order_relaxed);
+    }
+    atomic_store_explicit(&BinLog_Ring.writeIdx, 0u, memory_order_relaxed);
+    BinLog_Ring.readIdx = 0u;
+    BinLog_Ring.lost = 0u;
+
+    BinLog_Write(BINLOG_ID_START, 1u, BINLOG_TABLE_CRC, 0u, 0u, 0u);
+}
+
+void BinLog_Write(uint16_t id_u16, uint8_t nArgs_u8, uint32_t a0_u32, uint32_t a1_u32, uint32_t a2_u32,
+                  uint32_t a3_u32)
+{
+    /* Unica operazione atomica: riserva lo slot, anche contro un interrupt che logga */
+    const uint32_t idx = (uint32_t)atomic_fetch_add_explicit(&BinLog_Ring.writeIdx, 1u, memory_order_relaxed);
+    BinLog_Slot_t *const slot = &BinLog_Ring.slots[idx & BINLOG_RING_MASK];
+
+    atomic_store_explicit(&slot->seq, 0u, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->rec.id_u16 = id_u16;
+    slot->rec.nArgs_u8 = (nArgs_u8 <= BINLOG_MAX_ARGS) ? nArgs_u8 : BINLOG_MAX_ARGS;
+    slot->rec.time_u32 = BINLOG_TIMESTAMP_PROJECT();
+    slot->rec.args_au32[0] = a0_u32;
+    slot->rec.args_au32[1] = a1_u32;
+    slot->rec.args_au32[2] = a2_u32;
+    slot->rec.args_au32[3] = a3_u32;
+
+    /* Pubblicazione: il record e' visibile al drain solo da qui */
+    atomic_store_explicit(&slot->seq, idx + 1u, memory_order_release);
+}
+
+uint16_t BinLog_Drain(uint8_t *out_pu8, uint16_t size_u16)
+{
+    uint16_t pos = 0u;
+
+    while (((uint32_t)pos + BINLOG_REC_MAX_SIZE) <= size_u16)
+    {
+        const uint32_t writeIdx = (uint32_t)atomic_load_explicit(&BinLog_Ring.writeIdx, memory_order_acquire);
+        BinLog_Slot_t *slot;
+        BinLog_Record_t rec;
+        uint32_t seq;
+
+        /* Record sovrascritti dai punti di log: si riparte dal piu' vecchio rimasto */
+        if ((writeIdx - BinLog_Ring.readIdx) > BINLOG_RING_SLOTS)
+        {
+            BinLog_Ring.lost += (writeIdx - BinLog_Ring.readIdx) - BINLOG_RING_SLOTS;
+            BinLog_Ring.readIdx = writeIdx - BINLOG_RING_SLOTS;
+        }
+
+        if (0u != BinLog_Ring.lost)
+        {
+            rec.id_u16 = BINLOG_ID_LOST;
+            rec.nArgs_u8 = 1u;
+            rec.time_u32 = BINLOG_TIMESTAMP_PROJECT();
+            rec.args_au32[0] = BinLog_Ring.lost;
+            BinLog_Ring.lost = 0u;
+            pos = BinLog_PutRecord(out_pu8, pos, &rec);
+            continue;
+        }
+
+        if (writeIdx == BinLog_Ring.readIdx)
+        {
+            break;
+        }
+
+        slot = &BinLog_Ring.slots[BinLog_Ring.readIdx & BINLOG_RING_MASK];
+        seq = (uint32_t)atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq != (BinLog_Ring.readIdx + 1u))
+        {
+            /* 0 o un record precedente: punto di log interrotto a meta', riprova al prossimo giro.
+             * Un record successivo: lo slot e' stato sovrascritto, contato al prossimo giro.
+             */
+            if ((0u != seq) && ((int32_t)(seq - (BinLog_Ring.readIdx + 1u)) > 0))
+            {
+                BinLog_Ring.lost++;
+                BinLog_Ring.readIdx++;
+                continue;
+            }
+            break;
+        }
+
+        rec = slot->rec;
+
+        /* Sovrascritto durante la copia: la copia non vale */
+        atomic_thread_fence(memory_order_acquire);
+        if ((uint32_t)atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq)
+        {
+            continue;
+        }
+
+        pos = BinLog_PutRecord(out_pu8, pos, &rec);
+        BinLog_Ring.readIdx++;
+    }
+
+    return pos;
+}
+
+void BinLog_MainFunction(void)
+{
+    uint8_t chunk[BINLOG_DRAIN_CHUNK];
+    uint16_t len = BinLog_Drain(chunk, BINLOG_DRAIN_CHUNK);
+
+    while (0u != len)
+    {
+        BINLOG_OUTPUT_PROJECT(chunk, len);
+        len = BinLog_Drain(chunk, BINLOG_DRAIN_CHUNK);
+    }
+}
@@ -0,0 +1,140 @@
+#include "unity.h"
+#include "BinLog_Drain.h"
+#include "BinLog_priv.h"
+
+#define TEST_ID 7u
+
+static uint32_t timestamp_us;
+static uint8_t out[(BINLOG_RING_SLOTS + 2u) * BINLOG_REC_MAX_SIZE];
+
+/* Stand-in di BINLOG_TIMESTAMP_PROJECT */
+uint32_t BinLog_TimestampProject_us(void)
+{
+    return timestamp_us;
+}
+
+/* Stand-in di BINLOG_OUTPUT_PROJECT, BinLog_MainFunction non e' testata qui */
+void BinLog_OutputProject(const uint8_t *data, uint16_t len)
+{
+    (void)data;
+    (void)len;
+}
+
+static uint32_t get32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static uint16_t get16(const uint8_t *data)
+{
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+/* ============================================================================
+ * Test Setup and Teardown
+ * ============================================================================ */
+void setUp(void)
+{
+    timestamp_us = 1000u;
+    BinLog_Init();
+
+    /* Record di avvio scaricato qui, controllato dal suo test */
+    (void)BinLog_Drain(out, (uint16_t)sizeof(out));
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * BinLog_Drain Tests - Record Layout
+ * ============================================================================ */
+
+void test_BinLog_Drain_StartRecord(void)
+{
+    /* Test: BinLog_Init drops the records not drained and logs the table CRC */
+    BinLog_Write(TEST_ID, 0u, 0u, 0u, 0u, 0u);
+    timestamp_us = 2000u;
+    BinLog_Init();
+
+    TEST_ASSERT_EQUAL_UINT16(12u, BinLog_Drain(out, (uint16_t)sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT16(BINLOG_ID_START, get16(&out[0]));
+    TEST_ASSERT_EQUAL_UINT8(1u, out[2]);
+    TEST_ASSERT_EQUAL_UINT32(2000u, get32(&out[4]));
+    TEST_ASSERT_EQUAL_HEX32(BINLOG_TABLE_CRC, get32(&out[8]));
+
+    TEST_ASSERT_EQUAL_UINT16(0u, BinLog_Drain(out, (uint16_t)sizeof(out)));
+}
+
+void test_BinLog_Drain_ArgumentsLittleEndian(void)
+{
+    /* Test: only the arguments used are serialized, little endian, after ID, count and time */
+    timestamp_us = 0x01020304u;
+    BinLog_Write(TEST_ID, 2u, 0xA1B2C3D4u, 0xFFFFFFFFu, 0x55u, 0x66u);
+
+    TEST_ASSERT_EQUAL_UINT16(16u, BinLog_Drain(out, (uint16_t)sizeof(out)));
+    TEST_ASSERT_EQUAL_HEX8(TEST_ID, out[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, out[1]);
+    TEST_ASSERT_EQUAL_UINT8(2u, out[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x04, out[4]);
+    TEST_ASSERT_EQUAL_HEX8(0x01, out[7]);
+    TEST_ASSERT_EQUAL_HEX32(0xA1B2C3D4u, get32(&out[8]));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFFu, get32(&out[12]));
+}
+
+void test_BinLog_Drain_WholeRecordsOnly(void)
+{
+    /* Test: a buffer of one and a half records takes one, the next one waits for the next call */
+    BinLog_Write(TEST_ID, 4u, 1u, 2u, 3u, 4u);
+    BinLog_Write(TEST_ID, 4u, 5u, 6u, 7u, 8u);
+
+    TEST_ASSERT_EQUAL_UINT16(BINLOG_REC_MAX_SIZE, BinLog_Drain(out, (uint16_t)(BINLOG_REC_MAX_SIZE + 12u)));
+    TEST_ASSERT_EQUAL_UINT32(1u, get32(&out[8]));
+    TEST_ASSERT_EQUAL_UINT16(BINLOG_REC_MAX_SIZE, BinLog_Drain(out, (uint16_t)sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT32(5u, get32(&out[8]));
+}
+
+/* ============================================================================
+ * BinLog_Drain Tests - Ring
+ * ============================================================================ */
+
+void test_BinLog_Drain_Overwritten_ReportsLost(void)
+{
+    /* Test: 5 records more than the ring holds, then the drain */
+    uint32_t idx;
+    uint16_t len;
+
+    for (idx = 0u; idx < (BINLOG_RING_SLOTS + 5u); idx++)
+    {
+        BinLog_Write(TEST_ID, 1u, idx, 0u, 0u, 0u);
+    }
+
+    len = BinLog_Drain(out, (uint16_t)sizeof(out));
+
+    /* Assert: LOST(5) first, then the last BINLOG_RING_SLOTS records in order */
+    TEST_ASSERT_EQUAL_UINT16(12u + (BINLOG_RING_SLOTS * 12u), len);
+    TEST_ASSERT_EQUAL_UINT16(BINLOG_ID_LOST, get16(&out[0]));
+    TEST_ASSERT_EQUAL_UINT32(5u, get32(&out[8]));
+    TEST_ASSERT_EQUAL_UINT32(5u, get32(&out[12u + 8u]));
+    TEST_ASSERT_EQUAL_UINT32(BINLOG_RING_SLOTS + 4u, get32(&out[len - 4u]));
+}
+
+void test_BinLog_Drain_RecordInProgress_Waits(void)
+{
+    /* Test: a log point preempted between reservation and publication stops the drain there */
+    BinLog_Write(TEST_ID, 1u, 1u, 0u, 0u, 0u);
+    BinLog_Write(TEST_ID, 1u, 2u, 0u, 0u, 0u);
+    BinLog_Write(TEST_ID, 1u, 3u, 0u, 0u, 0u);
+
+    /* Slot del secondo record riservato ma non ancora pubblicato */
+    atomic_store(&BinLog_Ring.slots[2].seq, 0u);
+
+    TEST_ASSERT_EQUAL_UINT16(12u, BinLog_Drain(out, (uint16_t)sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT32(1u, get32(&out[8]));
+
+    /* Pubblicato: il drain riprende in ordine */
+    atomic_store(&BinLog_Ring.slots[2].seq, 3u);
+    TEST_ASSERT_EQUAL_UINT16(24u, BinLog_Drain(out, (uint16_t)sizeof(out)));
+    TEST_ASSERT_EQUAL_UINT32(2u, get32(&out[8]));
+    TEST_ASSERT_EQUAL_UINT32(3u, get32(&out[20]));
+}
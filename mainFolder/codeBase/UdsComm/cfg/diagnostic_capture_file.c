@@ -0,0 +1,32 @@
+#define _POSIX_C_SOURCE 200112L
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "diagnostic_cfg.h"
+
+/* Host stand-in of the capture memory: LIN_DIAG_CAPTURE_FILE mapped shared, so the records reach
+ * the file without a write call and survive a crash of the process. On target, a RAM section left
+ * out of the startup initialisation goes here.
+ */
+uint8 *diagCaptureBackendMap(void)
+{
+    const int l_fd = open(LIN_DIAG_CAPTURE_FILE, O_RDWR | O_CREAT, 0644);
+    void *l_mem_pv;
+
+    if (l_fd < 0)
+    {
+        return NULL;
+    }
+
+    /* A new file reads as zeros: no ring yet, formatted by LinDiagCaptureStart */
+    if (0 != ftruncate(l_fd, (off_t)LIN_DIAG_CAPTURE_SIZE))
+    {
+        (void)close(l_fd);
+        return NULL;
+    }
+
+    l_mem_pv = mmap(NULL, LIN_DIAG_CAPTURE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, l_fd, 0);
+    (void)close(l_fd);
+
+    return (MAP_FAILED != l_mem_pv) ? (uint8 *)l_mem_pv : NULL;
+}
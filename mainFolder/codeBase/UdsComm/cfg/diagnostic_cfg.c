@@ -3,35 +3,136 @@
 #define NULL ((void *)0)
 
 
-void checkCurrentNad(uint8 currentNad, Std_ReturnType *result)
+/* Check the NAD a request was addressed to */
+void checkCurrentNad(uint8 currentNad, uint8 nodeNad, Std_ReturnType *result)
 {
-    (void)currentNad;
-    *result = E_OK;
+    if ((currentNad == nodeNad) || (LIN_DIAG_NAD_WILDCARD == currentNad)) {
+        *result = E_OK;
+    } else {
+        *result = E_NOT_OK;
+    }
 }
 
 /* Check if message data length is valid */
 void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result)
 {
-    if (dataLength > 0u && dataLength <= 32u) {
+    if (dataLength > 0u && dataLength <= LIN_DIAG_BUFFER_SIZE) {
         *result = E_OK;
     } else {
         *result = E_NOT_OK;
     }
 }
 
-Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8*const  output_pu8,
-    uint8*const  size_pu8, uint8* const errCode_pu8)
+void checkPeriodicDid(diagNode_t *node_ps, uint16 l_did_u16, Std_ReturnType *result)
+{
+    const diagDidEntry_t *const l_entry_ps = diagFindDidEntry(node_ps->table_ps, l_did_u16);
+
+    if ((NULL != l_entry_ps) && (NULL == l_entry_ps->streamHandler_pf) && (NULL == l_entry_ps->asyncHandler_pf) &&
+        (l_entry_ps->size_u16 <= (LIN_DIAG_BUFFER_SIZE - 2u))) {
+        *result = E_OK;
+    } else {
+        *result = E_NOT_OK;
+    }
+}
+
+/* IS_OVERVOLT_FLAG, served as data DID 0xF308 */
+uint8 diagOverVoltageFlag_u8 = 0x01; /* Example data */
+
+/* VIN before the end of line writes it, every node starts from it and persists its own */
+uint8 diagVin_au8[DID_F190_SIZE];
+
+/* CALIBRATION_DUMP, streamed as data DID 0xFD00 */
+uint8 diagCalibrationDump_au8[DID_FD00_SIZE];
+
+/* SUPPLY_VOLTAGE in mV, served as 0.1 V by scaled DID 0xF420 */
+uint16 diagSupplyVoltage_mV_u16 = 12000u; /* Example data: VoltMon_ReadVoltageProject_mV() */
+
+/* DID context of the node served by LinDiag_DefaultChannel */
+diagNode_t diagDefaultNode;
+
+void diagNodeInit(diagNode_t *node_ps, uint8 l_index_u8)
 {
+    uint8 *const l_raw_pu8 = (uint8 *)node_ps;
+    uint16 l_idx_u16;
+    uint16 l_byte_u16;
+
+    /* Composite DIDs, caches, async state and fault memory start empty */
+    for (l_byte_u16 = 0u; l_byte_u16 < sizeof(diagNode_t); l_byte_u16++)
+    {
+        l_raw_pu8[l_byte_u16] = 0u;
+    }
+
+    node_ps->table_ps = &diagDidTableCfg;
+    node_ps->nvmBase_u16 = (uint16)(l_index_u8 * DIAG_NVM_NODE_SIZE);
+
+    for (l_idx_u16 = 0u; l_idx_u16 < node_ps->table_ps->size_u16; l_idx_u16++)
+    {
+        const diagDidEntry_t *const l_entry_ps = &node_ps->table_ps->entries_pcs[l_idx_u16];
+        const uint16 l_length_u16 = (uint16)((uint16)(l_entry_ps->didLast_u16 - l_entry_ps->didFirst_u16 + 1u) *
+                                             l_entry_ps->size_u16);
+
+        if (NULL != l_entry_ps->write_ps)
+        {
+            for (l_byte_u16 = 0u; l_byte_u16 < l_length_u16; l_byte_u16++)
+            {
+                node_ps->didRam_au8[l_entry_ps->write_ps->ram_u16 + l_byte_u16] = l_entry_ps->data_pu8[l_byte_u16];
+            }
+        }
+    }
+
+    diagNvmInit(node_ps);
+    diagDtcInit(node_ps);
+}
+
+Std_ReturnType RdbiChannelStatusRange_(const uint16 offset_u16, uint8*const  output_pu8,
+    const uint8 capacity_u8, uint8*const  size_pu8, uint8* const errCode_pu8)
+{
+  (void)capacity_u8;
   (void)size_pu8;
   (void)errCode_pu8;
-  output_pu8[0] = 0x01; /* Example data */
+  output_pu8[0] = (uint8)offset_u16; /* Example data: channel index */
   return E_OK;
 }
 
-Std_ReturnType Subfunction_Request_Out_Of_Range(uint8*const  output_pu8,
+/* EEPROM_CHECKSUM: example of a slow source, the checksum is ready a few polls later */
+#define DIAG_EEPROM_CHECKSUM_POLLS 3u
+
+Std_ReturnType RdbiEepromChecksumAsync_(const uint8 opStatus_u8, uint32_t*const state_pu32, uint8*const  output_pu8,
+    const uint8 capacity_u8, uint8*const  size_pu8, uint8* const errCode_pu8)
+{
+  (void)capacity_u8;
+  (void)size_pu8;
+  (void)errCode_pu8;
+
+  if (DIAG_OPSTATUS_INITIAL == opStatus_u8)
+  {
+    *state_pu32 = 0u;                /* Example: start the EEPROM read */
+  }
+  else if (DIAG_OPSTATUS_CANCEL == opStatus_u8)
+  {
+    return E_OK;                     /* Example: abort the EEPROM read */
+  }
+  else
+  {
+    /* DIAG_OPSTATUS_PENDING */
+  }
+
+  if (*state_pu32 < DIAG_EEPROM_CHECKSUM_POLLS)
+  {
+    (*state_pu32)++;
+    return DIAG_E_PENDING;
+  }
+
+  output_pu8[0] = 0xC3; /* Example data */
+  output_pu8[1] = 0x5A;
+  return E_OK;
+}
+
+Std_ReturnType Subfunction_Request_Out_Of_Range(uint8*const  output_pu8, const uint8 capacity_u8,
     uint8*const  size_pu8, uint8* const errCode_pu8)
 {
   (void)output_pu8;
+  (void)capacity_u8;
   (void)size_pu8;
   if(NULL != errCode_pu8)
   {
@@ -40,28 +141,359 @@ Std_ReturnType Subfunction_Request_Out_Of_Range(uint8*const  output_pu8,
   return E_NOT_OK;
 }
 
-Std_ReturnType getHandlersForReadDataById(uint8 l_did_u8, uint16 l_did_cu16,  uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_,  uint8 *l_diagBuf_pu8)
+/* Binary search of the DID table: O(log n) whatever the number of DIDs.
+ * Only the dense key array is walked, the descriptor is touched once at the end.
+ */
+const diagDidEntry_t *diagFindDidEntry(const diagDidTable_t *const table_ps, const uint16 did_u16)
+{
+    uint16 l_low_u16 = 0u;
+    uint16 l_high_u16 = table_ps->size_u16;
+    const diagDidEntry_t *l_entry_ps = NULL;
+
+    /* Find the last entry whose first DID is <= did_u16 */
+    while (l_low_u16 < l_high_u16)
+    {
+        const uint16 l_mid_u16 = (uint16)(l_low_u16 + ((l_high_u16 - l_low_u16) >> 1));
+
+        if (did_u16 < table_ps->keys_pcu16[l_mid_u16])
+        {
+            l_high_u16 = l_mid_u16;
+        }
+        else
+        {
+            l_low_u16 = (uint16)(l_mid_u16 + 1u);
+        }
+    }
+
+    if (l_low_u16 > 0u)
+    {
+        l_entry_ps = &table_ps->entries_pcs[l_low_u16 - 1u];
+
+        if (did_u16 > l_entry_ps->didLast_u16)
+        {
+            l_entry_ps = NULL;
+        }
+    }
+
+    return l_entry_ps;
+}
+
+void diagDidCacheMainFunction(diagNode_t *node_ps)
+{
+    node_ps->cacheTicks_u16++;
+}
+
+void diagDidCacheClear(diagNode_t *node_ps)
+{
+    uint16 l_slot_u16;
+
+    for (l_slot_u16 = 0u; l_slot_u16 < DIAG_CACHE_SLOT_COUNT; l_slot_u16++)
+    {
+        node_ps->cacheSlots_as[l_slot_u16].valid_u8 = 0u;
+    }
+    node_ps->cacheTicks_u16 = 0u;
+}
+
+uint16 diagCacheStamp(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps)
+{
+    const diagDidCache_t *const l_cache_ps = entry_ps->cache_ps;
+
+    return (NULL != l_cache_ps->version_pu16) ? *l_cache_ps->version_pu16 : node_ps->cacheTicks_u16;
+}
+
+Std_ReturnType diagCacheRead(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8*const  size_pu8)
+{
+    const diagDidCache_t *const l_cache_ps = entry_ps->cache_ps;
+    const diagCacheSlot_t *const l_slot_ps = &node_ps->cacheSlots_as[l_cache_ps->slot_u16 + offset_u16];
+    const uint8 *const l_src_pu8 = &node_ps->cacheData_au8[l_cache_ps->data_u16 + (uint16)(offset_u16 * entry_ps->size_u16)];
+    uint16 l_idx_u16;
+
+    if (0u == l_slot_ps->valid_u8)
+    {
+        return E_NOT_OK;
+    }
+
+    if (NULL != l_cache_ps->version_pu16)
+    {
+        if (*l_cache_ps->version_pu16 != l_slot_ps->stamp_u16)
+        {
+            return E_NOT_OK;
+        }
+    }
+    else if ((uint16)(node_ps->cacheTicks_u16 - l_slot_ps->stamp_u16) >= l_cache_ps->ttlTicks_u16)
+    {
+        return E_NOT_OK;
+    }
+    else
+    {
+        /* Within its time-to-live */
+    }
+
+    for (l_idx_u16 = 0u; l_idx_u16 < l_slot_ps->size_u8; l_idx_u16++)
+    {
+        output_pu8[l_idx_u16] = l_src_pu8[l_idx_u16];
+    }
+    *size_pu8 = l_slot_ps->size_u8;
+
+    return E_OK;
+}
+
+void diagCacheWrite(diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    const uint16 stamp_u16, const uint8 *const response_pu8, const uint8 size_u8)
+{
+    const diagDidCache_t *const l_cache_ps = entry_ps->cache_ps;
+    diagCacheSlot_t *const l_slot_ps = &node_ps->cacheSlots_as[l_cache_ps->slot_u16 + offset_u16];
+    uint8 *const l_dst_pu8 = &node_ps->cacheData_au8[l_cache_ps->data_u16 + (uint16)(offset_u16 * entry_ps->size_u16)];
+    const uint8 l_size_u8 = (size_u8 < entry_ps->size_u16) ? size_u8 : (uint8)entry_ps->size_u16;
+    uint16 l_idx_u16;
+
+    for (l_idx_u16 = 0u; l_idx_u16 < l_size_u8; l_idx_u16++)
+    {
+        l_dst_pu8[l_idx_u16] = response_pu8[l_idx_u16];
+    }
+    l_slot_ps->size_u8 = l_size_u8;
+    l_slot_ps->stamp_u16 = stamp_u16;
+    l_slot_ps->valid_u8 = 1u;
+}
+
+const uint8 *diagDidData(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16)
+{
+    const uint16 l_pos_u16 = (uint16)(offset_u16 * entry_ps->size_u16);
+
+    return (NULL != entry_ps->write_ps) ? &node_ps->didRam_au8[entry_ps->write_ps->ram_u16 + l_pos_u16]
+                                        : &entry_ps->data_pu8[l_pos_u16];
+}
+
+/* Serve a data DID: bounded copy of size_u16 bytes, no handler call */
+Std_ReturnType diagCopyDidData(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps,
+    const uint16 offset_u16, uint8*const  output_pu8, uint8* const errCode_pu8)
+{
+    const uint8 *const l_src_pu8 = diagDidData(node_ps, entry_ps, offset_u16);
+    uint16 l_idx_u16;
+
+    if ((NULL != entry_ps->dataHook_pf) && (E_OK != entry_ps->dataHook_pf(errCode_pu8)))
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u16 = 0u; l_idx_u16 < entry_ps->size_u16; l_idx_u16++)
+    {
+        output_pu8[l_idx_u16] = l_src_pu8[l_idx_u16];
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType getHandlersForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16,  uint8 *l_diagBufSize_u8,
+    Std_ReturnType *l_didSupported_,  uint8 *l_diagBuf_pu8, uint8 l_diagBufCapacity_u8)
 {
-    (void)l_did_u8;
-    diagHandler_t l_handler_ = &Subfunction_Request_Out_Of_Range;
+    const diagDidEntry_t *const l_entry_ps = diagFindDidEntry(node_ps->table_ps, l_did_cu16);
+    const uint16 l_offset_u16 = (NULL != l_entry_ps) ? (uint16)(l_did_cu16 - l_entry_ps->didFirst_u16) : 0u;
     Std_ReturnType l_result_ = E_OK;
     uint8 l_errCode_u8 = 0;
-    
-    switch (l_did_cu16)
+    uint32_t l_start_u32;
+
+    if (NULL == l_entry_ps)
     {
-    /* IS_OVERVOLT_FLAG */
-    case 0xF308:
-        *l_diagBufSize_u8 = DID_F308_SIZE;
-        l_handler_ = &RdbiVhitOverVoltageFaultDiag_;
-        break;
+        const diagDynDid_t *const l_dyn_ps = diagFindDynamicDid(node_ps, l_did_cu16);
 
-    default:
-        *l_didSupported_  = E_NOT_OK;
-        l_result_ = E_NOT_OK;
-        l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
-        break;
+        if (NULL == l_dyn_ps)
+        {
+            *l_didSupported_  = E_NOT_OK;
+            *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+            return E_NOT_OK;
+        }
+
+        if (l_dyn_ps->span_u8 > l_diagBufCapacity_u8)
+        {
+            *l_errCode_pu8 = kLinDiagNrcResponseTooLong;
+            return E_NOT_OK;
+        }
+
+        l_result_ = diagReadDynamicDid(node_ps, l_dyn_ps, l_diagBuf_pu8, l_diagBufSize_u8, &l_errCode_u8);
+        if (E_OK != l_result_)
+        {
+            *l_errCode_pu8 = (0u != l_errCode_u8) ? l_errCode_u8 : kLinDiagNrcConditionsNotCorrect;
+        }
+        return l_result_;
+    }
+
+    /* Streamed DIDs never go through the buffer, see getStreamForReadDataById */
+    if ((l_entry_ps->size_u16 > l_diagBufCapacity_u8) || (NULL != l_entry_ps->streamHandler_pf))
+    {
+        *l_errCode_pu8 = kLinDiagNrcResponseTooLong;
+        return E_NOT_OK;
     }
-    
-    return l_result_ = l_handler_(l_diagBuf_pu8, l_diagBufSize_u8, &l_errCode_u8);
+
+    *l_diagBufSize_u8 = (uint8)l_entry_ps->size_u16;
+    l_start_u32 = diagStatsNow();
+
+    if (NULL != l_entry_ps->data_pu8)
+    {
+        l_result_ = diagCopyDidData(node_ps, l_entry_ps, l_offset_u16, l_diagBuf_pu8, &l_errCode_u8);
+    }
+    else if (NULL != l_entry_ps->signal_ps)
+    {
+        l_result_ = diagEncodeSignal(l_entry_ps, l_offset_u16, l_diagBuf_pu8, &l_errCode_u8);
+    }
+    else if (NULL != l_entry_ps->asyncHandler_pf)
+    {
+        l_result_ = l_entry_ps->asyncHandler_pf(DIAG_OPSTATUS_INITIAL, &node_ps->asyncState_u32, l_diagBuf_pu8,
+                                                l_diagBufCapacity_u8, l_diagBufSize_u8, &l_errCode_u8);
+    }
+    else if ((NULL != l_entry_ps->cache_ps) &&
+             (E_OK == diagCacheRead(node_ps, l_entry_ps, l_offset_u16, l_diagBuf_pu8, l_diagBufSize_u8)))
+    {
+        /* Fresh response in the cache: no handler call */
+    }
+    else
+    {
+        /* Taken before the call: a value changing while the handler runs is not cached as fresh */
+        const uint16 l_stamp_u16 = (NULL != l_entry_ps->cache_ps) ? diagCacheStamp(node_ps, l_entry_ps) : 0u;
+
+        if (NULL != l_entry_ps->rangeHandler_pf)
+        {
+            l_result_ = l_entry_ps->rangeHandler_pf(l_offset_u16, l_diagBuf_pu8, l_diagBufCapacity_u8, l_diagBufSize_u8,
+                                                    &l_errCode_u8);
+        }
+        else
+        {
+            l_result_ = l_entry_ps->handler_pf(l_diagBuf_pu8, l_diagBufCapacity_u8, l_diagBufSize_u8, &l_errCode_u8);
+        }
+
+        if ((E_OK == l_result_) && (NULL != l_entry_ps->cache_ps))
+        {
+            diagCacheWrite(node_ps, l_entry_ps, l_offset_u16, l_stamp_u16, l_diagBuf_pu8, *l_diagBufSize_u8);
+        }
+    }
+
+    if ((E_OK != l_result_) && (DIAG_E_PENDING != l_result_))
+    {
+        /* A handler refusing the read without an NRC gets the generic one */
+        *l_errCode_pu8 = (0u != l_errCode_u8) ? l_errCode_u8 : kLinDiagNrcConditionsNotCorrect;
+    }
+
+    diagStatsDidDone(l_entry_ps, DIAG_OPSTATUS_INITIAL, l_result_, *l_errCode_pu8, l_start_u32);
+
+    return l_result_;
 }
 
+Std_ReturnType pollHandlerForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8,
+    uint8 *l_diagBuf_pu8, uint8 l_diagBufCapacity_u8, uint8 l_opStatus_u8)
+{
+    const diagDidEntry_t *const l_entry_ps = diagFindDidEntry(node_ps->table_ps, l_did_cu16);
+    Std_ReturnType l_result_;
+    uint8 l_errCode_u8 = 0;
+    uint32_t l_start_u32;
+
+    if ((NULL == l_entry_ps) || (NULL == l_entry_ps->asyncHandler_pf))
+    {
+        *l_errCode_pu8 = kLinDiagNrcGeneralReject;
+        return E_NOT_OK;
+    }
+
+    *l_diagBufSize_u8 = (uint8)l_entry_ps->size_u16;
+    l_start_u32 = diagStatsNow();
+    l_result_ = l_entry_ps->asyncHandler_pf(l_opStatus_u8, &node_ps->asyncState_u32, l_diagBuf_pu8, l_diagBufCapacity_u8,
+                                            l_diagBufSize_u8, &l_errCode_u8);
+
+    if ((E_OK != l_result_) && (DIAG_E_PENDING != l_result_))
+    {
+        *l_errCode_pu8 = (0u != l_errCode_u8) ? l_errCode_u8 : kLinDiagNrcConditionsNotCorrect;
+    }
+
+    diagStatsDidDone(l_entry_ps, l_opStatus_u8, l_result_, *l_errCode_pu8, l_start_u32);
+
+    return l_result_;
+}
+
+Std_ReturnType setDataForWriteDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16, const uint8 *l_data_pu8,
+    uint16 l_length_u16)
+{
+    const diagDidEntry_t *const l_entry_ps = diagFindDidEntry(node_ps->table_ps, l_did_cu16);
+    const diagDidWrite_t *l_write_ps;
+    uint8 *l_dst_pu8;
+    uint16 l_idx_u16;
+
+    if ((NULL == l_entry_ps) || (NULL == l_entry_ps->write_ps))
+    {
+        *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    if (l_length_u16 != l_entry_ps->size_u16)
+    {
+        *l_errCode_pu8 = kLinDiagNrcIncorrectMsgLength;
+        return E_NOT_OK;
+    }
+
+    l_write_ps = l_entry_ps->write_ps;
+    l_dst_pu8 = &node_ps->didRam_au8[l_write_ps->ram_u16 + (uint16)((l_did_cu16 - l_entry_ps->didFirst_u16) * l_entry_ps->size_u16)];
+
+    for (l_idx_u16 = 0u; l_idx_u16 < l_length_u16; l_idx_u16++)
+    {
+        l_dst_pu8[l_idx_u16] = l_data_pu8[l_idx_u16];
+    }
+
+    /* Staged only: a burst of writes ends up in a single NVM commit */
+    if (DIAG_NVM_NO_BLOCK != l_write_ps->nvmBlock_u8)
+    {
+        diagNvmMarkDirty(node_ps, l_write_ps->nvmBlock_u8);
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType getStreamForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16, const uint8 **l_data_ppu8,
+    uint16 *l_length_pu16)
+{
+    const diagDidEntry_t *const l_entry_ps = diagFindDidEntry(node_ps->table_ps, l_did_cu16);
+    Std_ReturnType l_result_ = E_NOT_OK;
+    uint8 l_errCode_u8 = 0;
+    uint32_t l_start_u32;
+
+    if (NULL == l_entry_ps)
+    {
+        *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    l_start_u32 = diagStatsNow();
+
+    if (NULL != l_entry_ps->streamHandler_pf)
+    {
+        l_result_ = l_entry_ps->streamHandler_pf(node_ps->streamData_au8, l_data_ppu8, l_length_pu16, &l_errCode_u8);
+
+        if ((E_OK == l_result_) && (*l_length_pu16 > l_entry_ps->size_u16))
+        {
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcResponseTooLong;
+        }
+    }
+    else if (NULL != l_entry_ps->data_pu8)
+    {
+        const uint16 l_offset_u16 = (uint16)(l_did_cu16 - l_entry_ps->didFirst_u16);
+
+        if ((NULL == l_entry_ps->dataHook_pf) || (E_OK == l_entry_ps->dataHook_pf(&l_errCode_u8)))
+        {
+            *l_data_ppu8 = diagDidData(node_ps, l_entry_ps, l_offset_u16);
+            *l_length_pu16 = l_entry_ps->size_u16;
+            l_result_ = E_OK;
+        }
+    }
+    else
+    {
+        /* Buffered handlers are bounded by the generator, nothing to stream */
+        l_errCode_u8 = kLinDiagNrcResponseTooLong;
+    }
+
+    if (E_OK != l_result_)
+    {
+        *l_errCode_pu8 = (0u != l_errCode_u8) ? l_errCode_u8 : kLinDiagNrcConditionsNotCorrect;
+    }
+
+    diagStatsDidDone(l_entry_ps, DIAG_OPSTATUS_INITIAL, l_result_, *l_errCode_pu8, l_start_u32);
+
+    return l_result_;
+}
@@ -0,0 +1,235 @@
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+_Static_assert(LIN_DIAG_DTC_CAPACITY <= 32u, "fault memory index holds 32 slots");
+_Static_assert((3u + (4u * LIN_DIAG_DTC_CAPACITY)) <= LIN_DIAG_BUFFER_SIZE, "full fault memory does not fit a response");
+
+#define DIAG_DTC_NO_SLOT                   ((uint8)0xFFu)
+
+/* DTC number of every fault event: supply voltage below / above threshold */
+const uint32_t diagDtcNumbers_cau32[DIAG_DTC_EVENT_COUNT] =
+{
+    0x900316u,    /* DIAG_DTC_EVENT_UNDERVOLTAGE */
+    0x900317u,    /* DIAG_DTC_EVENT_OVERVOLTAGE */
+};
+
+/* Fault memory of a node: node_ps->dtcStore_s, persisted after its DID image */
+const diagNvmBlock_t diagDtcNvmBlock = { 0u, DIAG_NVM_IMAGE_SIZE, (uint16)sizeof(diagDtcStore_t) };
+
+/* node_ps->dtcEventSlot_au8: slot of every fault event, DIAG_DTC_NO_SLOT until it fails once.
+ * node_ps->dtcStatusIndex_au32: bit n of word b is set when slot n has status bit b.
+ * A status mask query ORs at most 8 words, then walks the matching slots only.
+ */
+
+/* Index of the lowest set bit, without a loop over the bits (de Bruijn sequence 0x077CB531) */
+static const uint8 diagDtcBitPos_cau8[32] =
+{
+    0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+    31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u
+};
+
+static uint8 diagDtcLowestBit(const uint32_t bits_u32)
+{
+    return diagDtcBitPos_cau8[(uint32_t)((bits_u32 & (0u - bits_u32)) * 0x077CB531u) >> 27];
+}
+
+/* Change the status of slot_u8, index kept in step */
+static void diagDtcSetStatus(diagNode_t *const node_ps, const uint8 slot_u8, const uint8 status_u8)
+{
+    const uint8 l_changed_u8 = (uint8)(node_ps->dtcStore_s.slots_as[slot_u8].status_u8 ^ status_u8);
+    uint8 l_bit_u8;
+
+    for (l_bit_u8 = 0u; l_bit_u8 < 8u; l_bit_u8++)
+    {
+        if (0u != (l_changed_u8 & (1u << l_bit_u8)))
+        {
+            node_ps->dtcStatusIndex_au32[l_bit_u8] ^= ((uint32_t)1u << slot_u8);
+        }
+    }
+
+    node_ps->dtcStore_s.slots_as[slot_u8].status_u8 = status_u8;
+}
+
+void diagDtcInit(diagNode_t *node_ps)
+{
+    uint8 l_valid_u8 = (node_ps->dtcStore_s.count_u8 <= LIN_DIAG_DTC_CAPACITY) ? 1u : 0u;
+    uint8 l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < DIAG_DTC_EVENT_COUNT; l_idx_u8++)
+    {
+        node_ps->dtcEventSlot_au8[l_idx_u8] = DIAG_DTC_NO_SLOT;
+    }
+    for (l_idx_u8 = 0u; l_idx_u8 < 8u; l_idx_u8++)
+    {
+        node_ps->dtcStatusIndex_au32[l_idx_u8] = 0u;
+    }
+
+    for (l_idx_u8 = 0u; (0u != l_valid_u8) && (l_idx_u8 < node_ps->dtcStore_s.count_u8); l_idx_u8++)
+    {
+        const uint8 l_event_u8 = node_ps->dtcStore_s.slots_as[l_idx_u8].event_u8;
+
+        if ((l_event_u8 >= DIAG_DTC_EVENT_COUNT) || (DIAG_DTC_NO_SLOT != node_ps->dtcEventSlot_au8[l_event_u8]))
+        {
+            l_valid_u8 = 0u;
+        }
+        else
+        {
+            node_ps->dtcEventSlot_au8[l_event_u8] = l_idx_u8;
+        }
+    }
+
+    /* A store from another configuration, or never written, is started afresh */
+    if (0u == l_valid_u8)
+    {
+        node_ps->dtcStore_s.count_u8 = 0u;
+        for (l_idx_u8 = 0u; l_idx_u8 < DIAG_DTC_EVENT_COUNT; l_idx_u8++)
+        {
+            node_ps->dtcEventSlot_au8[l_idx_u8] = DIAG_DTC_NO_SLOT;
+        }
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < node_ps->dtcStore_s.count_u8; l_idx_u8++)
+    {
+        /* New operation cycle: not failed in it yet */
+        const uint8 l_status_u8 = (uint8)(node_ps->dtcStore_s.slots_as[l_idx_u8].status_u8 & DIAG_DTC_STATUS_AVAILABILITY &
+                                          (uint8)~DIAG_DTC_STATUS_TFTOC);
+
+        node_ps->dtcStore_s.slots_as[l_idx_u8].status_u8 = 0u;
+        diagDtcSetStatus(node_ps, l_idx_u8, l_status_u8);
+    }
+}
+
+Std_ReturnType diagDtcReportEvent(diagNode_t *node_ps, uint8 l_event_u8, uint8 l_failed_u8, const uint8 *l_snapshot_pu8)
+{
+    uint8 l_slot_u8;
+    diagDtcSlot_t *l_slot_ps;
+    uint8 l_idx_u8;
+
+    if (l_event_u8 >= DIAG_DTC_EVENT_COUNT)
+    {
+        return E_NOT_OK;
+    }
+
+    l_slot_u8 = node_ps->dtcEventSlot_au8[l_event_u8];
+
+    if (0u == l_failed_u8)
+    {
+        /* Passed: only a stored, failed DTC changes */
+        if ((DIAG_DTC_NO_SLOT != l_slot_u8) &&
+            (0u != (node_ps->dtcStore_s.slots_as[l_slot_u8].status_u8 & DIAG_DTC_STATUS_TF)))
+        {
+            diagDtcSetStatus(node_ps, l_slot_u8,
+                             (uint8)(node_ps->dtcStore_s.slots_as[l_slot_u8].status_u8 & (uint8)~DIAG_DTC_STATUS_TF));
+            diagNvmMarkDirty(node_ps, DIAG_NVM_DTC_BLOCK);
+        }
+        return E_OK;
+    }
+
+    if (DIAG_DTC_NO_SLOT == l_slot_u8)
+    {
+        if (node_ps->dtcStore_s.count_u8 >= LIN_DIAG_DTC_CAPACITY)
+        {
+            return E_NOT_OK;
+        }
+
+        l_slot_u8 = node_ps->dtcStore_s.count_u8;
+        node_ps->dtcStore_s.count_u8++;
+        node_ps->dtcStore_s.slots_as[l_slot_u8].event_u8 = l_event_u8;
+        node_ps->dtcStore_s.slots_as[l_slot_u8].status_u8 = 0u;
+        node_ps->dtcStore_s.slots_as[l_slot_u8].occurrence_u8 = 0u;
+        node_ps->dtcEventSlot_au8[l_event_u8] = l_slot_u8;
+    }
+
+    l_slot_ps = &node_ps->dtcStore_s.slots_as[l_slot_u8];
+
+    /* Still failing: nothing new to store or persist */
+    if (0u != (l_slot_ps->status_u8 & DIAG_DTC_STATUS_TF))
+    {
+        return E_OK;
+    }
+
+    if (l_slot_ps->occurrence_u8 < 0xFFu)
+    {
+        l_slot_ps->occurrence_u8++;
+    }
+    for (l_idx_u8 = 0u; l_idx_u8 < LIN_DIAG_DTC_SNAPSHOT_SIZE; l_idx_u8++)
+    {
+        l_slot_ps->snapshot_au8[l_idx_u8] = (NULL != l_snapshot_pu8) ? l_snapshot_pu8[l_idx_u8] : 0u;
+    }
+
+    /* Confirmed at the first failure: no aging counter */
+    diagDtcSetStatus(node_ps, l_slot_u8, (uint8)(l_slot_ps->status_u8 | DIAG_DTC_STATUS_TF | DIAG_DTC_STATUS_TFTOC |
+                                                 DIAG_DTC_STATUS_PDTC | DIAG_DTC_STATUS_CDTC | DIAG_DTC_STATUS_TFSLC));
+    diagNvmMarkDirty(node_ps, DIAG_NVM_DTC_BLOCK);
+
+    return E_OK;
+}
+
+uint8 getDtcByStatusMask(diagNode_t *node_ps, uint8 l_statusMask_u8, uint8 *l_out_pu8)
+{
+    const uint8 l_mask_u8 = (uint8)(l_statusMask_u8 & DIAG_DTC_STATUS_AVAILABILITY);
+    uint32_t l_matches_u32 = 0u;
+    uint8 l_count_u8 = 0u;
+    uint8 l_bit_u8;
+
+    for (l_bit_u8 = 0u; l_bit_u8 < 8u; l_bit_u8++)
+    {
+        if (0u != (l_mask_u8 & (1u << l_bit_u8)))
+        {
+            l_matches_u32 |= node_ps->dtcStatusIndex_au32[l_bit_u8];
+        }
+    }
+
+    /* Lowest slot first: order of first failure */
+    while (0u != l_matches_u32)
+    {
+        const diagDtcSlot_t *const l_slot_ps = &node_ps->dtcStore_s.slots_as[diagDtcLowestBit(l_matches_u32)];
+
+        if (NULL != l_out_pu8)
+        {
+            const uint32_t l_dtc_u32 = diagDtcNumbers_cau32[l_slot_ps->event_u8];
+            uint8 *const l_record_pu8 = &l_out_pu8[4u * l_count_u8];
+
+            l_record_pu8[0] = (uint8)(l_dtc_u32 >> 16);
+            l_record_pu8[1] = (uint8)(l_dtc_u32 >> 8);
+            l_record_pu8[2] = (uint8)l_dtc_u32;
+            l_record_pu8[3] = l_slot_ps->status_u8;
+        }
+        l_count_u8++;
+        l_matches_u32 &= (l_matches_u32 - 1u);
+    }
+
+    return l_count_u8;
+}
+
+Std_ReturnType getDtcByNumber(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint32_t l_dtc_u32, uint8 *l_status_pu8, uint8 *l_occurrence_pu8,
+    const uint8 **l_snapshot_ppu8)
+{
+    uint8 l_event_u8;
+
+    for (l_event_u8 = 0u; l_event_u8 < DIAG_DTC_EVENT_COUNT; l_event_u8++)
+    {
+        if (l_dtc_u32 == diagDtcNumbers_cau32[l_event_u8])
+        {
+            const uint8 l_slot_u8 = node_ps->dtcEventSlot_au8[l_event_u8];
+
+            if (DIAG_DTC_NO_SLOT == l_slot_u8)
+            {
+                *l_status_pu8 = 0u;
+                *l_occurrence_pu8 = 0u;
+                *l_snapshot_ppu8 = NULL;
+            }
+            else
+            {
+                *l_status_pu8 = node_ps->dtcStore_s.slots_as[l_slot_u8].status_u8;
+                *l_occurrence_pu8 = node_ps->dtcStore_s.slots_as[l_slot_u8].occurrence_u8;
+                *l_snapshot_ppu8 = node_ps->dtcStore_s.slots_as[l_slot_u8].snapshot_au8;
+            }
+            return E_OK;
+        }
+    }
+
+    *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+    return E_NOT_OK;
+}
@@ -0,0 +1,173 @@
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+/* Composite DIDs defined by the tester: every node has its own, in node_ps->dynDids_as */
+const diagDynDid_t *diagFindDynamicDid(const diagNode_t *const node_ps, const uint16 did_u16)
+{
+    const uint16 l_idx_u16 = (uint16)(did_u16 - LIN_DIAG_DYN_DID_FIRST);
+
+    if ((l_idx_u16 >= LIN_DIAG_DYN_DID_COUNT) || (0u == node_ps->dynDids_as[l_idx_u16].count_u8))
+    {
+        return NULL;
+    }
+
+    return &node_ps->dynDids_as[l_idx_u16];
+}
+
+Std_ReturnType defineDynamicDid(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_dynDid_u16, const uint8 *l_parts_pu8, uint8 l_partCount_u8)
+{
+    const uint16 l_idx_u16 = (uint16)(l_dynDid_u16 - LIN_DIAG_DYN_DID_FIRST);
+    diagDynDid_t *l_dyn_ps;
+    uint16 l_size_u16;
+    uint16 l_span_u16;
+    uint8 l_part_u8;
+
+    if ((l_idx_u16 >= LIN_DIAG_DYN_DID_COUNT) || (0u == l_partCount_u8) ||
+        ((uint16)(node_ps->dynDids_as[l_idx_u16].count_u8 + l_partCount_u8) > LIN_DIAG_DYN_DID_PARTS))
+    {
+        *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    l_dyn_ps = &node_ps->dynDids_as[l_idx_u16];
+    l_size_u16 = l_dyn_ps->size_u8;
+    l_span_u16 = l_dyn_ps->span_u8;
+
+    /* First pass: validate every part against the DID table, nothing is stored yet */
+    for (l_part_u8 = 0u; l_part_u8 < l_partCount_u8; l_part_u8++)
+    {
+        const uint8 *const l_rec_pu8 = &l_parts_pu8[4u * l_part_u8];
+        const diagDidEntry_t *const l_src_ps =
+            diagFindDidEntry(node_ps->table_ps, (uint16)(((uint16)l_rec_pu8[0] << 8) | l_rec_pu8[1]));
+        const uint8 l_position_u8 = l_rec_pu8[2];
+        const uint8 l_partSize_u8 = l_rec_pu8[3];
+        uint16 l_need_u16;
+
+        if ((NULL == l_src_ps) || (NULL != l_src_ps->streamHandler_pf) || (NULL != l_src_ps->asyncHandler_pf) ||
+            (0u == l_position_u8) || (0u == l_partSize_u8) ||
+            ((uint16)(l_position_u8 - 1u + l_partSize_u8) > l_src_ps->size_u16))
+        {
+            *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+            return E_NOT_OK;
+        }
+
+        /* Data slices are copied alone, handler sources are written whole then trimmed */
+        l_need_u16 = (uint16)(l_size_u16 + ((NULL != l_src_ps->data_pu8) ? l_partSize_u8 : l_src_ps->size_u16));
+        if (l_need_u16 > l_span_u16)
+        {
+            l_span_u16 = l_need_u16;
+        }
+        l_size_u16 = (uint16)(l_size_u16 + l_partSize_u8);
+    }
+
+    /* The composite DID is read alone in pbLinDiagBuffer after SID + DID */
+    if (l_span_u16 > (LIN_DIAG_BUFFER_SIZE - 3u))
+    {
+        *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    for (l_part_u8 = 0u; l_part_u8 < l_partCount_u8; l_part_u8++)
+    {
+        const uint8 *const l_rec_pu8 = &l_parts_pu8[4u * l_part_u8];
+        diagDynPart_t *const l_dst_ps = &l_dyn_ps->parts_as[l_dyn_ps->count_u8 + l_part_u8];
+
+        l_dst_ps->srcDid_u16 = (uint16)(((uint16)l_rec_pu8[0] << 8) | l_rec_pu8[1]);
+        l_dst_ps->position_u8 = (uint8)(l_rec_pu8[2] - 1u);
+        l_dst_ps->size_u8 = l_rec_pu8[3];
+    }
+    l_dyn_ps->count_u8 = (uint8)(l_dyn_ps->count_u8 + l_partCount_u8);
+    l_dyn_ps->size_u8 = (uint8)l_size_u16;
+    l_dyn_ps->span_u8 = (uint8)l_span_u16;
+
+    return E_OK;
+}
+
+Std_ReturnType clearDynamicDid(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_dynDid_u16)
+{
+    const uint16 l_idx_u16 = (uint16)(l_dynDid_u16 - LIN_DIAG_DYN_DID_FIRST);
+    uint16 l_dyn_u16;
+
+    if (LIN_DIAG_DYN_DID_ALL == l_dynDid_u16)
+    {
+        for (l_dyn_u16 = 0u; l_dyn_u16 < LIN_DIAG_DYN_DID_COUNT; l_dyn_u16++)
+        {
+            node_ps->dynDids_as[l_dyn_u16].count_u8 = 0u;
+            node_ps->dynDids_as[l_dyn_u16].size_u8 = 0u;
+            node_ps->dynDids_as[l_dyn_u16].span_u8 = 0u;
+        }
+        return E_OK;
+    }
+
+    if (l_idx_u16 >= LIN_DIAG_DYN_DID_COUNT)
+    {
+        *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    node_ps->dynDids_as[l_idx_u16].count_u8 = 0u;
+    node_ps->dynDids_as[l_idx_u16].size_u8 = 0u;
+    node_ps->dynDids_as[l_idx_u16].span_u8 = 0u;
+    return E_OK;
+}
+
+Std_ReturnType diagReadDynamicDid(diagNode_t *const node_ps, const diagDynDid_t *const dyn_ps, uint8*const  output_pu8,
+    uint8*const  size_pu8, uint8* const errCode_pu8)
+{
+    uint8 l_written_u8 = 0u;
+    uint8 l_part_u8;
+    uint8 l_idx_u8;
+
+    for (l_part_u8 = 0u; l_part_u8 < dyn_ps->count_u8; l_part_u8++)
+    {
+        const diagDynPart_t *const l_part_ps = &dyn_ps->parts_as[l_part_u8];
+        const diagDidEntry_t *const l_src_ps = diagFindDidEntry(node_ps->table_ps, l_part_ps->srcDid_u16);
+        uint8 *const l_dst_pu8 = &output_pu8[l_written_u8];
+
+        if (NULL != l_src_ps->data_pu8)
+        {
+            /* Data DID: the slice goes straight from the source to the response */
+            const uint16 l_offset_u16 = (uint16)(l_part_ps->srcDid_u16 - l_src_ps->didFirst_u16);
+            const uint8 *const l_from_pu8 = &diagDidData(node_ps, l_src_ps, l_offset_u16)[l_part_ps->position_u8];
+
+            if ((NULL != l_src_ps->dataHook_pf) && (E_OK != l_src_ps->dataHook_pf(errCode_pu8)))
+            {
+                return E_NOT_OK;
+            }
+
+            for (l_idx_u8 = 0u; l_idx_u8 < l_part_ps->size_u8; l_idx_u8++)
+            {
+                l_dst_pu8[l_idx_u8] = l_from_pu8[l_idx_u8];
+            }
+        }
+        else
+        {
+            /* Handler DID: served in place (cache included), then its slice is moved down */
+            uint8 l_srcSize_u8 = 0u;
+            Std_ReturnType l_didSupported_ = E_OK;
+
+            if (E_OK != getHandlersForReadDataById(node_ps, errCode_pu8, l_part_ps->srcDid_u16, &l_srcSize_u8, &l_didSupported_,
+                                                   l_dst_pu8, (uint8)(dyn_ps->span_u8 - l_written_u8)))
+            {
+                return E_NOT_OK;
+            }
+
+            if ((uint16)(l_part_ps->position_u8 + l_part_ps->size_u8) > l_srcSize_u8)
+            {
+                *errCode_pu8 = kLinDiagNrcConditionsNotCorrect;
+                return E_NOT_OK;
+            }
+
+            for (l_idx_u8 = 0u; l_idx_u8 < l_part_ps->size_u8; l_idx_u8++)
+            {
+                l_dst_pu8[l_idx_u8] = l_dst_pu8[l_part_ps->position_u8 + l_idx_u8];
+            }
+        }
+
+        l_written_u8 = (uint8)(l_written_u8 + l_part_ps->size_u8);
+    }
+
+    *size_pu8 = l_written_u8;
+    return E_OK;
+}
@@ -0,0 +1,43 @@
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+/* Regions readable with ReadMemoryByAddress. Development dumps of another module's RAM
+ * go here too, e.g. { (const uint8 *)&VoltMon_Ctx, sizeof(VoltMon_Ctx) } when VoltMon is linked.
+ */
+const diagMemRegion_t diagMemRegions[] =
+{
+    { diagVin_au8,             sizeof(diagVin_au8) },
+    { diagCalibrationDump_au8, sizeof(diagCalibrationDump_au8) },
+};
+
+const uint8 diagMemRegionCount_u8 = (uint8)(sizeof(diagMemRegions) / sizeof(diagMemRegions[0]));
+
+Std_ReturnType getMemoryForReadMemoryByAddress(uint8 *l_errCode_pu8, uintptr_t l_address_uptr, uint16 l_size_u16,
+    const uint8 **l_data_ppu8)
+{
+    uint8 l_region_u8;
+
+    if ((0u == l_size_u16) || (l_size_u16 > LIN_DIAG_MEM_READ_MAX))
+    {
+        *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    for (l_region_u8 = 0u; l_region_u8 < diagMemRegionCount_u8; l_region_u8++)
+    {
+        const diagMemRegion_t *const l_region_ps = &diagMemRegions[l_region_u8];
+        const uintptr_t l_start_uptr = (uintptr_t)l_region_ps->start_pu8;
+
+        /* Offsets only: address + size may wrap around, the region end may not */
+        if ((l_address_uptr >= l_start_uptr) && (l_size_u16 <= l_region_ps->size_u32) &&
+            ((l_address_uptr - l_start_uptr) <= (uintptr_t)(l_region_ps->size_u32 - l_size_u16)))
+        {
+            *l_data_ppu8 = &l_region_ps->start_pu8[l_address_uptr - l_start_uptr];
+            return E_OK;
+        }
+    }
+
+    *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+    return E_NOT_OK;
+}
@@ -0,0 +1,98 @@
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+/* Source value of element offset_u16, widened without loss */
+static int64_t diagSignalSource(const diagSignal_t *const signal_ps, const uint16 offset_u16)
+{
+    switch (signal_ps->srcType_u8)
+    {
+    case DIAG_SIGNAL_SRC_U8:
+        return (int64_t)((const uint8 *)signal_ps->src_pv)[offset_u16];
+    case DIAG_SIGNAL_SRC_U16:
+        return (int64_t)((const uint16 *)signal_ps->src_pv)[offset_u16];
+    case DIAG_SIGNAL_SRC_U32:
+        return (int64_t)((const uint32_t *)signal_ps->src_pv)[offset_u16];
+    case DIAG_SIGNAL_SRC_S8:
+        return (int64_t)((const int8_t *)signal_ps->src_pv)[offset_u16];
+    case DIAG_SIGNAL_SRC_S16:
+        return (int64_t)((const int16_t *)signal_ps->src_pv)[offset_u16];
+    default:
+        return (int64_t)((const int32_t *)signal_ps->src_pv)[offset_u16];
+    }
+}
+
+/* Raw value of phys_s64, saturated to the raw range. Integer arithmetic only: the
+ * generator bounds |phys * mul + add| below 2^63.
+ */
+static uint32_t diagSignalScale(const diagSignal_t *const signal_ps, const int64_t phys_s64)
+{
+    const int64_t l_acc_s64 = (phys_s64 * (int64_t)signal_ps->mul_s32) + signal_ps->add_s64;
+    int64_t l_raw_s64;
+    int64_t l_min_s64;
+    int64_t l_max_s64;
+
+    /* Floor division by 2^shift, no right shift of a negative value */
+    if (l_acc_s64 >= 0)
+    {
+        l_raw_s64 = (int64_t)((uint64_t)l_acc_s64 >> signal_ps->shift_u8);
+    }
+    else
+    {
+        l_raw_s64 = -(int64_t)(((uint64_t)(-(l_acc_s64 + 1)) >> signal_ps->shift_u8)) - 1;
+    }
+
+    if (0u != (signal_ps->flags_u8 & DIAG_SIGNAL_SIGNED))
+    {
+        l_max_s64 = (int64_t)(((uint64_t)1u << (signal_ps->bits_u8 - 1u)) - 1u);
+        l_min_s64 = -l_max_s64 - 1;
+    }
+    else
+    {
+        l_max_s64 = (int64_t)(((uint64_t)1u << signal_ps->bits_u8) - 1u);
+        l_min_s64 = 0;
+    }
+
+    if (l_raw_s64 > l_max_s64)
+    {
+        l_raw_s64 = l_max_s64;
+    }
+    else if (l_raw_s64 < l_min_s64)
+    {
+        l_raw_s64 = l_min_s64;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    /* Two's complement, cut to bits_u8 */
+    return (uint32_t)((uint64_t)l_raw_s64 & (((uint64_t)1u << signal_ps->bits_u8) - 1u));
+}
+
+Std_ReturnType diagEncodeSignal(const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8* const errCode_pu8)
+{
+    const diagSignal_t *const l_signal_ps = entry_ps->signal_ps;
+    uint32_t l_raw_u32;
+    uint16 l_idx_u16;
+
+    if ((NULL != entry_ps->dataHook_pf) && (E_OK != entry_ps->dataHook_pf(errCode_pu8)))
+    {
+        return E_NOT_OK;
+    }
+
+    l_raw_u32 = diagSignalScale(l_signal_ps, diagSignalSource(l_signal_ps, offset_u16));
+
+    /* size_u16 is the byte length of bits_u8 (checked by the generator), unused high bits are 0 */
+    for (l_idx_u16 = 0u; l_idx_u16 < entry_ps->size_u16; l_idx_u16++)
+    {
+        const uint16 l_pos_u16 = (0u != (l_signal_ps->flags_u8 & DIAG_SIGNAL_LITTLE_ENDIAN)) ?
+                                 l_idx_u16 : (uint16)(entry_ps->size_u16 - 1u - l_idx_u16);
+
+        output_pu8[l_pos_u16] = (uint8)(l_raw_u32 & 0xFFu);
+        l_raw_u32 >>= 8;
+    }
+
+    return E_OK;
+}
@@ -0,0 +1,66 @@
+/*
+ * GENERATED FILE - DO NOT EDIT.
+ * Source : diagnostic_did.csv
+ * Tool   : tools/didCfgGen.py
+ */
+
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+const uint16 diagDidKeys_cau16[DIAG_DID_TABLE_SIZE] =
+{
+    DID_F190_FIRST, /* VIN */
+    DID_F201_FIRST, /* PDID_01_OVERVOLT_FLAG */
+    DID_F308_FIRST, /* IS_OVERVOLT_FLAG */
+    DID_F400_F40F_FIRST, /* CHANNEL_STATUS */
+    DID_F410_FIRST, /* EEPROM_CHECKSUM */
+    DID_F420_FIRST, /* SUPPLY_VOLTAGE */
+    DID_FD00_FIRST, /* CALIBRATION_DUMP */
+    DID_FDF0_FIRST, /* DIAG_STATISTICS */
+};
+
+_Static_assert(sizeof(diagVin_au8) >= (1u * DID_F190_SIZE), "VIN: data source smaller than the DID");
+_Static_assert(sizeof(diagOverVoltageFlag_u8) >= (1u * DID_F201_SIZE), "PDID_01_OVERVOLT_FLAG: data source smaller than the DID");
+_Static_assert(sizeof(diagOverVoltageFlag_u8) >= (1u * DID_F308_SIZE), "IS_OVERVOLT_FLAG: data source smaller than the DID");
+_Static_assert(sizeof(diagSupplyVoltage_mV_u16) == (1u * sizeof(uint16)), "SUPPLY_VOLTAGE: source does not match the scale source type");
+_Static_assert(sizeof(diagCalibrationDump_au8) >= (1u * DID_FD00_SIZE), "CALIBRATION_DUMP: data source smaller than the DID");
+
+/* SUPPLY_VOLTAGE scale u16:100:0:be:8 */
+static const diagSignal_t diagSignal_F420 = { (const void *)&diagSupplyVoltage_mV_u16, DIAG_SIGNAL_SRC_U16, 0u, 8u, 32u, 42949673, 2147483648LL };
+
+/* CHANNEL_STATUS response cache, slots 0..15 of the node */
+static const diagDidCache_t diagCache_F400 = { 0u, 0u, LIN_DIAG_MS_TO_TICKS(100u), NULL };
+
+/* VIN write (nvm) */
+static const diagDidWrite_t diagWrite_F190 = { DIAG_DID_F190_RAM, 0u };
+
+const diagNvmBlock_t diagNvmBlocks[DIAG_NVM_BLOCK_COUNT + 1u] =
+{
+    /* VIN */
+    { DIAG_DID_F190_RAM, DIAG_NVM_F190_OFFSET, (uint16)(1u * DID_F190_SIZE) },
+    { 0u, DIAG_NVM_IMAGE_SIZE, 0u },
+};
+
+const diagDidEntry_t diagDidTable[DIAG_DID_TABLE_SIZE] =
+{
+    /* VIN */
+    { DID_F190_FIRST, DID_F190_LAST, DID_F190_SIZE, NULL, NULL, (const uint8 *)&diagVin_au8, NULL, NULL, NULL, NULL, &diagWrite_F190, NULL },
+    /* PDID_01_OVERVOLT_FLAG */
+    { DID_F201_FIRST, DID_F201_LAST, DID_F201_SIZE, NULL, NULL, (const uint8 *)&diagOverVoltageFlag_u8, NULL, NULL, NULL, NULL, NULL, NULL },
+    /* IS_OVERVOLT_FLAG */
+    { DID_F308_FIRST, DID_F308_LAST, DID_F308_SIZE, NULL, NULL, (const uint8 *)&diagOverVoltageFlag_u8, NULL, NULL, NULL, NULL, NULL, NULL },
+    /* CHANNEL_STATUS */
+    { DID_F400_F40F_FIRST, DID_F400_F40F_LAST, DID_F400_F40F_SIZE, NULL, &RdbiChannelStatusRange_, NULL, NULL, NULL, NULL, &diagCache_F400, NULL, NULL },
+    /* EEPROM_CHECKSUM */
+    { DID_F410_FIRST, DID_F410_LAST, DID_F410_SIZE, NULL, NULL, NULL, NULL, NULL, &RdbiEepromChecksumAsync_, NULL, NULL, NULL },
+    /* SUPPLY_VOLTAGE */
+    { DID_F420_FIRST, DID_F420_LAST, DID_F420_SIZE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &diagSignal_F420 },
+    /* CALIBRATION_DUMP */
+    { DID_FD00_FIRST, DID_FD00_LAST, DID_FD00_SIZE, NULL, NULL, (const uint8 *)&diagCalibrationDump_au8, NULL, NULL, NULL, NULL, NULL, NULL },
+    /* DIAG_STATISTICS */
+    { DID_FDF0_FIRST, DID_FDF0_LAST, DID_FDF0_SIZE, NULL, NULL, NULL, NULL, &RdbiDiagStatistics_, NULL, NULL, NULL, NULL },
+};
+
+const uint16 diagDidTableSize_u16 = DIAG_DID_TABLE_SIZE;
+
+const diagDidTable_t diagDidTableCfg = { diagDidKeys_cau16, diagDidTable, DIAG_DID_TABLE_SIZE };
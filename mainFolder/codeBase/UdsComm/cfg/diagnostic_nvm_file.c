@@ -0,0 +1,75 @@
+#include <stdio.h>
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+
+/* Host stand-in of the NVM: the image lives in LIN_DIAG_NVM_FILE, one file write per batch */
+
+static FILE *diagNvmFile_ps = NULL;
+
+Std_ReturnType diagNvmBackendRead(const uint16 offset_u16, uint8*const  data_pu8, const uint16 length_u16)
+{
+    FILE *const l_file_ps = fopen(LIN_DIAG_NVM_FILE, "rb");
+    Std_ReturnType l_result_ = E_NOT_OK;
+
+    if (NULL == l_file_ps)
+    {
+        return E_NOT_OK;
+    }
+
+    /* Size checked first: a block missing from an older, shorter image leaves data_pu8 untouched */
+    if ((0 == fseek(l_file_ps, 0L, SEEK_END)) && (ftell(l_file_ps) >= ((long)offset_u16 + (long)length_u16)) &&
+        (0 == fseek(l_file_ps, (long)offset_u16, SEEK_SET)) &&
+        (length_u16 == fread(data_pu8, 1u, length_u16, l_file_ps)))
+    {
+        l_result_ = E_OK;
+    }
+
+    (void)fclose(l_file_ps);
+    return l_result_;
+}
+
+Std_ReturnType diagNvmBackendBegin(void)
+{
+    diagNvmFile_ps = fopen(LIN_DIAG_NVM_FILE, "r+b");
+
+    if (NULL == diagNvmFile_ps)
+    {
+        /* First commit: no image yet */
+        diagNvmFile_ps = fopen(LIN_DIAG_NVM_FILE, "w+b");
+    }
+
+    return (NULL != diagNvmFile_ps) ? E_OK : E_NOT_OK;
+}
+
+Std_ReturnType diagNvmBackendWrite(const uint16 offset_u16, const uint8 *const data_pu8, const uint16 length_u16)
+{
+    if ((NULL == diagNvmFile_ps) || (0 != fseek(diagNvmFile_ps, (long)offset_u16, SEEK_SET)) ||
+        (length_u16 != fwrite(data_pu8, 1u, length_u16, diagNvmFile_ps)))
+    {
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType diagNvmBackendEnd(void)
+{
+    Std_ReturnType l_result_ = E_OK;
+
+    if (NULL == diagNvmFile_ps)
+    {
+        return E_NOT_OK;
+    }
+
+    if (0 != fflush(diagNvmFile_ps))
+    {
+        l_result_ = E_NOT_OK;
+    }
+    if (0 != fclose(diagNvmFile_ps))
+    {
+        l_result_ = E_NOT_OK;
+    }
+    diagNvmFile_ps = NULL;
+
+    return l_result_;
+}
@@ -0,0 +1,18 @@
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#include "diagnostic_cfg.h"
+
+/* Host stand-in of the statistics clock: the monotonic clock of the OS. On target, a free-running
+ * timer counting microseconds (or a cycle counter scaled down) goes here.
+ */
+uint32_t diagStatsNow(void)
+{
+    struct timespec l_now_s;
+
+    if (0 != clock_gettime(CLOCK_MONOTONIC, &l_now_s))
+    {
+        return 0u;
+    }
+
+    return (uint32_t)(((uint32_t)l_now_s.tv_sec * 1000000u) + ((uint32_t)l_now_s.tv_nsec / 1000u));
+}
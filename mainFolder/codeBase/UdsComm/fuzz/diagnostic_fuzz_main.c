@@ -0,0 +1,125 @@
+/* Driver of the fuzz targets for toolchains without libFuzzer (built with sanitizers by make fuzz-replay).
+ *
+ *   ./fuzz_replay.out [-runs=N] file...
+ *
+ * Replays every file once, then runs N inputs mutated from them (byte flips,
+ * random bytes, length changes) with a fixed seed, so a failure reproduces.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#define LIN_DIAG_FUZZ_MAX_INPUT    64u
+#define LIN_DIAG_FUZZ_MAX_SEEDS    256u
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+typedef struct
+{
+    uint8_t data_au8[LIN_DIAG_FUZZ_MAX_INPUT];
+    size_t  size;
+} LinDiagFuzzInput_t;
+
+static LinDiagFuzzInput_t LinDiagFuzz_Seeds_as[LIN_DIAG_FUZZ_MAX_SEEDS];
+static size_t LinDiagFuzz_SeedCount = 0u;
+static uint32_t LinDiagFuzz_Rng_u32 = 0x2545F491u;
+
+static uint32_t LinDiagFuzzRand(void)
+{
+    /* xorshift32 */
+    LinDiagFuzz_Rng_u32 ^= LinDiagFuzz_Rng_u32 << 13;
+    LinDiagFuzz_Rng_u32 ^= LinDiagFuzz_Rng_u32 >> 17;
+    LinDiagFuzz_Rng_u32 ^= LinDiagFuzz_Rng_u32 << 5;
+    return LinDiagFuzz_Rng_u32;
+}
+
+static void LinDiagFuzzMutate(LinDiagFuzzInput_t *const in_ps)
+{
+    const uint32_t l_rand_u32 = LinDiagFuzzRand();
+    const size_t l_pos = (in_ps->size > 0u) ? ((l_rand_u32 >> 8) % in_ps->size) : 0u;
+
+    switch (l_rand_u32 & 0x7u) {
+    case 0u:
+        in_ps->data_au8[l_pos] ^= (uint8_t)(1u << ((l_rand_u32 >> 4) & 0x7u));
+        break;
+    case 1u:
+    case 2u:
+        in_ps->data_au8[l_pos] = (uint8_t)(l_rand_u32 >> 24);
+        break;
+    case 3u:
+        /* Length field: around the real length or anywhere */
+        in_ps->data_au8[0] = (0u != (l_rand_u32 & 0x8u)) ? (uint8_t)(l_rand_u32 >> 16) : 0u;
+        in_ps->data_au8[1] = (uint8_t)(l_rand_u32 >> 24);
+        break;
+    case 4u:
+        if (in_ps->size > 2u) {
+            in_ps->size--;
+        }
+        break;
+    default:
+        if (in_ps->size < LIN_DIAG_FUZZ_MAX_INPUT) {
+            in_ps->data_au8[in_ps->size] = (uint8_t)(l_rand_u32 >> 24);
+            in_ps->size++;
+        }
+        break;
+    }
+}
+
+static int LinDiagFuzzLoad(const char *const path_pc, LinDiagFuzzInput_t *const in_ps)
+{
+    FILE *const l_file_ps = fopen(path_pc, "rb");
+
+    if (NULL == l_file_ps) {
+        fprintf(stderr, "cannot open %s\n", path_pc);
+        return 1;
+    }
+    in_ps->size = fread(in_ps->data_au8, 1u, sizeof(in_ps->data_au8), l_file_ps);
+    (void)fclose(l_file_ps);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long l_runs = 0u;
+    unsigned long l_run;
+    unsigned long l_replayed = 0u;
+    LinDiagFuzzInput_t l_in_s;
+    clock_t l_start_s;
+    double l_seconds;
+    int l_arg;
+
+    for (l_arg = 1; l_arg < argc; l_arg++) {
+        if (0 == strncmp(argv[l_arg], "-runs=", 6u)) {
+            l_runs = strtoul(&argv[l_arg][6], NULL, 0);
+        } else if (0 != LinDiagFuzzLoad(argv[l_arg], &l_in_s)) {
+            return 1;
+        } else {
+            (void)LLVMFuzzerTestOneInput(l_in_s.data_au8, l_in_s.size);
+            l_replayed++;
+            if (LinDiagFuzz_SeedCount < LIN_DIAG_FUZZ_MAX_SEEDS) {
+                LinDiagFuzz_Seeds_as[LinDiagFuzz_SeedCount] = l_in_s;
+                LinDiagFuzz_SeedCount++;
+            }
+        }
+    }
+    printf("replayed %lu inputs\n", l_replayed);
+
+    if ((0u == l_runs) || (0u == LinDiagFuzz_SeedCount)) {
+        return 0;
+    }
+
+    l_start_s = clock();
+    for (l_run = 0u; l_run < l_runs; l_run++) {
+        l_in_s = LinDiagFuzz_Seeds_as[LinDiagFuzzRand() % LinDiagFuzz_SeedCount];
+        LinDiagFuzzMutate(&l_in_s);
+        LinDiagFuzzMutate(&l_in_s);
+        (void)LLVMFuzzerTestOneInput(l_in_s.data_au8, l_in_s.size);
+    }
+    l_seconds = (double)(clock() - l_start_s) / (double)CLOCKS_PER_SEC;
+
+    printf("%lu mutated inputs in %.2f s (%.0f exec/s)\n", l_runs, l_seconds,
+           (l_seconds > 0.0) ? ((double)l_runs / l_seconds) : 0.0);
+    return 0;
+}
@@ -0,0 +1,70 @@
+/* libFuzzer target: ReadDataById through ApplLinDiagReadDataById and the real DID handlers.
+ *
+ *   make fuzz && ./fuzz_rdbi.out fuzz/corpus                    (clang, libFuzzer)
+ *   make fuzz-replay && ./fuzz_replay.out -runs=N <corpus files>  (gcc, no libFuzzer)
+ *
+ * Input: g_linDiagDataLength on two bytes (big endian), then the bytes of
+ * pbLinDiagBuffer. The length is fuzzed apart from the data so that lengths
+ * beyond the buffer or beyond the given bytes are reached too.
+ * Each input runs in the same process: only the state a read can change is reset.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include "diagnostic.h"
+
+/* LinDiagMainFunction calls per input: an asynchronous DID finishes well within */
+#define LIN_DIAG_FUZZ_POLLS        8u
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/* diagDefaultNode started by the first input, reads never change its table or writable DIDs */
+static uint8_t LinDiagFuzz_NodeReady_u8 = 0u;
+
+/* No clock: the statistics see every handler as instantaneous, runs stay reproducible */
+uint32_t diagStatsNow(void)
+{
+    return 0u;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    uint8_t l_frame_au8[LIN_TP_FRAME_SIZE];
+    size_t l_idx;
+    uint8_t l_poll_u8;
+
+    if (size < 2u) {
+        return 0;
+    }
+
+    if (0u == LinDiagFuzz_NodeReady_u8) {
+        diagNodeInit(&diagDefaultNode, 0u);
+        LinDiagFuzz_NodeReady_u8 = 1u;
+    }
+
+    /* Cheap reset: channel (pending DID, transport), response caches, statistics */
+    LinDiagChannelInit(&LinDiag_DefaultChannel, pbLinDiagBuffer, pbLinDiagBuffer, LIN_DIAG_NODE_NAD, &diagDefaultNode);
+    diagDidCacheClear(&diagDefaultNode);
+    diagStatsClear();
+
+    g_linDiagDataLength = (uint16_t)(((uint16_t)data[0] << 8) | data[1]);
+    for (l_idx = 0u; l_idx < LIN_DIAG_BUFFER_SIZE; l_idx++) {
+        pbLinDiagBuffer[l_idx] = ((l_idx + 2u) < size) ? data[l_idx + 2u] : 0u;
+    }
+
+    ApplLinDiagReadDataById();
+    for (l_poll_u8 = 0u; (l_poll_u8 < LIN_DIAG_FUZZ_POLLS) && (0u != LinDiag_DefaultChannel.pending_u8); l_poll_u8++) {
+        ApplLinDiagMainFunction();
+    }
+
+    /* The response may only describe what fits: the head in pbLinDiagBuffer, the tail within the transport limit */
+    if ((LinDiag_DefaultChannel.respLen_u16 > LIN_DIAG_BUFFER_SIZE) ||
+        (LinDiag_DefaultChannel.respTailLen_u16 > LIN_TP_MAX_LENGTH)) {
+        __builtin_trap();
+    }
+
+    /* Frame the whole response: reads the streamed tail in place */
+    while (E_OK == LinDiagGetTxFrame(&LinDiag_DefaultChannel, l_frame_au8)) {
+    }
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include "diagnostic_capture.h"
+#include "diagnostic_capture_priv.h"
+#include <stddef.h>
+
+/* Ring being recorded, NULL when the capture is off */
+static LinDiagCaptureHdr_t *LinDiagCapture_ps = NULL;
+static uint8_t *LinDiagCaptureArea_pu8 = NULL;
+
+static void LinDiagCaptureCopy(uint8_t *const dst_pu8, const uint8_t *const src_pu8, const uint32_t len_u32)
+{
+    uint32_t l_idx_u32;
+
+    for (l_idx_u32 = 0u; l_idx_u32 < len_u32; l_idx_u32++)
+    {
+        dst_pu8[l_idx_u32] = src_pu8[l_idx_u32];
+    }
+}
+
+uint32_t LinDiagCaptureRecSpan(const LinDiagCaptureHdr_t *const hdr_ps, const uint8_t *const area_pu8, const uint32_t pos_u32)
+{
+    const uint32_t l_end_cu32 = hdr_ps->size_u32 - pos_u32;
+    LinDiagCaptureRec_t l_rec_s;
+
+    /* Too short for a record header: implicit padding */
+    if (l_end_cu32 < kLinDiagCaptureRecSize)
+    {
+        return l_end_cu32;
+    }
+
+    LinDiagCaptureCopy((uint8_t *)&l_rec_s, &area_pu8[pos_u32], kLinDiagCaptureRecSize);
+    return (LIN_DIAG_CAPTURE_PAD == l_rec_s.kind_u8) ? l_end_cu32 : (kLinDiagCaptureRecSize + l_rec_s.len_u16);
+}
+
+/* Drop the oldest records until span_u32 bytes are free after the head */
+static void LinDiagCaptureMakeRoom(LinDiagCaptureHdr_t *const hdr_ps, const uint32_t span_u32)
+{
+    while ((hdr_ps->size_u32 - hdr_ps->used_u32) < span_u32)
+    {
+        const uint32_t l_span_cu32 = LinDiagCaptureRecSpan(hdr_ps, LinDiagCaptureArea_pu8, hdr_ps->tail_u32);
+
+        hdr_ps->tail_u32 = (hdr_ps->tail_u32 + l_span_cu32) % hdr_ps->size_u32;
+        hdr_ps->used_u32 -= l_span_cu32;
+    }
+}
+
+/* Append one record. The record bytes are written before the header moves on, so a
+ * ring left behind by a crash ends with the last complete record.
+ */
+static void LinDiagCaptureAppend(const uint8_t kind_u8, const uint8_t nad_u8, const uint8_t *const head_pu8,
+    const uint16_t headLen_u16, const uint8_t *const tail_pu8, const uint16_t tailLen_u16)
+{
+    LinDiagCaptureHdr_t *const l_hdr_ps = LinDiagCapture_ps;
+    const uint32_t l_len_cu32 = (uint32_t)headLen_u16 + tailLen_u16;
+    const uint32_t l_span_cu32 = kLinDiagCaptureRecSize + l_len_cu32;
+    LinDiagCaptureRec_t l_rec_s;
+    uint8_t *l_dst_pu8;
+
+    if ((l_span_cu32 > l_hdr_ps->size_u32) || (l_len_cu32 > 0xFFFFu))
+    {
+        l_hdr_ps->lost_u32++;
+        return;
+    }
+
+    /* Not enough room before the end: pad it, the record starts at 0 */
+    if ((l_hdr_ps->size_u32 - l_hdr_ps->head_u32) < l_span_cu32)
+    {
+        const uint32_t l_pad_cu32 = l_hdr_ps->size_u32 - l_hdr_ps->head_u32;
+
+        LinDiagCaptureMakeRoom(l_hdr_ps, l_pad_cu32);
+        if (l_pad_cu32 >= kLinDiagCaptureRecSize)
+        {
+            l_rec_s.len_u16 = 0u;
+            l_rec_s.kind_u8 = LIN_DIAG_CAPTURE_PAD;
+            l_rec_s.nad_u8 = 0u;
+            l_rec_s.timeUs_u32 = 0u;
+            LinDiagCaptureCopy(&LinDiagCaptureArea_pu8[l_hdr_ps->head_u32], (const uint8_t *)&l_rec_s,
+                               kLinDiagCaptureRecSize);
+        }
+        l_hdr_ps->used_u32 += l_pad_cu32;
+        l_hdr_ps->head_u32 = 0u;
+    }
+
+    LinDiagCaptureMakeRoom(l_hdr_ps, l_span_cu32);
+
+    l_rec_s.len_u16 = (uint16_t)l_len_cu32;
+    l_rec_s.kind_u8 = kind_u8;
+    l_rec_s.nad_u8 = nad_u8;
+    l_rec_s.timeUs_u32 = diagStatsNow();
+    l_dst_pu8 = &LinDiagCaptureArea_pu8[l_hdr_ps->head_u32];
+    LinDiagCaptureCopy(l_dst_pu8, (const uint8_t *)&l_rec_s, kLinDiagCaptureRecSize);
+    LinDiagCaptureCopy(&l_dst_pu8[kLinDiagCaptureRecSize], head_pu8, headLen_u16);
+    if (NULL != tail_pu8)
+    {
+        LinDiagCaptureCopy(&l_dst_pu8[kLinDiagCaptureRecSize + headLen_u16], tail_pu8, tailLen_u16);
+    }
+
+    l_hdr_ps->used_u32 += l_span_cu32;
+    l_hdr_ps->head_u32 = (l_hdr_ps->head_u32 + l_span_cu32) % l_hdr_ps->size_u32;
+}
+
+void LinDiagCaptureStart(uint8_t *const mem_pu8, const uint32_t size_u32)
+{
+    LinDiagCaptureHdr_t *l_hdr_ps;
+
+    LinDiagCapture_ps = NULL;
+    LinDiagCaptureArea_pu8 = NULL;
+
+    if ((NULL == mem_pu8) || (size_u32 <= (kLinDiagCaptureHdrSize + kLinDiagCaptureRecSize)))
+    {
+        return;
+    }
+
+    l_hdr_ps = (LinDiagCaptureHdr_t *)(void *)mem_pu8;
+
+    /* Anything but a consistent ring of this size is formatted */
+    if ((LIN_DIAG_CAPTURE_MAGIC != l_hdr_ps->magic_u32) || ((size_u32 - kLinDiagCaptureHdrSize) != l_hdr_ps->size_u32) ||
+        (l_hdr_ps->head_u32 >= l_hdr_ps->size_u32) || (l_hdr_ps->tail_u32 >= l_hdr_ps->size_u32) ||
+        (l_hdr_ps->used_u32 > l_hdr_ps->size_u32) ||
+        (((l_hdr_ps->tail_u32 + l_hdr_ps->used_u32) % l_hdr_ps->size_u32) != l_hdr_ps->head_u32))
+    {
+        l_hdr_ps->magic_u32 = LIN_DIAG_CAPTURE_MAGIC;
+        l_hdr_ps->size_u32 = size_u32 - kLinDiagCaptureHdrSize;
+        l_hdr_ps->head_u32 = 0u;
+        l_hdr_ps->tail_u32 = 0u;
+        l_hdr_ps->used_u32 = 0u;
+        l_hdr_ps->lost_u32 = 0u;
+    }
+
+    LinDiagCaptureArea_pu8 = &mem_pu8[kLinDiagCaptureHdrSize];
+    LinDiagCapture_ps = l_hdr_ps;
+}
+
+void LinDiagCaptureRequest(const LinDiag_Channel_t *const ch_ps)
+{
+    if (NULL != LinDiagCapture_ps)
+    {
+        /* A legacy caller may give any length: the request buffer bounds it */
+        const uint16_t l_len_cu16 = (ch_ps->reqLen_u16 < LIN_DIAG_BUFFER_SIZE) ? ch_ps->reqLen_u16 : LIN_DIAG_BUFFER_SIZE;
+
+        LinDiagCaptureAppend(LIN_DIAG_CAPTURE_REQUEST, ch_ps->reqNad_u8, ch_ps->req_pu8, l_len_cu16, NULL, 0u);
+    }
+}
+
+void LinDiagCaptureResponse(const LinDiag_Channel_t *const ch_ps, const uint8_t *const head_pu8, const uint16_t headLen_u16,
+    const uint8_t *const tail_pu8, const uint16_t tailLen_u16)
+{
+    if (NULL != LinDiagCapture_ps)
+    {
+        LinDiagCaptureAppend(LIN_DIAG_CAPTURE_RESPONSE, ch_ps->nad_u8, head_pu8, headLen_u16, tail_pu8, tailLen_u16);
+    }
+}
+
+Std_ReturnType LinDiagCaptureOpen(const uint8_t *const mem_pu8, LinDiagCaptureCursor_t *const cur_ps)
+{
+    const LinDiagCaptureHdr_t *const l_hdr_ps = (const LinDiagCaptureHdr_t *)(const void *)mem_pu8;
+
+    if ((LIN_DIAG_CAPTURE_MAGIC != l_hdr_ps->magic_u32) || (l_hdr_ps->tail_u32 >= l_hdr_ps->size_u32) ||
+        (l_hdr_ps->used_u32 > l_hdr_ps->size_u32))
+    {
+        return E_NOT_OK;
+    }
+
+    cur_ps->pos_u32 = l_hdr_ps->tail_u32;
+    cur_ps->left_u32 = l_hdr_ps->used_u32;
+    return E_OK;
+}
+
+Std_ReturnType LinDiagCaptureNext(const uint8_t *const mem_pu8, LinDiagCaptureCursor_t *const cur_ps,
+    LinDiagCaptureRec_t *const rec_ps, const uint8_t **const msg_ppu8)
+{
+    const LinDiagCaptureHdr_t *const l_hdr_ps = (const LinDiagCaptureHdr_t *)(const void *)mem_pu8;
+    const uint8_t *const l_area_cpu8 = &mem_pu8[kLinDiagCaptureHdrSize];
+
+    while (cur_ps->left_u32 > 0u)
+    {
+        const uint32_t l_span_cu32 = LinDiagCaptureRecSpan(l_hdr_ps, l_area_cpu8, cur_ps->pos_u32);
+        const uint32_t l_pos_cu32 = cur_ps->pos_u32;
+
+        /* A damaged ring ends the reading instead of running past it */
+        if ((l_span_cu32 > cur_ps->left_u32) || (l_span_cu32 > (l_hdr_ps->size_u32 - l_pos_cu32)) || (0u == l_span_cu32))
+        {
+            cur_ps->left_u32 = 0u;
+            return E_NOT_OK;
+        }
+
+        cur_ps->pos_u32 = (l_pos_cu32 + l_span_cu32) % l_hdr_ps->size_u32;
+        cur_ps->left_u32 -= l_span_cu32;
+
+        if ((l_hdr_ps->size_u32 - l_pos_cu32) >= kLinDiagCaptureRecSize)
+        {
+            LinDiagCaptureCopy((uint8_t *)rec_ps, &l_area_cpu8[l_pos_cu32], kLinDiagCaptureRecSize);
+            if (LIN_DIAG_CAPTURE_PAD != rec_ps->kind_u8)
+            {
+                *msg_ppu8 = &l_area_cpu8[l_pos_cu32 + kLinDiagCaptureRecSize];
+                return E_OK;
+            }
+        }
+    }
+
+    return E_NOT_OK;
+}
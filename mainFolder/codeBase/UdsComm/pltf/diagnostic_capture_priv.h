@@ -0,0 +1,14 @@
+#ifndef DIAGNOSTIC_CAPTURE_PRIV_H
+#define DIAGNOSTIC_CAPTURE_PRIV_H
+
+#include "diagnostic_capture.h"
+
+#define kLinDiagCaptureHdrSize         ((uint32_t)sizeof(LinDiagCaptureHdr_t))
+#define kLinDiagCaptureRecSize         ((uint32_t)sizeof(LinDiagCaptureRec_t))
+
+_Static_assert(sizeof(LinDiagCaptureRec_t) == 8u, "LinDiagCaptureRec_t must stay packed: it is the on-disk record header");
+
+/* Bytes a record takes at pos_u32 of the record area, padding to the end of the ring included */
+uint32_t LinDiagCaptureRecSpan(const LinDiagCaptureHdr_t *const hdr_ps, const uint8_t *const area_pu8, const uint32_t pos_u32);
+
+#endif /* DIAGNOSTIC_CAPTURE_PRIV_H */
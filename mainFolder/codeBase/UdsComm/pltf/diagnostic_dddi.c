@@ -0,0 +1,66 @@
+#include "diagnostic_dddi.h"
+#include "diagnostic_dddi_priv.h"
+#include "diagnostic_priv.h"
+
+Std_ReturnType LinDiagDynamicallyDefineDid(LinDiag_Channel_t *const ch_ps)
+{
+    const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+    const uint8_t *const l_req_cpu8 = ch_ps->req_pu8;
+    const uint8_t l_subFunction_cu8 = (l_reqLen_cu16 >= 2u) ? l_req_cpu8[1] : 0u;
+    uint16_t l_dynDid_u16 = LIN_DIAG_DYN_DID_ALL;
+    Std_ReturnType l_result_ = E_OK;
+    uint8_t l_errCode_u8 = 0;
+
+    LinDiagStartRequest(ch_ps);
+
+    checkMsgDataLength(l_reqLen_cu16, &l_result_);
+
+    if (l_reqLen_cu16 >= 4u) {
+        l_dynDid_u16 = (uint16_t)(((uint16_t)l_req_cpu8[2] << 8) | l_req_cpu8[3]);
+    }
+
+    if ((E_OK != l_result_) || (l_reqLen_cu16 < 2u)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+    } else if (kLinDiagDddiDefineByIdentifier == l_subFunction_cu8) {
+        /* SID, sub-function, composite DID, then whole records */
+        if ((l_reqLen_cu16 < (4u + LIN_DIAG_DDDI_RECORD_SIZE)) || (0u != ((l_reqLen_cu16 - 4u) % LIN_DIAG_DDDI_RECORD_SIZE))) {
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+        } else {
+            l_result_ = defineDynamicDid(ch_ps->node_ps, &l_errCode_u8, l_dynDid_u16, &l_req_cpu8[4],
+                                         (uint8_t)((l_reqLen_cu16 - 4u) / LIN_DIAG_DDDI_RECORD_SIZE));
+        }
+    } else if (kLinDiagDddiClear == l_subFunction_cu8) {
+        if ((2u != l_reqLen_cu16) && (4u != l_reqLen_cu16)) {
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+        } else if ((4u == l_reqLen_cu16) && (LIN_DIAG_DYN_DID_ALL == l_dynDid_u16)) {
+            /* 0xFFFF is no composite DID, clearing them all takes no DID */
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+        } else {
+            l_result_ = clearDynamicDid(ch_ps->node_ps, &l_errCode_u8, l_dynDid_u16);
+        }
+    } else {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcSubFunctionNotSupported;
+    }
+
+    if (E_OK == l_result_) {
+        /* The request is fully consumed: the response may overwrite it */
+        ch_ps->resp_pu8[0] = (uint8_t)(ch_ps->sid_u8 + kLinDiagPosRespSidOffset);
+        ch_ps->resp_pu8[1] = l_subFunction_cu8;
+        ch_ps->respLen_u16 = 2u;
+        if (LIN_DIAG_DYN_DID_ALL != l_dynDid_u16) {
+            ch_ps->resp_pu8[2] = (uint8_t)(l_dynDid_u16 >> 8);
+            ch_ps->resp_pu8[3] = (uint8_t)l_dynDid_u16;
+            ch_ps->respLen_u16 = 4u;
+        }
+        LinDiagSendPosResponse(ch_ps);
+    } else {
+        LinDiagSendNegResponse(ch_ps, l_errCode_u8);
+    }
+
+    return l_result_;
+}
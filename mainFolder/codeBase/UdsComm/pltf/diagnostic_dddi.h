@@ -0,0 +1,17 @@
+
+
+#ifndef DIAGNOSTIC_DDDI_H
+#define DIAGNOSTIC_DDDI_H
+
+#include "diagnostic.h"
+
+/* DynamicallyDefineDataIdentifier (0x2C) on ch_ps->req_pu8:
+ * - 0x01 defineByIdentifier: composite DID, then (source DID, position, size) records
+ *   appended to its definition
+ * - 0x03 clearDynamicallyDefinedDataIdentifier: one composite DID, or all without DID
+ * Composite DIDs are then read with ReadDataById like table DIDs.
+ * Returns E_OK when a positive response was sent.
+ */
+Std_ReturnType LinDiagDynamicallyDefineDid(LinDiag_Channel_t *const ch_ps);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef DIAGNOSTIC_DDDI_PRIV_H
+#define DIAGNOSTIC_DDDI_PRIV_H
+
+#include "diagnostic_dddi.h"
+
+#define kLinDiagDddiDefineByIdentifier     ((uint8_t)0x01u)
+#define kLinDiagDddiClear                  ((uint8_t)0x03u)
+
+/* Bytes of one defineByIdentifier record: source DID, position, size */
+#define LIN_DIAG_DDDI_RECORD_SIZE          4u
+
+#endif /* DIAGNOSTIC_DDDI_PRIV_H */
@@ -0,0 +1,9 @@
+#ifndef DIAGNOSTIC_DISPATCH_PRIV_H
+#define DIAGNOSTIC_DISPATCH_PRIV_H
+
+#include "diagnostic_dispatch.h"
+
+/* Sessions a descriptor mask can hold */
+#define kLinDiagDispatchMaxSession     ((uint8_t)8u)
+
+#endif /* DIAGNOSTIC_DISPATCH_PRIV_H */
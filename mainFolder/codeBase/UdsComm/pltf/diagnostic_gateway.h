@@ -0,0 +1,43 @@
+
+
+#ifndef DIAGNOSTIC_GATEWAY_H
+#define DIAGNOSTIC_GATEWAY_H
+
+#include "diagnostic.h"
+
+#define LIN_DIAG_GATEWAY_NO_NODE   ((uint8_t)0xFFu)
+
+/* Several nodes served from one process (gateway, multi-slave simulation).
+ * Every node is a channel of its own: buffers, transport, pending request.
+ * The NAD of a master request frame selects the node in one table lookup.
+ */
+typedef struct
+{
+    LinDiag_Channel_t *nodes_aps[LIN_DIAG_GATEWAY_NODES];
+    uint8_t            nadToNode_au8[256];   /* Node index per NAD, LIN_DIAG_GATEWAY_NO_NODE if not served */
+    uint8_t            nodeCount_u8;
+    uint8_t            respNode_u8;          /* Node addressed last: the one answering slave response headers */
+} LinDiagGateway_t;
+
+void LinDiagGatewayInit(LinDiagGateway_t *const gw_ps);
+
+/* Serve ch_ps->nad_u8 with ch_ps. E_NOT_OK when the gateway is full, the NAD
+ * is reserved (0x00 sleep, 0x7E functional, 0x7F wildcard) or already served.
+ */
+Std_ReturnType LinDiagGatewayAddNode(LinDiagGateway_t *const gw_ps, LinDiag_Channel_t *const ch_ps);
+
+/* Node index serving nad_u8, which then answers the slave response headers.
+ * LIN_DIAG_GATEWAY_NO_NODE when the NAD is not served here: the answering node stays.
+ */
+uint8_t LinDiagGatewaySelectNode(LinDiagGateway_t *const gw_ps, const uint8_t nad_u8);
+
+/* Route one master request frame by its NAD. Returns the channel holding a complete
+ * request, NULL while the request is incomplete or the NAD is not served here.
+ * Requests to the wildcard NAD are not routed: several nodes would answer.
+ */
+LinDiag_Channel_t *LinDiagGatewayRxFrame(LinDiagGateway_t *const gw_ps, const uint8_t *const frame_pu8);
+
+/* Slave response header: next frame of the node addressed last, E_NOT_OK when it has nothing to send */
+Std_ReturnType LinDiagGatewayGetTxFrame(LinDiagGateway_t *const gw_ps, uint8_t *const frame_pu8);
+
+#endif
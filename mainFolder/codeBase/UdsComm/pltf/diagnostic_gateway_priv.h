@@ -0,0 +1,12 @@
+#ifndef DIAGNOSTIC_GATEWAY_PRIV_H
+#define DIAGNOSTIC_GATEWAY_PRIV_H
+
+#include "diagnostic_gateway.h"
+
+/* NADs no node may take */
+#define kLinDiagNadSleep           ((uint8_t)0x00u)
+#define kLinDiagNadFunctional      ((uint8_t)0x7Eu)
+
+_Static_assert(LIN_DIAG_GATEWAY_NODES < LIN_DIAG_GATEWAY_NO_NODE, "LIN_DIAG_GATEWAY_NODES too large for 8-bit node indexes");
+
+#endif /* DIAGNOSTIC_GATEWAY_PRIV_H */
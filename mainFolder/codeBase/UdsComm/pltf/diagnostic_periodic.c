@@ -0,0 +1,266 @@
+#include "diagnostic_periodic.h"
+#include "diagnostic_periodic_priv.h"
+#include "diagnostic_priv.h"
+
+#define LIN_DIAG_PDID_BIT(pdid)   ((uint8_t)(1u << ((pdid) & 7u)))
+
+void LinDiagPeriodicInit(LinDiagPeriodic_t *const sched_ps)
+{
+    static const uint16_t l_periodsMs_cau16[LIN_DIAG_PERIODIC_RATES] =
+    {
+        LIN_DIAG_PERIODIC_SLOW_MS, LIN_DIAG_PERIODIC_MEDIUM_MS, LIN_DIAG_PERIODIC_FAST_MS
+    };
+    uint8_t l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < LIN_DIAG_PERIODIC_RATES; l_idx_u8++)
+    {
+        sched_ps->buckets_as[l_idx_u8].periodTicks_u16 = LIN_DIAG_MS_TO_TICKS(l_periodsMs_cau16[l_idx_u8]);
+        sched_ps->buckets_as[l_idx_u8].countdown_u16 = sched_ps->buckets_as[l_idx_u8].periodTicks_u16;
+        sched_ps->buckets_as[l_idx_u8].count_u8 = 0u;
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < sizeof(sched_ps->queued_au8); l_idx_u8++)
+    {
+        sched_ps->queued_au8[l_idx_u8] = 0u;
+        sched_ps->scheduled_au8[l_idx_u8] = 0u;
+    }
+
+    sched_ps->scheduledCount_u8 = 0u;
+    sched_ps->dueHead_u8 = 0u;
+    sched_ps->dueCount_u8 = 0u;
+}
+
+Std_ReturnType LinDiagPeriodicRemove(LinDiagPeriodic_t *const sched_ps, const uint8_t pdid_u8)
+{
+    uint8_t l_rate_u8;
+    uint8_t l_idx_u8;
+    uint8_t l_kept_u8;
+
+    if (0u == (sched_ps->scheduled_au8[pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(pdid_u8)))
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_rate_u8 = 0u; l_rate_u8 < LIN_DIAG_PERIODIC_RATES; l_rate_u8++)
+    {
+        LinDiagPeriodicBucket_t *const l_bucket_ps = &sched_ps->buckets_as[l_rate_u8];
+
+        for (l_idx_u8 = 0u; l_idx_u8 < l_bucket_ps->count_u8; l_idx_u8++)
+        {
+            if (pdid_u8 == l_bucket_ps->pdids_au8[l_idx_u8])
+            {
+                /* Order inside a bucket does not matter: move the last one here */
+                l_bucket_ps->count_u8--;
+                l_bucket_ps->pdids_au8[l_idx_u8] = l_bucket_ps->pdids_au8[l_bucket_ps->count_u8];
+                sched_ps->scheduled_au8[pdid_u8 >> 3] &= (uint8_t)~LIN_DIAG_PDID_BIT(pdid_u8);
+                sched_ps->scheduledCount_u8--;
+
+                /* A sample already queued goes too, the FIFO keeps the order of the others */
+                if (0u != (sched_ps->queued_au8[pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(pdid_u8)))
+                {
+                    sched_ps->queued_au8[pdid_u8 >> 3] &= (uint8_t)~LIN_DIAG_PDID_BIT(pdid_u8);
+                    l_kept_u8 = 0u;
+                    for (l_idx_u8 = 0u; l_idx_u8 < sched_ps->dueCount_u8; l_idx_u8++)
+                    {
+                        const uint8_t l_due_u8 = sched_ps->due_au8[(uint8_t)((sched_ps->dueHead_u8 + l_idx_u8) % LIN_DIAG_PERIODIC_MAX)];
+
+                        if (pdid_u8 != l_due_u8)
+                        {
+                            sched_ps->due_au8[(uint8_t)((sched_ps->dueHead_u8 + l_kept_u8) % LIN_DIAG_PERIODIC_MAX)] = l_due_u8;
+                            l_kept_u8++;
+                        }
+                    }
+                    sched_ps->dueCount_u8 = l_kept_u8;
+                }
+                return E_OK;
+            }
+        }
+    }
+
+    return E_NOT_OK;
+}
+
+Std_ReturnType LinDiagPeriodicAdd(LinDiagPeriodic_t *const sched_ps, const uint8_t rate_u8, const uint8_t pdid_u8)
+{
+    LinDiagPeriodicBucket_t *const l_bucket_ps = &sched_ps->buckets_as[rate_u8];
+
+    (void)LinDiagPeriodicRemove(sched_ps, pdid_u8);
+
+    if (sched_ps->scheduledCount_u8 >= LIN_DIAG_PERIODIC_MAX)
+    {
+        return E_NOT_OK;
+    }
+
+    l_bucket_ps->pdids_au8[l_bucket_ps->count_u8] = pdid_u8;
+    l_bucket_ps->count_u8++;
+    sched_ps->scheduled_au8[pdid_u8 >> 3] |= LIN_DIAG_PDID_BIT(pdid_u8);
+    sched_ps->scheduledCount_u8++;
+
+    return E_OK;
+}
+
+void LinDiagPeriodicTick(LinDiagPeriodic_t *const sched_ps)
+{
+    uint8_t l_rate_u8;
+    uint8_t l_idx_u8;
+
+    for (l_rate_u8 = 0u; l_rate_u8 < LIN_DIAG_PERIODIC_RATES; l_rate_u8++)
+    {
+        LinDiagPeriodicBucket_t *const l_bucket_ps = &sched_ps->buckets_as[l_rate_u8];
+
+        if (l_bucket_ps->countdown_u16 > 1u)
+        {
+            l_bucket_ps->countdown_u16--;
+            continue;
+        }
+        l_bucket_ps->countdown_u16 = l_bucket_ps->periodTicks_u16;
+
+        for (l_idx_u8 = 0u; l_idx_u8 < l_bucket_ps->count_u8; l_idx_u8++)
+        {
+            const uint8_t l_pdid_u8 = l_bucket_ps->pdids_au8[l_idx_u8];
+            uint8_t *const l_queued_pu8 = &sched_ps->queued_au8[l_pdid_u8 >> 3];
+
+            /* Not sent since its last period (bus too slow): keep a single sample queued */
+            if ((0u != (*l_queued_pu8 & LIN_DIAG_PDID_BIT(l_pdid_u8))) || (sched_ps->dueCount_u8 >= LIN_DIAG_PERIODIC_MAX))
+            {
+                continue;
+            }
+
+            sched_ps->due_au8[(uint8_t)((sched_ps->dueHead_u8 + sched_ps->dueCount_u8) % LIN_DIAG_PERIODIC_MAX)] = l_pdid_u8;
+            sched_ps->dueCount_u8++;
+            *l_queued_pu8 |= LIN_DIAG_PDID_BIT(l_pdid_u8);
+        }
+    }
+}
+
+Std_ReturnType LinDiagPeriodicSendNext(LinDiagPeriodic_t *const sched_ps, LinDiag_Channel_t *const ch_ps)
+{
+    while (0u != sched_ps->dueCount_u8)
+    {
+        const uint8_t l_pdid_u8 = sched_ps->due_au8[sched_ps->dueHead_u8];
+        uint8_t l_errCode_u8 = 0;
+        uint8_t l_size_u8 = 0;
+        Std_ReturnType l_didSupported_ = E_OK;
+
+        sched_ps->dueHead_u8 = (uint8_t)((sched_ps->dueHead_u8 + 1u) % LIN_DIAG_PERIODIC_MAX);
+        sched_ps->dueCount_u8--;
+        sched_ps->queued_au8[l_pdid_u8 >> 3] &= (uint8_t)~LIN_DIAG_PDID_BIT(l_pdid_u8);
+
+        /* Stopped since it was queued: nothing to send for it */
+        if (0u == (sched_ps->scheduled_au8[l_pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(l_pdid_u8)))
+        {
+            continue;
+        }
+
+        /* Samples failing to read are skipped, the next period tries again */
+        if (E_OK == getHandlersForReadDataById(ch_ps->node_ps, &l_errCode_u8,
+                                               (uint16_t)(LIN_DIAG_PERIODIC_DID_BASE | l_pdid_u8), &l_size_u8, &l_didSupported_, &sched_ps->sample_au8[2],
+                                               (uint8_t)(LIN_DIAG_BUFFER_SIZE - 2u)))
+        {
+            sched_ps->sample_au8[0] = (uint8_t)(kLinDiagSidReadDataByPeriodicId + kLinDiagPosRespSidOffset);
+            sched_ps->sample_au8[1] = l_pdid_u8;
+            return LinDiagTpStartTx(&ch_ps->tpTx_s, ch_ps->nad_u8, sched_ps->sample_au8,
+                                    (uint16_t)(2u + l_size_u8), NULL, 0u);
+        }
+    }
+
+    return E_NOT_OK;
+}
+
+void LinDiagPeriodicMainFunction(LinDiagPeriodic_t *const sched_ps, LinDiag_Channel_t *const ch_ps)
+{
+    LinDiagPeriodicTick(sched_ps);
+
+    /* Responses go first: periodic messages only fill the idle bus */
+    if ((0u == ch_ps->pending_u8) && (E_OK != LinDiagTpIsTxBusy(&ch_ps->tpTx_s)))
+    {
+        (void)LinDiagPeriodicSendNext(sched_ps, ch_ps);
+    }
+}
+
+Std_ReturnType LinDiagReadDataByPeriodicId(LinDiag_Channel_t *const ch_ps)
+{
+    LinDiagPeriodic_t *const sched_ps = ch_ps->periodic_ps;
+    const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+    const uint8_t *const l_req_cpu8 = ch_ps->req_pu8;
+    Std_ReturnType l_result_ = E_OK;
+    uint8_t l_errCode_u8 = 0;
+    uint8_t l_mode_u8;
+    uint16_t l_idx_u16;
+
+    LinDiagStartRequest(ch_ps);
+
+    checkMsgDataLength(l_reqLen_cu16, &l_result_);
+
+    /* SID + transmission mode, identifiers mandatory except to stop everything */
+    l_mode_u8 = (l_reqLen_cu16 >= 2u) ? l_req_cpu8[1] : 0u;
+    if (NULL == sched_ps) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcServiceNotSupported;
+    } else if ((E_OK != l_result_) || (l_reqLen_cu16 < 2u) ||
+        ((LIN_DIAG_PERIODIC_MODE_STOP != l_mode_u8) && (l_reqLen_cu16 < 3u))) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+    } else if ((l_mode_u8 < LIN_DIAG_PERIODIC_MODE_SLOW) || (l_mode_u8 > LIN_DIAG_PERIODIC_MODE_STOP)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+    } else if (LIN_DIAG_PERIODIC_MODE_STOP == l_mode_u8) {
+        if (2u == l_reqLen_cu16) {
+            LinDiagPeriodicInit(sched_ps);
+        }
+        for (l_idx_u16 = 2u; l_idx_u16 < l_reqLen_cu16; l_idx_u16++) {
+            (void)LinDiagPeriodicRemove(sched_ps, l_req_cpu8[l_idx_u16]);
+        }
+    } else {
+        /* Slow, medium, fast: bucket 0, 1, 2 */
+        const uint8_t l_rate_u8 = (uint8_t)(l_mode_u8 - LIN_DIAG_PERIODIC_MODE_SLOW);
+        uint8_t l_supportedMap_au8[(LIN_DIAG_BUFFER_SIZE + 7u) / 8u] = {0};
+        uint8_t l_listed_au8[32] = {0};
+        uint8_t l_supported_u8 = 0u;
+        uint8_t l_new_u8 = 0u;
+
+        /* First pass: nothing changes unless every supported identifier fits */
+        for (l_idx_u16 = 2u; l_idx_u16 < l_reqLen_cu16; l_idx_u16++) {
+            const uint8_t l_pdid_u8 = l_req_cpu8[l_idx_u16];
+            Std_ReturnType l_didOk_ = E_NOT_OK;
+
+            /* Listed twice: scheduled and counted once */
+            if (0u != (l_listed_au8[l_pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(l_pdid_u8))) {
+                continue;
+            }
+            l_listed_au8[l_pdid_u8 >> 3] |= LIN_DIAG_PDID_BIT(l_pdid_u8);
+
+            checkPeriodicDid(ch_ps->node_ps, (uint16_t)(LIN_DIAG_PERIODIC_DID_BASE | l_pdid_u8), &l_didOk_);
+
+            /* Unsupported identifiers are left out */
+            if (E_OK == l_didOk_) {
+                l_supportedMap_au8[l_idx_u16 >> 3] |= LIN_DIAG_PDID_BIT(l_idx_u16);
+                l_supported_u8++;
+                if (0u == (sched_ps->scheduled_au8[l_pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(l_pdid_u8))) {
+                    l_new_u8++;
+                }
+            }
+        }
+
+        if ((0u == l_supported_u8) || ((sched_ps->scheduledCount_u8 + l_new_u8) > LIN_DIAG_PERIODIC_MAX)) {
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+        } else {
+            for (l_idx_u16 = 2u; l_idx_u16 < l_reqLen_cu16; l_idx_u16++) {
+                if (0u != (l_supportedMap_au8[l_idx_u16 >> 3] & LIN_DIAG_PDID_BIT(l_idx_u16))) {
+                    (void)LinDiagPeriodicAdd(sched_ps, l_rate_u8, l_req_cpu8[l_idx_u16]);
+                }
+            }
+        }
+    }
+
+    if (E_OK == l_result_) {
+        ch_ps->resp_pu8[0] = (uint8_t)(ch_ps->sid_u8 + kLinDiagPosRespSidOffset);
+        ch_ps->respLen_u16 = 1u;
+        LinDiagSendPosResponse(ch_ps);
+    } else {
+        LinDiagSendNegResponse(ch_ps, l_errCode_u8);
+    }
+
+    return l_result_;
+}
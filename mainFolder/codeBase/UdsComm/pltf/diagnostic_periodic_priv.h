@@ -0,0 +1,20 @@
+#ifndef DIAGNOSTIC_PERIODIC_PRIV_H
+#define DIAGNOSTIC_PERIODIC_PRIV_H
+
+#include "diagnostic_periodic.h"
+
+#define kLinDiagSidReadDataByPeriodicId    ((uint8_t)0x2Au)
+
+/* Move pDID to bucket rate_u8 (index in buckets_as), E_NOT_OK if the scheduler is full */
+Std_ReturnType LinDiagPeriodicAdd(LinDiagPeriodic_t *const sched_ps, const uint8_t rate_u8, const uint8_t pdid_u8);
+
+/* Remove pDID from its bucket, E_NOT_OK if it was not scheduled */
+Std_ReturnType LinDiagPeriodicRemove(LinDiagPeriodic_t *const sched_ps, const uint8_t pdid_u8);
+
+/* Advance the buckets by one tick and queue the identifiers of the due ones */
+void LinDiagPeriodicTick(LinDiagPeriodic_t *const sched_ps);
+
+/* Build and send the next queued periodic message on ch_ps, E_NOT_OK if nothing was sent */
+Std_ReturnType LinDiagPeriodicSendNext(LinDiagPeriodic_t *const sched_ps, LinDiag_Channel_t *const ch_ps);
+
+#endif /* DIAGNOSTIC_PERIODIC_PRIV_H */
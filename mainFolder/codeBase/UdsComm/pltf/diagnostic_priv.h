@@ -1,10 +1,25 @@
 #include "diagnostic.h"
 #include "diagnostic_cfg.h"
+#include "diagnostic_tp.h"
 #include <stddef.h>
 
+#define kLinDiagPosRespSidOffset  ((uint8_t)0x40u)
+#define kLinDiagNegRespSid        ((uint8_t)0x7Fu)
 
-/* Send positive response */
-void LinDiagSendPosResponse(void);
+
+/* Take up the request in ch_ps->req_pu8: SID saved, no response tail, start of the response time */
+void LinDiagStartRequest(LinDiag_Channel_t *const ch_ps);
+
+/* Send positive response: resp_pu8[0..respLen_u16[ then the tail, through the channel transport layer */
+void LinDiagSendPosResponse(LinDiag_Channel_t *const ch_ps);
 
 /* Send negative response with error code */
-void LinDiagSendNegResponse(uint8_t errorCode);
\ No newline at end of file
+void LinDiagSendNegResponse(LinDiag_Channel_t *const ch_ps, uint8_t errorCode);
+
+/* Serve the saved DID list of ch_ps from rdbiDidIdx_u8 and send the response.
+ * opStatus_u8 is DIAG_OPSTATUS_PENDING to resume the pending DID, DIAG_OPSTATUS_INITIAL otherwise.
+ */
+Std_ReturnType LinDiagRdbiAssemble(LinDiag_Channel_t *const ch_ps, uint8_t opStatus_u8);
+
+/* Cancel the pending asynchronous DID of ch_ps, if any. No response is sent. */
+void LinDiagCancelPending(LinDiag_Channel_t *const ch_ps);
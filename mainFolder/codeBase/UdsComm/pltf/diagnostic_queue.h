@@ -0,0 +1,61 @@
+
+
+#ifndef DIAGNOSTIC_QUEUE_H
+#define DIAGNOSTIC_QUEUE_H
+
+#include "diagnostic.h"
+#include "diagnostic_dispatch.h"
+
+#if defined(__STDC_NO_ATOMICS__)
+/* Single core target only: the ISR is the only producer, aligned 16-bit accesses are atomic and
+ * LIN_DIAG_QUEUE_BARRIER keeps the compiler from moving the slot accesses across the indexes
+ */
+typedef volatile uint16 LinDiagQueueIdx_t;
+#else
+#include <stdatomic.h>
+typedef atomic_uint_least16_t LinDiagQueueIdx_t;
+#endif
+
+/* One complete request */
+typedef struct
+{
+    uint8  data_au8[LIN_DIAG_BUFFER_SIZE];
+    uint16 len_u16;
+    uint8  nad_u8;       /* NAD the request was addressed to */
+} LinDiagQueueEntry_t;
+
+/* Bounded single-producer / single-consumer request queue, lock-free.
+ * Producer side (bus receive interrupt or receiver thread): LinDiagQueueRxFrame, LinDiagQueuePush.
+ * Consumer side (diagnostic task): LinDiagQueueDrain.
+ * head_u16 is written by the producer only, tail_u16 by the consumer only.
+ */
+typedef struct
+{
+    LinDiagQueueEntry_t entries_as[LIN_DIAG_QUEUE_SIZE];
+    LinDiagQueueIdx_t   head_u16;
+    LinDiagQueueIdx_t   tail_u16;
+    LinDiagTpRx_t       rx_s;        /* Producer: request being reassembled in the head slot */
+    uint16              dropped_u16; /* Producer: requests lost because the queue was full */
+} LinDiagQueue_t;
+
+void LinDiagQueueInit(LinDiagQueue_t *const q_ps);
+
+/* Producer: feed one master request frame, reassembled directly in the free head slot.
+ * The NAD of the frame is kept with the request. Returns E_OK when a complete request was queued.
+ */
+Std_ReturnType LinDiagQueueRxFrame(LinDiagQueue_t *const q_ps, const uint8 *const frame_pu8);
+
+/* Producer: queue an already assembled request addressed to nad_u8. E_NOT_OK if full or too long. */
+Std_ReturnType LinDiagQueuePush(LinDiagQueue_t *const q_ps, const uint8 nad_u8, const uint8 *const req_pu8,
+    const uint16 len_u16);
+
+/* Consumer: serve up to maxBatch_u16 queued requests on ch_ps through the service table
+ * of disp_ps, oldest first. The request is read in place from its slot with the NAD it was
+ * addressed to: a request for another node gets no response. Draining stops while
+ * the channel is still transmitting the previous response or waits for an asynchronous DID.
+ * Returns the number of requests served.
+ */
+uint16 LinDiagQueueDrain(LinDiagQueue_t *const q_ps, const LinDiagDispatch_t *const disp_ps,
+    LinDiag_Channel_t *const ch_ps, const uint16 maxBatch_u16);
+
+#endif
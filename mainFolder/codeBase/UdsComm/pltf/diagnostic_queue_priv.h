@@ -0,0 +1,25 @@
+#ifndef DIAGNOSTIC_QUEUE_PRIV_H
+#define DIAGNOSTIC_QUEUE_PRIV_H
+
+#include "diagnostic_queue.h"
+
+#define LIN_DIAG_QUEUE_MASK ((uint16)(LIN_DIAG_QUEUE_SIZE - 1u))
+
+#if defined(__STDC_NO_ATOMICS__)
+/* Barrier after the load and before the store: the single-core counterpart of acquire / release */
+#define LIN_DIAG_QUEUE_LOAD_ACQ(idx)       LinDiagQueueLoadAcq(&(idx))
+#define LIN_DIAG_QUEUE_STORE_REL(idx, val) do { LIN_DIAG_QUEUE_BARRIER(); (idx) = (val); } while (0)
+
+uint16 LinDiagQueueLoadAcq(const LinDiagQueueIdx_t *const idx_pu16);
+#else
+#define LIN_DIAG_QUEUE_LOAD_ACQ(idx)       ((uint16)atomic_load_explicit(&(idx), memory_order_acquire))
+#define LIN_DIAG_QUEUE_STORE_REL(idx, val) atomic_store_explicit(&(idx), (val), memory_order_release)
+#endif
+
+/* Producer: slot to fill next, NULL when the queue is full */
+LinDiagQueueEntry_t *LinDiagQueueHeadSlot(LinDiagQueue_t *const q_ps);
+
+/* Producer: publish the head slot to the consumer */
+void LinDiagQueueCommit(LinDiagQueue_t *const q_ps);
+
+#endif /* DIAGNOSTIC_QUEUE_PRIV_H */
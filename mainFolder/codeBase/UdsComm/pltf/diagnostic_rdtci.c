@@ -0,0 +1,110 @@
+#include "diagnostic_rdtci.h"
+#include "diagnostic_rdtci_priv.h"
+#include "diagnostic_priv.h"
+
+Std_ReturnType LinDiagRdtciRecordByDtc(LinDiag_Channel_t *const ch_ps, const uint8_t subFunction_u8,
+    uint8_t *const errCode_pu8)
+{
+    const uint8_t *const l_req_cpu8 = ch_ps->req_pu8;
+    const uint32_t l_dtc_u32 = ((uint32_t)l_req_cpu8[2] << 16) | ((uint32_t)l_req_cpu8[3] << 8) | l_req_cpu8[4];
+    const uint8_t l_record_u8 = l_req_cpu8[5];
+    const uint8_t *l_snapshot_pu8 = NULL;
+    uint8_t *const l_resp_pu8 = ch_ps->resp_pu8;
+    uint8_t l_status_u8 = 0u;
+    uint8_t l_occurrence_u8 = 0u;
+    uint16_t l_pos_u16 = 6u;
+    uint16_t l_idx_u16;
+
+    if ((kLinDiagRdtciRecord != l_record_u8) && (kLinDiagRdtciAllRecords != l_record_u8)) {
+        *errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+        return E_NOT_OK;
+    }
+
+    if (E_OK != getDtcByNumber(ch_ps->node_ps, errCode_pu8, l_dtc_u32, &l_status_u8, &l_occurrence_u8, &l_snapshot_pu8)) {
+        return E_NOT_OK;
+    }
+
+    /* The request is fully decoded: the response may overwrite it */
+    l_resp_pu8[5] = l_status_u8;
+
+    /* A DTC that never failed has no record */
+    if (NULL != l_snapshot_pu8) {
+        l_resp_pu8[l_pos_u16++] = kLinDiagRdtciRecord;
+        if (kLinDiagRdtciSnapshotByDtc == subFunction_u8) {
+            /* One identifier: the snapshot DID */
+            l_resp_pu8[l_pos_u16++] = 1u;
+            l_resp_pu8[l_pos_u16++] = (uint8_t)(LIN_DIAG_DTC_SNAPSHOT_DID >> 8);
+            l_resp_pu8[l_pos_u16++] = (uint8_t)LIN_DIAG_DTC_SNAPSHOT_DID;
+            for (l_idx_u16 = 0u; l_idx_u16 < LIN_DIAG_DTC_SNAPSHOT_SIZE; l_idx_u16++) {
+                l_resp_pu8[l_pos_u16++] = l_snapshot_pu8[l_idx_u16];
+            }
+        } else {
+            l_resp_pu8[l_pos_u16++] = l_occurrence_u8;
+        }
+    }
+
+    /* DTC bytes [2..4] are already in place when resp_pu8 aliases req_pu8 */
+    l_resp_pu8[2] = (uint8_t)(l_dtc_u32 >> 16);
+    l_resp_pu8[3] = (uint8_t)(l_dtc_u32 >> 8);
+    l_resp_pu8[4] = (uint8_t)l_dtc_u32;
+    ch_ps->respLen_u16 = l_pos_u16;
+
+    return E_OK;
+}
+
+Std_ReturnType LinDiagReadDtcInformation(LinDiag_Channel_t *const ch_ps)
+{
+    const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+    const uint8_t *const l_req_cpu8 = ch_ps->req_pu8;
+    const uint8_t l_subFunction_cu8 = (l_reqLen_cu16 >= 2u) ? l_req_cpu8[1] : 0u;
+    uint8_t *const l_resp_pu8 = ch_ps->resp_pu8;
+    Std_ReturnType l_result_ = E_OK;
+    uint8_t l_errCode_u8 = 0;
+
+    LinDiagStartRequest(ch_ps);
+
+    checkMsgDataLength(l_reqLen_cu16, &l_result_);
+
+    if ((E_OK != l_result_) || (l_reqLen_cu16 < 2u)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+    } else if ((kLinDiagRdtciNumberByStatusMask == l_subFunction_cu8) || (kLinDiagRdtciByStatusMask == l_subFunction_cu8)) {
+        if (3u != l_reqLen_cu16) {
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+        } else if (kLinDiagRdtciNumberByStatusMask == l_subFunction_cu8) {
+            const uint8_t l_count_cu8 = getDtcByStatusMask(ch_ps->node_ps, l_req_cpu8[2], NULL);
+
+            l_resp_pu8[3] = kLinDiagRdtciFormatIso14229;
+            l_resp_pu8[4] = 0u;
+            l_resp_pu8[5] = l_count_cu8;
+            ch_ps->respLen_u16 = 6u;
+        } else {
+            /* Records written from resp_pu8[3]: past the 3 request bytes, which are read first */
+            const uint8_t l_count_cu8 = getDtcByStatusMask(ch_ps->node_ps, l_req_cpu8[2], &l_resp_pu8[3]);
+
+            ch_ps->respLen_u16 = (uint16_t)(3u + (4u * l_count_cu8));
+        }
+        l_resp_pu8[2] = DIAG_DTC_STATUS_AVAILABILITY;
+    } else if ((kLinDiagRdtciSnapshotByDtc == l_subFunction_cu8) || (kLinDiagRdtciExtDataByDtc == l_subFunction_cu8)) {
+        if (6u != l_reqLen_cu16) {
+            l_result_ = E_NOT_OK;
+            l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+        } else {
+            l_result_ = LinDiagRdtciRecordByDtc(ch_ps, l_subFunction_cu8, &l_errCode_u8);
+        }
+    } else {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcSubFunctionNotSupported;
+    }
+
+    if (E_OK == l_result_) {
+        l_resp_pu8[0] = (uint8_t)(ch_ps->sid_u8 + kLinDiagPosRespSidOffset);
+        l_resp_pu8[1] = l_subFunction_cu8;
+        LinDiagSendPosResponse(ch_ps);
+    } else {
+        LinDiagSendNegResponse(ch_ps, l_errCode_u8);
+    }
+
+    return l_result_;
+}
@@ -0,0 +1,15 @@
+
+#ifndef DIAGNOSTIC_RDTCI_H
+#define DIAGNOSTIC_RDTCI_H
+
+#include "diagnostic.h"
+
+/* ReadDTCInformation (0x19) on ch_ps->req_pu8, answered from the fault memory:
+ * - 0x01 reportNumberOfDTCByStatusMask, 0x02 reportDTCByStatusMask: status mask
+ * - 0x04 reportDTCSnapshotRecordByDTCNumber, 0x06 reportDTCExtDataRecordByDTCNumber:
+ *   DTC (3 bytes) and record number (0x01, or 0xFF for all)
+ * Returns E_OK when a positive response was sent.
+ */
+Std_ReturnType LinDiagReadDtcInformation(LinDiag_Channel_t *const ch_ps);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef DIAGNOSTIC_RDTCI_PRIV_H
+#define DIAGNOSTIC_RDTCI_PRIV_H
+
+#include "diagnostic_rdtci.h"
+
+#define kLinDiagRdtciNumberByStatusMask    ((uint8_t)0x01u)
+#define kLinDiagRdtciByStatusMask          ((uint8_t)0x02u)
+#define kLinDiagRdtciSnapshotByDtc         ((uint8_t)0x04u)
+#define kLinDiagRdtciExtDataByDtc          ((uint8_t)0x06u)
+
+/* DTCFormatIdentifier of reportNumberOfDTCByStatusMask: ISO 14229-1 DTC format */
+#define kLinDiagRdtciFormatIso14229        ((uint8_t)0x01u)
+
+/* The only snapshot / extended data record: 0x01; 0xFF asks for all of them */
+#define kLinDiagRdtciRecord                ((uint8_t)0x01u)
+#define kLinDiagRdtciAllRecords            ((uint8_t)0xFFu)
+
+/* Sub-functions 0x04 / 0x06 on a 6-byte request: resp_pu8 from [2] gets the DTC, its status and,
+ * once the DTC failed, the snapshot or extended data (occurrence counter) record
+ */
+Std_ReturnType LinDiagRdtciRecordByDtc(LinDiag_Channel_t *const ch_ps, const uint8_t subFunction_u8,
+    uint8_t *const errCode_pu8);
+
+#endif /* DIAGNOSTIC_RDTCI_PRIV_H */
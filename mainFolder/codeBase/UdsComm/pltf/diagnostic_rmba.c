@@ -0,0 +1,55 @@
+#include "diagnostic_rmba.h"
+#include "diagnostic_rmba_priv.h"
+#include "diagnostic_priv.h"
+
+Std_ReturnType LinDiagReadMemoryByAddress(LinDiag_Channel_t *const ch_ps)
+{
+    const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+    const uint8_t *const l_req_cpu8 = ch_ps->req_pu8;
+    const uint8_t l_alfid_cu8 = (l_reqLen_cu16 >= 2u) ? l_req_cpu8[1] : 0u;
+    const uint8_t l_addressBytes_cu8 = LIN_DIAG_RMBA_ADDRESS_BYTES(l_alfid_cu8);
+    const uint8_t l_sizeBytes_cu8 = LIN_DIAG_RMBA_SIZE_BYTES(l_alfid_cu8);
+    const uint8_t *l_data_pu8 = NULL;
+    uintptr_t l_address_uptr = 0u;
+    uint16_t l_size_u16 = 0u;
+    Std_ReturnType l_result_ = E_OK;
+    uint8_t l_errCode_u8 = 0;
+    uint8_t l_idx_u8;
+
+    LinDiagStartRequest(ch_ps);
+
+    checkMsgDataLength(l_reqLen_cu16, &l_result_);
+
+    if ((E_OK != l_result_) || (l_reqLen_cu16 < 2u)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+    } else if ((0u == l_addressBytes_cu8) || (l_addressBytes_cu8 > LIN_DIAG_RMBA_ADDRESS_MAX_BYTES) ||
+               (0u == l_sizeBytes_cu8) || (l_sizeBytes_cu8 > LIN_DIAG_RMBA_SIZE_MAX_BYTES)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
+    } else if (l_reqLen_cu16 != (uint16_t)(2u + l_addressBytes_cu8 + l_sizeBytes_cu8)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+    } else {
+        for (l_idx_u8 = 0u; l_idx_u8 < l_addressBytes_cu8; l_idx_u8++) {
+            l_address_uptr = (l_address_uptr << 8) | l_req_cpu8[2u + l_idx_u8];
+        }
+        for (l_idx_u8 = 0u; l_idx_u8 < l_sizeBytes_cu8; l_idx_u8++) {
+            l_size_u16 = (uint16_t)((l_size_u16 << 8) | l_req_cpu8[2u + l_addressBytes_cu8 + l_idx_u8]);
+        }
+        l_result_ = getMemoryForReadMemoryByAddress(&l_errCode_u8, l_address_uptr, l_size_u16, &l_data_pu8);
+    }
+
+    if (E_OK == l_result_) {
+        /* Only the SID goes through the buffer, the transport layer segments the memory itself */
+        ch_ps->resp_pu8[0] = (uint8_t)(ch_ps->sid_u8 + kLinDiagPosRespSidOffset);
+        ch_ps->respLen_u16 = 1u;
+        ch_ps->respTail_pu8 = l_data_pu8;
+        ch_ps->respTailLen_u16 = l_size_u16;
+        LinDiagSendPosResponse(ch_ps);
+    } else {
+        LinDiagSendNegResponse(ch_ps, l_errCode_u8);
+    }
+
+    return l_result_;
+}
@@ -0,0 +1,14 @@
+
+#ifndef DIAGNOSTIC_RMBA_H
+#define DIAGNOSTIC_RMBA_H
+
+#include "diagnostic.h"
+
+/* ReadMemoryByAddress (0x23) on ch_ps->req_pu8: addressAndLengthFormatIdentifier, then the
+ * address and the size, big endian, as long as its nibbles say. The memory is sent in place
+ * by the transport layer, frame by frame: it should not change until LinDiagTpIsTxBusy()
+ * returns E_NOT_OK. Returns E_OK when a positive response was sent.
+ */
+Std_ReturnType LinDiagReadMemoryByAddress(LinDiag_Channel_t *const ch_ps);
+
+#endif
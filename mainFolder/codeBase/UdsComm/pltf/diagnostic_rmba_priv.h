@@ -0,0 +1,13 @@
+#ifndef DIAGNOSTIC_RMBA_PRIV_H
+#define DIAGNOSTIC_RMBA_PRIV_H
+
+#include "diagnostic_rmba.h"
+
+/* addressAndLengthFormatIdentifier: size bytes in the high nibble, address bytes in the low one */
+#define LIN_DIAG_RMBA_ADDRESS_BYTES(alfid)  ((uint8_t)((alfid) & 0x0Fu))
+#define LIN_DIAG_RMBA_SIZE_BYTES(alfid)     ((uint8_t)((alfid) >> 4))
+/* Widest fields taken: an address of this target, a size up to LIN_DIAG_MEM_READ_MAX */
+#define LIN_DIAG_RMBA_ADDRESS_MAX_BYTES     ((uint8_t)sizeof(uintptr_t))
+#define LIN_DIAG_RMBA_SIZE_MAX_BYTES        2u
+
+#endif /* DIAGNOSTIC_RMBA_PRIV_H */
@@ -0,0 +1,218 @@
+#include "diagnostic_tp.h"
+#include "diagnostic_tp_priv.h"
+#include <stddef.h>
+
+void LinDiagTpInit(LinDiagTpTx_t *const tx_ps, LinDiagTpRx_t *const rx_ps)
+{
+    tx_ps->head_pu8 = NULL;
+    tx_ps->tail_pu8 = NULL;
+    tx_ps->headLen_u16 = 0u;
+    tx_ps->tailLen_u16 = 0u;
+    tx_ps->sent_u16 = 0u;
+    tx_ps->nad_u8 = 0u;
+    tx_ps->sn_u8 = 0u;
+    tx_ps->active_u8 = 0u;
+
+    rx_ps->expected_u16 = 0u;
+    rx_ps->received_u16 = 0u;
+    rx_ps->sn_u8 = 0u;
+    rx_ps->active_u8 = 0u;
+}
+
+Std_ReturnType LinDiagTpStartTx(LinDiagTpTx_t *const tx_ps, const uint8 nad_u8, const uint8 *const head_pu8, const uint16 headLen_u16,
+    const uint8 *const tail_pu8, const uint16 tailLen_u16)
+{
+    const uint16 l_total_u16 = (uint16)(headLen_u16 + tailLen_u16);
+
+    if ((0u == l_total_u16) || (l_total_u16 > LIN_TP_MAX_LENGTH) ||
+        (headLen_u16 > LIN_TP_MAX_LENGTH) || (tailLen_u16 > LIN_TP_MAX_LENGTH))
+    {
+        return E_NOT_OK;
+    }
+
+    tx_ps->head_pu8 = head_pu8;
+    tx_ps->tail_pu8 = tail_pu8;
+    tx_ps->headLen_u16 = headLen_u16;
+    tx_ps->tailLen_u16 = tailLen_u16;
+    tx_ps->sent_u16 = 0u;
+    tx_ps->nad_u8 = nad_u8;
+    tx_ps->sn_u8 = 1u;
+    tx_ps->active_u8 = 1u;
+
+    return E_OK;
+}
+
+void LinDiagTpCopyOut(LinDiagTpTx_t *const tx_ps, uint8 *const dest_pu8, const uint8 len_u8)
+{
+    uint16 l_pos_u16 = tx_ps->sent_u16;
+    uint8 l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < len_u8; l_idx_u8++)
+    {
+        if (l_pos_u16 < tx_ps->headLen_u16)
+        {
+            dest_pu8[l_idx_u8] = tx_ps->head_pu8[l_pos_u16];
+        }
+        else
+        {
+            dest_pu8[l_idx_u8] = tx_ps->tail_pu8[l_pos_u16 - tx_ps->headLen_u16];
+        }
+        l_pos_u16++;
+    }
+
+    tx_ps->sent_u16 = l_pos_u16;
+}
+
+Std_ReturnType LinDiagTpGetTxFrame(LinDiagTpTx_t *const tx_ps, uint8 *const frame_pu8)
+{
+    const uint16 l_total_u16 = (uint16)(tx_ps->headLen_u16 + tx_ps->tailLen_u16);
+    uint16 l_remaining_u16;
+    uint8 l_len_u8;
+    uint8 l_idx_u8;
+
+    if (0u == tx_ps->active_u8)
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < LIN_TP_FRAME_SIZE; l_idx_u8++)
+    {
+        frame_pu8[l_idx_u8] = LIN_TP_PADDING;
+    }
+    frame_pu8[0] = tx_ps->nad_u8;
+
+    l_remaining_u16 = (uint16)(l_total_u16 - tx_ps->sent_u16);
+
+    if (0u == tx_ps->sent_u16)
+    {
+        if (l_total_u16 <= LIN_TP_SF_MAX_DATA)
+        {
+            /* Single frame */
+            frame_pu8[1] = (uint8)(LIN_TP_PCI_SF | (uint8)l_total_u16);
+            LinDiagTpCopyOut(tx_ps, &frame_pu8[2], (uint8)l_total_u16);
+        }
+        else
+        {
+            /* First frame: 12-bit length then the first data bytes */
+            frame_pu8[1] = (uint8)(LIN_TP_PCI_FF | (uint8)((l_total_u16 >> 8) & 0x0Fu));
+            frame_pu8[2] = (uint8)(l_total_u16 & 0xFFu);
+            LinDiagTpCopyOut(tx_ps, &frame_pu8[3], (uint8)LIN_TP_FF_DATA);
+        }
+    }
+    else
+    {
+        /* Consecutive frame */
+        l_len_u8 = (l_remaining_u16 < LIN_TP_CF_DATA) ? (uint8)l_remaining_u16 : (uint8)LIN_TP_CF_DATA;
+        frame_pu8[1] = (uint8)(LIN_TP_PCI_CF | tx_ps->sn_u8);
+        LinDiagTpCopyOut(tx_ps, &frame_pu8[2], l_len_u8);
+        tx_ps->sn_u8 = (uint8)((tx_ps->sn_u8 + 1u) & 0x0Fu);
+    }
+
+    if (tx_ps->sent_u16 >= l_total_u16)
+    {
+        tx_ps->active_u8 = 0u;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType LinDiagTpIsTxBusy(const LinDiagTpTx_t *const tx_ps)
+{
+    return (0u != tx_ps->active_u8) ? E_OK : E_NOT_OK;
+}
+
+Std_ReturnType LinDiagTpRxFrame(LinDiagTpRx_t *const rx_ps, LinDiagTpTx_t *const tx_ps,
+    const uint8 *const frame_pu8, uint8 *const reqBuf_pu8, const uint16 reqCapacity_u16,
+    uint16 *const reqLen_pu16)
+{
+    const uint8 l_pci_u8 = frame_pu8[1];
+    uint16 l_len_u16 = 0u;
+    uint16 l_idx_u16;
+
+    switch (l_pci_u8 & LIN_TP_PCI_TYPE_MASK)
+    {
+        case LIN_TP_PCI_SF:
+        {
+            l_len_u16 = (uint16)(l_pci_u8 & 0x0Fu);
+            rx_ps->active_u8 = 0u;
+
+            if ((0u == l_len_u16) || (l_len_u16 > LIN_TP_SF_MAX_DATA) || (l_len_u16 > reqCapacity_u16))
+            {
+                return E_NOT_OK;
+            }
+
+            /* A new request aborts the pending response */
+            if (NULL != tx_ps)
+            {
+                tx_ps->active_u8 = 0u;
+            }
+            for (l_idx_u16 = 0u; l_idx_u16 < l_len_u16; l_idx_u16++)
+            {
+                reqBuf_pu8[l_idx_u16] = frame_pu8[2u + l_idx_u16];
+            }
+            *reqLen_pu16 = l_len_u16;
+            return E_OK;
+        }
+
+        case LIN_TP_PCI_FF:
+        {
+            l_len_u16 = (uint16)(((uint16)(l_pci_u8 & 0x0Fu) << 8) | frame_pu8[2]);
+            rx_ps->active_u8 = 0u;
+
+            if ((l_len_u16 <= LIN_TP_SF_MAX_DATA) || (l_len_u16 > reqCapacity_u16))
+            {
+                return E_NOT_OK;
+            }
+
+            if (NULL != tx_ps)
+            {
+                tx_ps->active_u8 = 0u;
+            }
+            for (l_idx_u16 = 0u; l_idx_u16 < LIN_TP_FF_DATA; l_idx_u16++)
+            {
+                reqBuf_pu8[l_idx_u16] = frame_pu8[3u + l_idx_u16];
+            }
+            rx_ps->expected_u16 = l_len_u16;
+            rx_ps->received_u16 = LIN_TP_FF_DATA;
+            rx_ps->sn_u8 = 1u;
+            rx_ps->active_u8 = 1u;
+            return E_NOT_OK;
+        }
+
+        case LIN_TP_PCI_CF:
+        {
+            if ((0u == rx_ps->active_u8) || ((l_pci_u8 & 0x0Fu) != rx_ps->sn_u8))
+            {
+                /* Unexpected or out-of-sequence frame: drop the request */
+                rx_ps->active_u8 = 0u;
+                return E_NOT_OK;
+            }
+
+            l_len_u16 = (uint16)(rx_ps->expected_u16 - rx_ps->received_u16);
+            if (l_len_u16 > LIN_TP_CF_DATA)
+            {
+                l_len_u16 = LIN_TP_CF_DATA;
+            }
+
+            for (l_idx_u16 = 0u; l_idx_u16 < l_len_u16; l_idx_u16++)
+            {
+                reqBuf_pu8[rx_ps->received_u16 + l_idx_u16] = frame_pu8[2u + l_idx_u16];
+            }
+            rx_ps->received_u16 = (uint16)(rx_ps->received_u16 + l_len_u16);
+            rx_ps->sn_u8 = (uint8)((rx_ps->sn_u8 + 1u) & 0x0Fu);
+
+            if (rx_ps->received_u16 >= rx_ps->expected_u16)
+            {
+                rx_ps->active_u8 = 0u;
+                *reqLen_pu16 = rx_ps->expected_u16;
+                return E_OK;
+            }
+            return E_NOT_OK;
+        }
+
+        default:
+        {
+            return E_NOT_OK;
+        }
+    }
+}
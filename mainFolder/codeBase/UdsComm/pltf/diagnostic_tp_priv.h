@@ -0,0 +1,9 @@
+#ifndef DIAGNOSTIC_TP_PRIV_H
+#define DIAGNOSTIC_TP_PRIV_H
+
+#include "diagnostic_tp.h"
+
+/* Copy len_u8 message bytes starting at tx_ps->sent_u16 into dest_pu8 */
+void LinDiagTpCopyOut(LinDiagTpTx_t *const tx_ps, uint8 *const dest_pu8, const uint8 len_u8);
+
+#endif /* DIAGNOSTIC_TP_PRIV_H */
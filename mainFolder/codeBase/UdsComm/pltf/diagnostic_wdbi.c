@@ -0,0 +1,38 @@
+#include "diagnostic_wdbi.h"
+#include "diagnostic_priv.h"
+
+Std_ReturnType LinDiagWriteDataById(LinDiag_Channel_t *const ch_ps)
+{
+    const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+    const uint8_t *const l_req_cpu8 = ch_ps->req_pu8;
+    uint16_t l_did_u16 = 0u;
+    Std_ReturnType l_result_ = E_OK;
+    uint8_t l_errCode_u8 = 0;
+
+    LinDiagStartRequest(ch_ps);
+
+    checkMsgDataLength(l_reqLen_cu16, &l_result_);
+
+    /* SID, DID and at least one data byte */
+    if ((E_OK != l_result_) || (l_reqLen_cu16 < 4u)) {
+        l_result_ = E_NOT_OK;
+        l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+    } else {
+        l_did_u16 = (uint16_t)(((uint16_t)l_req_cpu8[1] << 8) | l_req_cpu8[2]);
+        l_result_ = setDataForWriteDataById(ch_ps->node_ps, &l_errCode_u8, l_did_u16, &l_req_cpu8[3],
+                                            (uint16_t)(l_reqLen_cu16 - 3u));
+    }
+
+    if (E_OK == l_result_) {
+        /* The data is already copied: the response may overwrite the request */
+        ch_ps->resp_pu8[0] = (uint8_t)(ch_ps->sid_u8 + kLinDiagPosRespSidOffset);
+        ch_ps->resp_pu8[1] = (uint8_t)(l_did_u16 >> 8);
+        ch_ps->resp_pu8[2] = (uint8_t)l_did_u16;
+        ch_ps->respLen_u16 = 3u;
+        LinDiagSendPosResponse(ch_ps);
+    } else {
+        LinDiagSendNegResponse(ch_ps, l_errCode_u8);
+    }
+
+    return l_result_;
+}
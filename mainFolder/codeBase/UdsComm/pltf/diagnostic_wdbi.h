@@ -0,0 +1,14 @@
+
+#ifndef DIAGNOSTIC_WDBI_H
+#define DIAGNOSTIC_WDBI_H
+
+#include "diagnostic.h"
+
+/* WriteDataById (0x2E) on ch_ps->req_pu8: DID, then exactly the DID size of data.
+ * Writable DIDs are flagged in diagnostic_did.csv; the response does not wait for the
+ * NVM, persisted DIDs are committed in batches by diagNvmMainFunction.
+ * Returns E_OK when a positive response was sent.
+ */
+Std_ReturnType LinDiagWriteDataById(LinDiag_Channel_t *const ch_ps);
+
+#endif
@@ -0,0 +1,262 @@
+/* Replay of a recorded diagnostic session through ApplLinDiagReadDataById.
+ *
+ *   make capture-replay && ./capture_replay.out [capture file]
+ *
+ * Reads a ring recorded by LinDiagCaptureStart (LIN_DIAG_CAPTURE_FILE by default,
+ * e.g. written by ./linbench.out ... capture), feeds every ReadDataById request of
+ * it back through ApplLinDiagReadDataById and ApplLinDiagMainFunction, and
+ * compares the final response (NRC 0x78 skipped) byte for byte with the recorded
+ * one. Other services are skipped. The DIDs of LinDiagReplay_VolatileDids_cau16
+ * report run-time values: their requests are replayed but not compared.
+ *
+ * Exit status 1 on a mismatch or an unreadable capture.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "diagnostic.h"
+#include "diagnostic_capture.h"
+
+/* ApplLinDiagMainFunction calls per request: an asynchronous DID finishes well within */
+#define LIN_DIAG_REPLAY_POLLS      64u
+
+/* Ring of the responses of one replayed request: the largest response and its NRC 0x78 */
+#define LIN_DIAG_REPLAY_RING_SIZE  (2u * LIN_TP_MAX_LENGTH)
+
+static const uint16_t LinDiagReplay_VolatileDids_cau16[] =
+{
+    0xFDF0u,    /* DIAG_STATISTICS: timings of this process */
+};
+
+#define LIN_DIAG_REPLAY_VOLATILE_COUNT (sizeof(LinDiagReplay_VolatileDids_cau16) / sizeof(LinDiagReplay_VolatileDids_cau16[0]))
+
+typedef struct
+{
+    const uint8_t *msg_pu8;
+    uint16_t       len_u16;
+    uint8_t        found_u8;
+} LinDiagReplayResp_t;
+
+typedef struct
+{
+    uint32_t requests_u32;     /* ReadDataById requests replayed */
+    uint32_t matched_u32;
+    uint32_t mismatched_u32;
+    uint32_t unchecked_u32;    /* Volatile DIDs */
+    uint32_t skipped_u32;      /* Other services */
+} LinDiagReplayCount_t;
+
+static uint8_t LinDiagReplay_Ring_au8[LIN_DIAG_REPLAY_RING_SIZE];
+
+/* Frame out whatever the stack sends, as the LIN driver would: NRC 0x78 included */
+static void LinDiagReplayDrain(void)
+{
+    uint8_t l_frame_au8[LIN_TP_FRAME_SIZE];
+
+    while (E_OK == LinDiagGetTxFrame(&LinDiag_DefaultChannel, l_frame_au8)) {
+    }
+}
+
+static uint8_t *LinDiagReplayLoad(const char *const path_pc, size_t *const size_ps)
+{
+    FILE *const l_file_ps = fopen(path_pc, "rb");
+    uint8_t *l_mem_pu8 = NULL;
+    long l_size;
+
+    if (NULL == l_file_ps) {
+        fprintf(stderr, "%s: cannot open\n", path_pc);
+        return NULL;
+    }
+    if ((0 == fseek(l_file_ps, 0L, SEEK_END)) && ((l_size = ftell(l_file_ps)) > 0L) &&
+        (0 == fseek(l_file_ps, 0L, SEEK_SET))) {
+        l_mem_pu8 = malloc((size_t)l_size);
+        if ((NULL != l_mem_pu8) && ((size_t)l_size != fread(l_mem_pu8, 1u, (size_t)l_size, l_file_ps))) {
+            free(l_mem_pu8);
+            l_mem_pu8 = NULL;
+        }
+        *size_ps = (size_t)l_size;
+    }
+    (void)fclose(l_file_ps);
+
+    if (NULL == l_mem_pu8) {
+        fprintf(stderr, "%s: cannot read\n", path_pc);
+    }
+    return l_mem_pu8;
+}
+
+/* Final response among the records following a request: the last one that is not NRC 0x78 */
+static void LinDiagReplayKeep(LinDiagReplayResp_t *const resp_ps, const LinDiagCaptureRec_t *const rec_ps,
+                              const uint8_t *const msg_pu8)
+{
+    if ((3u == rec_ps->len_u16) && (0x7Fu == msg_pu8[0]) && (kLinDiagNrcResponsePending == msg_pu8[2])) {
+        return;
+    }
+    resp_ps->msg_pu8 = msg_pu8;
+    resp_ps->len_u16 = rec_ps->len_u16;
+    resp_ps->found_u8 = 1u;
+}
+
+static uint8_t LinDiagReplayIsVolatile(const uint8_t *const req_pu8, const uint16_t len_u16)
+{
+    uint16_t l_pos_u16;
+    size_t l_idx;
+
+    for (l_pos_u16 = 1u; (l_pos_u16 + 1u) < len_u16; l_pos_u16 += 2u) {
+        const uint16_t l_did_cu16 = (uint16_t)(((uint16_t)req_pu8[l_pos_u16] << 8) | req_pu8[l_pos_u16 + 1u]);
+
+        for (l_idx = 0u; l_idx < LIN_DIAG_REPLAY_VOLATILE_COUNT; l_idx++) {
+            if (l_did_cu16 == LinDiagReplay_VolatileDids_cau16[l_idx]) {
+                return 1u;
+            }
+        }
+    }
+    return 0u;
+}
+
+/* Run one recorded request through the stack and return its final response, read back from the replay ring */
+static void LinDiagReplayRun(const uint8_t *const req_pu8, const uint16_t len_u16, LinDiagReplayResp_t *const resp_ps)
+{
+    LinDiagCaptureCursor_t l_cur_s;
+    LinDiagCaptureRec_t l_rec_s;
+    const uint8_t *l_msg_pu8;
+    uint16_t l_idx_u16;
+    uint8_t l_poll_u8;
+
+    /* Fresh ring: only the responses of this request */
+    LinDiagReplay_Ring_au8[0] = 0u;
+    LinDiagCaptureStart(LinDiagReplay_Ring_au8, LIN_DIAG_REPLAY_RING_SIZE);
+
+    for (l_idx_u16 = 0u; l_idx_u16 < len_u16; l_idx_u16++) {
+        pbLinDiagBuffer[l_idx_u16] = req_pu8[l_idx_u16];
+    }
+    g_linDiagDataLength = len_u16;
+
+    ApplLinDiagReadDataById();
+    LinDiagReplayDrain();
+    for (l_poll_u8 = 0u; (l_poll_u8 < LIN_DIAG_REPLAY_POLLS) && (0u != LinDiag_DefaultChannel.pending_u8); l_poll_u8++) {
+        ApplLinDiagMainFunction();
+        LinDiagReplayDrain();
+    }
+    LinDiagCaptureStart(NULL, 0u);
+
+    resp_ps->found_u8 = 0u;
+    if (E_OK == LinDiagCaptureOpen(LinDiagReplay_Ring_au8, &l_cur_s)) {
+        while (E_OK == LinDiagCaptureNext(LinDiagReplay_Ring_au8, &l_cur_s, &l_rec_s, &l_msg_pu8)) {
+            if (LIN_DIAG_CAPTURE_RESPONSE == l_rec_s.kind_u8) {
+                LinDiagReplayKeep(resp_ps, &l_rec_s, l_msg_pu8);
+            }
+        }
+    }
+}
+
+static void LinDiagReplayPrint(const char *const what_pc, const LinDiagReplayResp_t *const resp_ps)
+{
+    uint16_t l_idx_u16;
+
+    printf("  %-9s", what_pc);
+    if (0u == resp_ps->found_u8) {
+        printf(" none\n");
+        return;
+    }
+    for (l_idx_u16 = 0u; (l_idx_u16 < resp_ps->len_u16) && (l_idx_u16 < 16u); l_idx_u16++) {
+        printf(" %02X", (unsigned)resp_ps->msg_pu8[l_idx_u16]);
+    }
+    printf("%s (%u bytes)\n", (resp_ps->len_u16 > 16u) ? " ..." : "", (unsigned)resp_ps->len_u16);
+}
+
+/* Compare the replay of the request at req_pu8 with the response recorded after it */
+static void LinDiagReplayCheck(const LinDiagCaptureRec_t *const req_ps, const uint8_t *const req_pu8,
+                               const LinDiagReplayResp_t *const rec_ps, LinDiagReplayCount_t *const count_ps)
+{
+    LinDiagReplayResp_t l_got_s;
+    uint16_t l_idx_u16;
+    uint8_t l_same_u8;
+
+    if ((0u == req_ps->len_u16) || (0x22u != req_pu8[0])) {
+        count_ps->skipped_u32++;
+        return;
+    }
+
+    count_ps->requests_u32++;
+    LinDiagReplayRun(req_pu8, req_ps->len_u16, &l_got_s);
+
+    if (0u != LinDiagReplayIsVolatile(req_pu8, req_ps->len_u16)) {
+        count_ps->unchecked_u32++;
+        return;
+    }
+
+    l_same_u8 = (uint8_t)((l_got_s.found_u8 == rec_ps->found_u8) && (l_got_s.len_u16 == rec_ps->len_u16));
+    for (l_idx_u16 = 0u; (0u != l_same_u8) && (0u != rec_ps->found_u8) && (l_idx_u16 < rec_ps->len_u16); l_idx_u16++) {
+        l_same_u8 = (uint8_t)(l_got_s.msg_pu8[l_idx_u16] == rec_ps->msg_pu8[l_idx_u16]);
+    }
+
+    if (0u != l_same_u8) {
+        count_ps->matched_u32++;
+        return;
+    }
+
+    count_ps->mismatched_u32++;
+    printf("mismatch at %u us, NAD %02X, request %u bytes:\n", (unsigned)req_ps->timeUs_u32, (unsigned)req_ps->nad_u8,
+           (unsigned)req_ps->len_u16);
+    LinDiagReplayPrint("recorded", rec_ps);
+    LinDiagReplayPrint("replayed", &l_got_s);
+}
+
+int main(int argc, char **argv)
+{
+    const char *const l_path_pc = (argc > 1) ? argv[1] : LIN_DIAG_CAPTURE_FILE;
+    const LinDiagCaptureHdr_t *l_hdr_ps;
+    LinDiagReplayCount_t l_count_s = { 0u, 0u, 0u, 0u, 0u };
+    LinDiagReplayResp_t l_resp_s = { NULL, 0u, 0u };
+    LinDiagCaptureRec_t l_req_s;
+    LinDiagCaptureRec_t l_rec_s;
+    LinDiagCaptureCursor_t l_cur_s;
+    const uint8_t *l_req_pu8 = NULL;
+    const uint8_t *l_msg_pu8;
+    uint8_t *l_mem_pu8;
+    size_t l_size = 0u;
+
+    l_mem_pu8 = LinDiagReplayLoad(l_path_pc, &l_size);
+    if (NULL == l_mem_pu8) {
+        return 1;
+    }
+    l_hdr_ps = (const LinDiagCaptureHdr_t *)(const void *)l_mem_pu8;
+    if ((l_size < sizeof(LinDiagCaptureHdr_t)) || ((l_size - sizeof(LinDiagCaptureHdr_t)) < l_hdr_ps->size_u32) ||
+        (E_OK != LinDiagCaptureOpen(l_mem_pu8, &l_cur_s))) {
+        fprintf(stderr, "%s: no capture ring\n", l_path_pc);
+        free(l_mem_pu8);
+        return 1;
+    }
+
+    /* State at power-up, once: the recorded session ran on one stack too */
+    diagNodeInit(&diagDefaultNode, 0u);
+    LinDiagChannelInit(&LinDiag_DefaultChannel, pbLinDiagBuffer, pbLinDiagBuffer, LIN_DIAG_NODE_NAD, &diagDefaultNode);
+    diagStatsClear();
+
+    /* A request is checked when the next one (or the end) shows all its recorded responses */
+    while (E_OK == LinDiagCaptureNext(l_mem_pu8, &l_cur_s, &l_rec_s, &l_msg_pu8)) {
+        if (LIN_DIAG_CAPTURE_REQUEST == l_rec_s.kind_u8) {
+            if (NULL != l_req_pu8) {
+                LinDiagReplayCheck(&l_req_s, l_req_pu8, &l_resp_s, &l_count_s);
+            }
+            l_req_s = l_rec_s;
+            l_req_pu8 = l_msg_pu8;
+            l_resp_s.found_u8 = 0u;
+        } else if ((LIN_DIAG_CAPTURE_RESPONSE == l_rec_s.kind_u8) && (NULL != l_req_pu8)) {
+            LinDiagReplayKeep(&l_resp_s, &l_rec_s, l_msg_pu8);
+        } else {
+            /* Response of a request overwritten in the ring */
+        }
+    }
+    if (NULL != l_req_pu8) {
+        LinDiagReplayCheck(&l_req_s, l_req_pu8, &l_resp_s, &l_count_s);
+    }
+
+    printf("%s: %u ReadDataById requests replayed, %u matched, %u mismatched, %u not compared, "
+           "%u other requests skipped, %u records lost\n",
+           l_path_pc, (unsigned)l_count_s.requests_u32, (unsigned)l_count_s.matched_u32,
+           (unsigned)l_count_s.mismatched_u32, (unsigned)l_count_s.unchecked_u32, (unsigned)l_count_s.skipped_u32,
+           (unsigned)l_hdr_ps->lost_u32);
+
+    free(l_mem_pu8);
+    return (0u == l_count_s.mismatched_u32) ? 0 : 1;
+}
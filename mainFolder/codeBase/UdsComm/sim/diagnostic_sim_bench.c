@@ -0,0 +1,209 @@
+/* End-to-end benchmark of the diagnostic stack on the virtual LIN bus.
+ *
+ *   make bench && ./linbench.out [baud] [slot_us] [requests] [nodes] [capture] [log]
+ *
+ * Every scenario sends the same request again and again, each one after an idle
+ * gap that walks the phase of the request against the node task, to the nodes
+ * in turn (NADs from LIN_DIAG_NODE_NAD on, all served by one gateway). Latency is
+ * measured from the end of the last request frame to the end of the last
+ * response frame, in virtual time: the figures depend on the baud rate, the slot
+ * and LIN_DIAG_MAIN_PERIOD_MS, not on the host.
+ *
+ * Columns: frames of one request and of its response, NRC 0x78 per request,
+ * latency, requests and response bytes per second of virtual time, bus load,
+ * negative responses and tester timeouts.
+ *
+ * With "capture" the session is recorded into LIN_DIAG_CAPTURE_FILE (appended to a
+ * previous one), for make capture-replay. With "log" the log points of the stack go
+ * to BINLOG_FILE, drained after every scenario (make -C ../BinLog decode).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "diagnostic_sim_bus.h"
+#include "diagnostic_capture.h"
+#include "BinLog.h"
+
+#define LIN_SIM_DEFAULT_BAUD       19200u
+#define LIN_SIM_DEFAULT_SLOT_US    10000u
+#define LIN_SIM_DEFAULT_REQUESTS   200u
+#define LIN_SIM_DEFAULT_NODES      LIN_DIAG_GATEWAY_NODES
+
+/* Idle gap before a request: walks through one task period in prime steps */
+#define LIN_SIM_GAP_STEP_US        1237u
+
+typedef struct
+{
+    const char   *name_pc;
+    uint8_t       req_au8[8];
+    uint16_t      reqLen_u16;
+} LinSimScenario_t;
+
+static const LinSimScenario_t LinSim_Scenarios_cas[] =
+{
+    { "F201 single frame",     { 0x22u, 0xF2u, 0x01u },                                  3u },
+    { "F190 VIN",              { 0x22u, 0xF1u, 0x90u },                                  3u },
+    { "F201+F308+F400",        { 0x22u, 0xF2u, 0x01u, 0xF3u, 0x08u, 0xF4u, 0x00u },      7u },
+    { "FD00 streamed",         { 0x22u, 0xFDu, 0x00u },                                  3u },
+    { "F410 async",            { 0x22u, 0xF4u, 0x10u },                                  3u },
+    { "FDF0 statistics",       { 0x22u, 0xFDu, 0xF0u },                                  3u },
+    { "19 02 DTC by mask",     { 0x19u, 0x02u, 0xFFu },                                  3u },
+};
+
+#define LIN_SIM_SCENARIO_COUNT     (sizeof(LinSim_Scenarios_cas) / sizeof(LinSim_Scenarios_cas[0]))
+
+static LinSimBus_t    LinSim_Bus_s;
+static LinSimNode_t   LinSim_Node_s;
+static LinSimTester_t LinSim_Tester_s;
+
+static uint32_t LinSimArg(const int argc, char **const argv, const int idx, const uint32_t default_u32)
+{
+    return (argc > idx) ? (uint32_t)strtoul(argv[idx], NULL, 0) : default_u32;
+}
+
+/* Option given after the numeric arguments */
+static int LinSimOption(const int argc, char **const argv, const char *const name_pc)
+{
+    int l_idx;
+
+    for (l_idx = 5; l_idx < argc; l_idx++) {
+        if (0 == strcmp(argv[l_idx], name_pc)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void LinSimRunScenario(const LinSimScenario_t *const scn_ps, const uint32_t requests_u32, const uint8_t nodes_u8)
+{
+    const uint32_t l_startUs_cu32 = LinSim_Bus_s.nowUs_u32;
+    const uint32_t l_busyUs_cu32 = LinSim_Bus_s.busyUs_u32;
+    uint32_t l_min_u32 = 0xFFFFFFFFu;
+    uint32_t l_max_u32 = 0u;
+    uint64_t l_sum_u64 = 0u;
+    uint32_t l_done_u32 = 0u;
+    uint32_t l_timeouts_u32 = 0u;
+    uint32_t l_negative_u32 = 0u;
+    uint32_t l_respBytes_u32 = 0u;
+    uint32_t l_elapsedUs_u32;
+    uint32_t l_idx_u32;
+
+    for (l_idx_u32 = 0u; l_idx_u32 < requests_u32; l_idx_u32++) {
+        LinSimBusIdle(&LinSim_Bus_s, &LinSim_Node_s,
+                      (l_idx_u32 * LIN_SIM_GAP_STEP_US) % (LIN_DIAG_MAIN_PERIOD_MS * 1000u));
+
+        if (E_OK != LinSimTesterRequest(&LinSim_Tester_s, (uint8_t)(LIN_DIAG_NODE_NAD + (l_idx_u32 % nodes_u8)),
+                                        scn_ps->req_au8, scn_ps->reqLen_u16)) {
+            break;
+        }
+        do {
+            LinSimBusSlot(&LinSim_Bus_s, &LinSim_Node_s, &LinSim_Tester_s);
+        } while ((LIN_SIM_TESTER_SENDING == LinSim_Tester_s.state_u8) ||
+                 (LIN_SIM_TESTER_WAITING == LinSim_Tester_s.state_u8));
+
+        if (LIN_SIM_TESTER_DONE == LinSim_Tester_s.state_u8) {
+            const uint32_t l_latUs_cu32 = LinSim_Tester_s.respEndUs_u32 - LinSim_Tester_s.reqEndUs_u32;
+
+            l_min_u32 = (l_latUs_cu32 < l_min_u32) ? l_latUs_cu32 : l_min_u32;
+            l_max_u32 = (l_latUs_cu32 > l_max_u32) ? l_latUs_cu32 : l_max_u32;
+            l_sum_u64 += l_latUs_cu32;
+            l_respBytes_u32 += LinSim_Tester_s.respLen_u16;
+            l_done_u32++;
+            if (0x7Fu == LinSim_Tester_s.resp_au8[0]) {
+                l_negative_u32++;
+            }
+        } else {
+            l_timeouts_u32++;
+        }
+    }
+
+    l_elapsedUs_u32 = LinSim_Bus_s.nowUs_u32 - l_startUs_cu32;
+    if (0u == l_done_u32) {
+        printf("%-20s  no response, %u timeouts\n", scn_ps->name_pc, (unsigned)l_timeouts_u32);
+        return;
+    }
+
+    printf("%-20s %4u %4u %3u %9.2f %9.2f %9.2f %8.2f %9.1f %5.1f %4u %4u\n",
+           scn_ps->name_pc,
+           (unsigned)LinSim_Tester_s.reqFrames_u32,
+           (unsigned)LinSim_Tester_s.respFrames_u32,
+           (unsigned)LinSim_Tester_s.pending_u32,
+           (double)l_min_u32 / 1000.0,
+           ((double)l_sum_u64 / (double)l_done_u32) / 1000.0,
+           (double)l_max_u32 / 1000.0,
+           ((double)l_done_u32 * 1000000.0) / (double)l_elapsedUs_u32,
+           ((double)l_respBytes_u32 * 1000000.0) / (double)l_elapsedUs_u32,
+           ((double)(LinSim_Bus_s.busyUs_u32 - l_busyUs_cu32) * 100.0) / (double)l_elapsedUs_u32,
+           (unsigned)l_negative_u32,
+           (unsigned)l_timeouts_u32);
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t l_baud_cu32 = LinSimArg(argc, argv, 1, LIN_SIM_DEFAULT_BAUD);
+    const uint32_t l_slotUs_cu32 = LinSimArg(argc, argv, 2, LIN_SIM_DEFAULT_SLOT_US);
+    const uint32_t l_requests_cu32 = LinSimArg(argc, argv, 3, LIN_SIM_DEFAULT_REQUESTS);
+    const uint32_t l_nodes_cu32 = LinSimArg(argc, argv, 4, LIN_SIM_DEFAULT_NODES);
+    uint32_t l_total_u32 = 0u;
+    uint32_t l_dropped_u32 = 0u;
+    clock_t l_host_s;
+    size_t l_idx;
+
+    if (E_OK != LinSimBusInit(&LinSim_Bus_s, l_baud_cu32, l_slotUs_cu32)) {
+        fprintf(stderr, "slot of %u us too short for a diagnostic frame at %u baud (needs %u us)\n",
+                (unsigned)l_slotUs_cu32, (unsigned)l_baud_cu32,
+                (unsigned)((LinSimBusFrameUs(&LinSim_Bus_s, LIN_TP_FRAME_SIZE) * LIN_SIM_FRAME_TOLERANCE) / 10u));
+        return 1;
+    }
+
+    if ((0u == l_nodes_cu32) || (l_nodes_cu32 > LIN_DIAG_GATEWAY_NODES) ||
+        (E_OK != LinSimNodeInit(&LinSim_Node_s, LIN_DIAG_NODE_NAD, (uint8_t)l_nodes_cu32))) {
+        fprintf(stderr, "%u nodes: 1 to %u supported\n", (unsigned)l_nodes_cu32, (unsigned)LIN_DIAG_GATEWAY_NODES);
+        return 1;
+    }
+    LinSimTesterInit(&LinSim_Tester_s);
+
+    if (0 != LinSimOption(argc, argv, "log")) {
+        BinLog_Init();
+    }
+    if (0 != LinSimOption(argc, argv, "capture")) {
+        uint8_t *const l_capture_pu8 = diagCaptureBackendMap();
+
+        if (NULL == l_capture_pu8) {
+            fprintf(stderr, "%s: cannot map the capture file\n", LIN_DIAG_CAPTURE_FILE);
+            return 1;
+        }
+        LinDiagCaptureStart(l_capture_pu8, LIN_DIAG_CAPTURE_SIZE);
+    }
+
+    printf("virtual LIN bus: %u baud, slot %u us, frame %u us, task %u ms, %u nodes, %u requests per scenario\n\n",
+           (unsigned)l_baud_cu32, (unsigned)l_slotUs_cu32,
+           (unsigned)LinSimBusFrameUs(&LinSim_Bus_s, LIN_TP_FRAME_SIZE),
+           (unsigned)LIN_DIAG_MAIN_PERIOD_MS, (unsigned)l_nodes_cu32, (unsigned)l_requests_cu32);
+    printf("%-20s %4s %4s %3s %9s %9s %9s %8s %9s %5s %4s %4s\n", "scenario", "reqF", "rspF", "78",
+           "min[ms]", "avg[ms]", "max[ms]", "req/s", "rsp B/s", "load%", "nrc", "tmo");
+
+    l_host_s = clock();
+    for (l_idx = 0u; l_idx < LIN_SIM_SCENARIO_COUNT; l_idx++) {
+        LinSimRunScenario(&LinSim_Scenarios_cas[l_idx], l_requests_cu32, (uint8_t)l_nodes_cu32);
+        if (0 != LinSimOption(argc, argv, "log")) {
+            BinLog_MainFunction();
+        }
+        l_total_u32 += l_requests_cu32;
+    }
+    l_host_s = clock() - l_host_s;
+
+    printf("\nbus: %u master request, %u slave response frames, %u unanswered headers, %u idle slots\n",
+           (unsigned)LinSim_Bus_s.masterReq_u32, (unsigned)LinSim_Bus_s.slaveResp_u32,
+           (unsigned)LinSim_Bus_s.emptyHeaders_u32, (unsigned)LinSim_Bus_s.idleSlots_u32);
+    for (l_idx = 0u; l_idx < LinSim_Node_s.slaveCount_u8; l_idx++) {
+        l_dropped_u32 += LinSim_Node_s.slaves_as[l_idx].queue_s.dropped_u16;
+    }
+    printf("node: %u requests dispatched, %u dropped on a full queue\n", (unsigned)LinSim_Node_s.requests_u32,
+           (unsigned)l_dropped_u32);
+    printf("host: %u requests simulated in %.3f s\n", (unsigned)l_total_u32,
+           (double)l_host_s / (double)CLOCKS_PER_SEC);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "diagnostic_sim_bus.h"
+
+/* Virtual time seen by the stack */
+static uint32_t LinSim_NowUs_u32 = 0u;
+
+/* Statistics clock of the stack on the virtual bus (replaces diagnostic_stats_clock.c) */
+uint32_t diagStatsNow(void)
+{
+    return LinSim_NowUs_u32;
+}
+
+Std_ReturnType LinSimBusInit(LinSimBus_t *const bus_ps, const uint32_t baud_u32, const uint32_t slotUs_u32)
+{
+    bus_ps->baud_u32 = baud_u32;
+    bus_ps->slotUs_u32 = slotUs_u32;
+    bus_ps->nowUs_u32 = 0u;
+    bus_ps->nextTaskUs_u32 = 0u;
+    bus_ps->masterReq_u32 = 0u;
+    bus_ps->slaveResp_u32 = 0u;
+    bus_ps->emptyHeaders_u32 = 0u;
+    bus_ps->idleSlots_u32 = 0u;
+    bus_ps->busyUs_u32 = 0u;
+    LinSim_NowUs_u32 = 0u;
+
+    if ((0u == baud_u32) ||
+        (slotUs_u32 < ((LinSimBusFrameUs(bus_ps, LIN_TP_FRAME_SIZE) * LIN_SIM_FRAME_TOLERANCE) / 10u))) {
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+
+uint32_t LinSimBusFrameUs(const LinSimBus_t *const bus_ps, const uint8_t dataLen_u8)
+{
+    uint32_t l_bits_u32 = LIN_SIM_HEADER_BITS;
+
+    if (0u != dataLen_u8) {
+        l_bits_u32 += LIN_SIM_RESPONSE_BITS((uint32_t)dataLen_u8);
+    }
+    return ((l_bits_u32 * 1000000u) + bus_ps->baud_u32 - 1u) / bus_ps->baud_u32;
+}
+
+/* Node task runs due up to untilUs_u32 */
+static void LinSimBusRunTasks(LinSimBus_t *const bus_ps, LinSimNode_t *const node_ps, const uint32_t untilUs_u32)
+{
+    while ((int32_t)(untilUs_u32 - bus_ps->nextTaskUs_u32) >= 0) {
+        LinSim_NowUs_u32 = bus_ps->nextTaskUs_u32;
+        LinSimNodeTask(node_ps);
+        bus_ps->nextTaskUs_u32 += LIN_DIAG_MAIN_PERIOD_MS * 1000u;
+    }
+}
+
+void LinSimBusSlot(LinSimBus_t *const bus_ps, LinSimNode_t *const node_ps, LinSimTester_t *const tester_ps)
+{
+    const uint32_t l_frameUs_cu32 = LinSimBusFrameUs(bus_ps, LIN_TP_FRAME_SIZE);
+    const uint32_t l_frameEndUs_cu32 = bus_ps->nowUs_u32 + l_frameUs_cu32;
+    uint8_t l_frame_au8[LIN_TP_FRAME_SIZE];
+
+    LinSimBusRunTasks(bus_ps, node_ps, bus_ps->nowUs_u32);
+    LinSim_NowUs_u32 = bus_ps->nowUs_u32;
+    LinSimTesterCheckTimeout(tester_ps, bus_ps->nowUs_u32);
+
+    if (E_OK == LinSimTesterGetMasterReq(tester_ps, l_frame_au8, l_frameEndUs_cu32)) {
+        /* 0x3C: the frame is taken over by the node once its checksum is in,
+         * task runs during the frame still see the previous state
+         */
+        LinSimBusRunTasks(bus_ps, node_ps, l_frameEndUs_cu32 - 1u);
+        bus_ps->masterReq_u32++;
+        bus_ps->busyUs_u32 += l_frameUs_cu32;
+        LinSim_NowUs_u32 = l_frameEndUs_cu32;
+        LinSimNodeMasterReq(node_ps, l_frame_au8);
+    } else if (LIN_SIM_TESTER_WAITING == tester_ps->state_u8) {
+        /* 0x3D: the node answers the header only when it has something to send */
+        if (E_OK == LinSimNodeSlaveResp(node_ps, l_frame_au8)) {
+            bus_ps->slaveResp_u32++;
+            bus_ps->busyUs_u32 += l_frameUs_cu32;
+            LinSimTesterSlaveResp(tester_ps, l_frame_au8, l_frameEndUs_cu32);
+        } else {
+            bus_ps->emptyHeaders_u32++;
+            bus_ps->busyUs_u32 += LinSimBusFrameUs(bus_ps, 0u);
+        }
+    } else {
+        bus_ps->idleSlots_u32++;
+    }
+
+    bus_ps->nowUs_u32 += bus_ps->slotUs_u32;
+}
+
+void LinSimBusIdle(LinSimBus_t *const bus_ps, LinSimNode_t *const node_ps, const uint32_t idleUs_u32)
+{
+    bus_ps->nowUs_u32 += idleUs_u32;
+    LinSimBusRunTasks(bus_ps, node_ps, bus_ps->nowUs_u32 - 1u);
+}
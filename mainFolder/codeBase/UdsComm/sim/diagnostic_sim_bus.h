@@ -0,0 +1,49 @@
+
+#ifndef DIAGNOSTIC_SIM_BUS_H
+#define DIAGNOSTIC_SIM_BUS_H
+
+#include "diagnostic_sim_node.h"
+#include "diagnostic_sim_tester.h"
+
+/* Frame identifiers of the diagnostic frames */
+#define LIN_SIM_ID_MASTER_REQ      ((uint8_t)0x3Cu)
+#define LIN_SIM_ID_SLAVE_RESP      ((uint8_t)0x3Du)
+
+/* Nominal frame length in bits (LIN 2.x): break, sync and PID, then data and checksum.
+ * A frame may take up to 40 % more (inter-byte space, response space).
+ */
+#define LIN_SIM_HEADER_BITS        34u
+#define LIN_SIM_RESPONSE_BITS(n)   (10u * ((n) + 1u))
+#define LIN_SIM_FRAME_TOLERANCE    14u    /* Tenths: T_frame_max = 1.4 * T_frame_nominal */
+
+/* Virtual LIN bus: one master (the tester) and one slave node, driven by a schedule
+ * of fixed slots. A slot carries a master request frame when the tester has one,
+ * a slave response header while the tester waits for a response, nothing otherwise.
+ * The node task runs every LIN_DIAG_MAIN_PERIOD_MS of virtual time.
+ */
+typedef struct
+{
+    uint32_t baud_u32;
+    uint32_t slotUs_u32;           /* Schedule slot, at least T_frame_max of a diagnostic frame */
+    uint32_t nowUs_u32;            /* Virtual time, start of the next slot */
+    uint32_t nextTaskUs_u32;       /* Next run of the node task */
+    uint32_t masterReq_u32;        /* Master request frames */
+    uint32_t slaveResp_u32;        /* Slave response frames */
+    uint32_t emptyHeaders_u32;     /* Slave response headers the node did not answer */
+    uint32_t idleSlots_u32;
+    uint32_t busyUs_u32;           /* Time the bus carried bits */
+} LinSimBus_t;
+
+/* E_NOT_OK when a diagnostic frame does not fit the slot at this baud rate */
+Std_ReturnType LinSimBusInit(LinSimBus_t *const bus_ps, const uint32_t baud_u32, const uint32_t slotUs_u32);
+
+/* Nominal duration of a frame header followed by dataLen_u8 data bytes (0: header only) */
+uint32_t LinSimBusFrameUs(const LinSimBus_t *const bus_ps, const uint8_t dataLen_u8);
+
+/* Run one schedule slot */
+void LinSimBusSlot(LinSimBus_t *const bus_ps, LinSimNode_t *const node_ps, LinSimTester_t *const tester_ps);
+
+/* Schedule entry without frame, idleUs_u32 long: the node task keeps running */
+void LinSimBusIdle(LinSimBus_t *const bus_ps, LinSimNode_t *const node_ps, const uint32_t idleUs_u32);
+
+#endif
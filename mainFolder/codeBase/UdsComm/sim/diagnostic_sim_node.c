@@ -0,0 +1,62 @@
+#include "diagnostic_sim_node.h"
+#include <stddef.h>
+
+Std_ReturnType LinSimNodeInit(LinSimNode_t *const node_ps, const uint8_t firstNad_u8, const uint8_t count_u8)
+{
+    uint8_t l_idx_u8;
+
+    LinDiagGatewayInit(&node_ps->gw_s);
+    node_ps->slaveCount_u8 = 0u;
+    node_ps->requests_u32 = 0u;
+
+    if ((count_u8 > LIN_DIAG_GATEWAY_NODES) ||
+        (E_OK != LinDiagDispatchInit(&node_ps->disp_s, LinDiagServices_cas, LinDiagServiceCount_u8))) {
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < count_u8; l_idx_u8++) {
+        LinSimSlave_t *const l_slave_ps = &node_ps->slaves_as[l_idx_u8];
+
+        diagNodeInit(&l_slave_ps->node_s, l_idx_u8);
+        LinDiagChannelInit(&l_slave_ps->ch_s, l_slave_ps->req_au8, l_slave_ps->resp_au8,
+                           (uint8_t)(firstNad_u8 + l_idx_u8), &l_slave_ps->node_s);
+        LinDiagPeriodicInit(&l_slave_ps->periodic_s);
+        l_slave_ps->ch_s.periodic_ps = &l_slave_ps->periodic_s;
+        LinDiagQueueInit(&l_slave_ps->queue_s);
+        if (E_OK != LinDiagGatewayAddNode(&node_ps->gw_s, &l_slave_ps->ch_s)) {
+            return E_NOT_OK;
+        }
+        node_ps->slaveCount_u8++;
+    }
+    return E_OK;
+}
+
+void LinSimNodeMasterReq(LinSimNode_t *const node_ps, const uint8_t *const frame_pu8)
+{
+    /* Gateway node indexes follow slaves_as */
+    const uint8_t l_node_cu8 = LinDiagGatewaySelectNode(&node_ps->gw_s, frame_pu8[0]);
+
+    if (LIN_DIAG_GATEWAY_NO_NODE != l_node_cu8) {
+        (void)LinDiagQueueRxFrame(&node_ps->slaves_as[l_node_cu8].queue_s, frame_pu8);
+    }
+}
+
+Std_ReturnType LinSimNodeSlaveResp(LinSimNode_t *const node_ps, uint8_t *const frame_pu8)
+{
+    return LinDiagGatewayGetTxFrame(&node_ps->gw_s, frame_pu8);
+}
+
+void LinSimNodeTask(LinSimNode_t *const node_ps)
+{
+    uint8_t l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < node_ps->slaveCount_u8; l_idx_u8++) {
+        LinSimSlave_t *const l_slave_ps = &node_ps->slaves_as[l_idx_u8];
+
+        node_ps->requests_u32 += LinDiagQueueDrain(&l_slave_ps->queue_s, &node_ps->disp_s, &l_slave_ps->ch_s,
+                                                   LIN_DIAG_QUEUE_SIZE);
+        (void)LinDiagMainFunction(&l_slave_ps->ch_s);
+        LinDiagPeriodicMainFunction(&l_slave_ps->periodic_s, &l_slave_ps->ch_s);
+        diagDidCacheMainFunction(&l_slave_ps->node_s);
+    }
+}
@@ -0,0 +1,51 @@
+
+#ifndef DIAGNOSTIC_SIM_NODE_H
+#define DIAGNOSTIC_SIM_NODE_H
+
+#include "diagnostic.h"
+#include "diagnostic_periodic.h"
+#include "diagnostic_gateway.h"
+#include "diagnostic_dispatch.h"
+#include "diagnostic_queue.h"
+#include "diagnostic_cfg_priv.h"
+
+/* One slave node: a diagnostic channel with its own buffers, request queue, periodic scheduler
+ * and DID context, the channel points at the last two.
+ */
+typedef struct
+{
+    LinDiag_Channel_t ch_s;
+    LinDiagPeriodic_t periodic_s;
+    uint8_t           req_au8[LIN_DIAG_BUFFER_SIZE];
+    uint8_t           resp_au8[LIN_DIAG_BUFFER_SIZE];
+    LinDiagQueue_t    queue_s;         /* Requests received, waiting for the node task */
+    diagNode_t        node_s;          /* Dynamic DIDs, caches, VIN and fault memory of this node only */
+} LinSimSlave_t;
+
+/* Slave side of the virtual bus: up to LIN_DIAG_GATEWAY_NODES nodes served by one
+ * stack through the gateway, with the service table of the product. Master request frames are reassembled
+ * into the queue of the addressed node, as the receive interrupt of the target does; the
+ * node task serves the queued requests back to back, each once the previous response is out.
+ */
+typedef struct
+{
+    LinDiagGateway_t  gw_s;
+    LinDiagDispatch_t disp_s;
+    LinSimSlave_t     slaves_as[LIN_DIAG_GATEWAY_NODES];
+    uint8_t           slaveCount_u8;
+    uint32_t          requests_u32;    /* Requests dispatched, refused ones included */
+} LinSimNode_t;
+
+/* Nodes with NADs firstNad_u8 .. firstNad_u8 + count_u8 - 1, E_NOT_OK if one cannot be served */
+Std_ReturnType LinSimNodeInit(LinSimNode_t *const node_ps, const uint8_t firstNad_u8, const uint8_t count_u8);
+
+/* Master request frame received */
+void LinSimNodeMasterReq(LinSimNode_t *const node_ps, const uint8_t *const frame_pu8);
+
+/* Slave response header received: E_OK when frame_pu8 holds the answer, E_NOT_OK when the nodes stay silent */
+Std_ReturnType LinSimNodeSlaveResp(LinSimNode_t *const node_ps, uint8_t *const frame_pu8);
+
+/* Node task, every LIN_DIAG_MAIN_PERIOD_MS: dispatch the queued requests, then the main functions */
+void LinSimNodeTask(LinSimNode_t *const node_ps);
+
+#endif
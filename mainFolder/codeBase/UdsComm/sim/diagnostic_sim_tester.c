@@ -0,0 +1,98 @@
+#include "diagnostic_sim_tester.h"
+#include <stddef.h>
+
+/* Response timeouts of the tester: server timing plus the delay of the slave response headers */
+#define LIN_SIM_TESTER_P2_US       ((uint32_t)(LIN_DIAG_P2_MS * 2u) * 1000u)
+#define LIN_SIM_TESTER_P2STAR_US   ((uint32_t)(LIN_DIAG_P2STAR_MS + LIN_DIAG_P2_MS) * 1000u)
+
+void LinSimTesterInit(LinSimTester_t *const tester_ps)
+{
+    LinDiagTpInit(&tester_ps->tx_s, &tester_ps->rx_s);
+    tester_ps->respLen_u16 = 0u;
+    tester_ps->nad_u8 = 0u;
+    tester_ps->state_u8 = LIN_SIM_TESTER_IDLE;
+    tester_ps->reqFrames_u32 = 0u;
+    tester_ps->respFrames_u32 = 0u;
+    tester_ps->pending_u32 = 0u;
+    tester_ps->reqEndUs_u32 = 0u;
+    tester_ps->respEndUs_u32 = 0u;
+    tester_ps->deadlineUs_u32 = 0u;
+}
+
+Std_ReturnType LinSimTesterRequest(LinSimTester_t *const tester_ps, const uint8_t nad_u8, const uint8_t *const req_pu8,
+    const uint16_t len_u16)
+{
+    uint16_t l_idx_u16;
+
+    if ((LIN_SIM_TESTER_SENDING == tester_ps->state_u8) || (LIN_SIM_TESTER_WAITING == tester_ps->state_u8) ||
+        (len_u16 > LIN_TP_MAX_LENGTH)) {
+        return E_NOT_OK;
+    }
+
+    /* The transport layer reads the request in place while framing it */
+    for (l_idx_u16 = 0u; l_idx_u16 < len_u16; l_idx_u16++) {
+        tester_ps->req_au8[l_idx_u16] = req_pu8[l_idx_u16];
+    }
+
+    if (E_OK != LinDiagTpStartTx(&tester_ps->tx_s, nad_u8, tester_ps->req_au8, len_u16, NULL, 0u)) {
+        return E_NOT_OK;
+    }
+
+    tester_ps->nad_u8 = nad_u8;
+    tester_ps->respLen_u16 = 0u;
+    tester_ps->reqFrames_u32 = 0u;
+    tester_ps->respFrames_u32 = 0u;
+    tester_ps->pending_u32 = 0u;
+    tester_ps->state_u8 = LIN_SIM_TESTER_SENDING;
+    return E_OK;
+}
+
+Std_ReturnType LinSimTesterGetMasterReq(LinSimTester_t *const tester_ps, uint8_t *const frame_pu8, const uint32_t endUs_u32)
+{
+    if ((LIN_SIM_TESTER_SENDING != tester_ps->state_u8) ||
+        (E_OK != LinDiagTpGetTxFrame(&tester_ps->tx_s, frame_pu8))) {
+        return E_NOT_OK;
+    }
+
+    tester_ps->reqFrames_u32++;
+    if (E_OK != LinDiagTpIsTxBusy(&tester_ps->tx_s)) {
+        tester_ps->state_u8 = LIN_SIM_TESTER_WAITING;
+        tester_ps->reqEndUs_u32 = endUs_u32;
+        tester_ps->deadlineUs_u32 = endUs_u32 + LIN_SIM_TESTER_P2_US;
+    }
+    return E_OK;
+}
+
+void LinSimTesterSlaveResp(LinSimTester_t *const tester_ps, const uint8_t *const frame_pu8, const uint32_t endUs_u32)
+{
+    if (LIN_SIM_TESTER_WAITING != tester_ps->state_u8) {
+        return;
+    }
+
+    tester_ps->respFrames_u32++;
+    tester_ps->deadlineUs_u32 = endUs_u32 + LIN_SIM_TESTER_P2_US;
+
+    if (E_OK != LinDiagTpRxFrame(&tester_ps->rx_s, NULL, frame_pu8, tester_ps->resp_au8,
+                                 (uint16_t)sizeof(tester_ps->resp_au8), &tester_ps->respLen_u16)) {
+        return;
+    }
+
+    /* NRC 0x78: the final response follows within P2* */
+    if ((3u == tester_ps->respLen_u16) && (0x7Fu == tester_ps->resp_au8[0]) &&
+        (kLinDiagNrcResponsePending == tester_ps->resp_au8[2])) {
+        tester_ps->pending_u32++;
+        tester_ps->deadlineUs_u32 = endUs_u32 + LIN_SIM_TESTER_P2STAR_US;
+        return;
+    }
+
+    tester_ps->respEndUs_u32 = endUs_u32;
+    tester_ps->state_u8 = LIN_SIM_TESTER_DONE;
+}
+
+void LinSimTesterCheckTimeout(LinSimTester_t *const tester_ps, const uint32_t nowUs_u32)
+{
+    if ((LIN_SIM_TESTER_WAITING == tester_ps->state_u8) &&
+        ((int32_t)(nowUs_u32 - tester_ps->deadlineUs_u32) > 0)) {
+        tester_ps->state_u8 = LIN_SIM_TESTER_TIMEOUT;
+    }
+}
@@ -0,0 +1,48 @@
+
+#ifndef DIAGNOSTIC_SIM_TESTER_H
+#define DIAGNOSTIC_SIM_TESTER_H
+
+#include "diagnostic_tp.h"
+
+#define LIN_SIM_TESTER_IDLE        ((uint8_t)0u)
+#define LIN_SIM_TESTER_SENDING     ((uint8_t)1u)   /* Request frames left */
+#define LIN_SIM_TESTER_WAITING     ((uint8_t)2u)   /* Request sent, response not complete */
+#define LIN_SIM_TESTER_DONE        ((uint8_t)3u)   /* Final response in resp_au8 */
+#define LIN_SIM_TESTER_TIMEOUT     ((uint8_t)4u)   /* No final response within P2 / P2* */
+
+/* Tester on the virtual bus: segments a request with the transport layer of the stack,
+ * reassembles the response and timestamps both ends.
+ */
+typedef struct
+{
+    LinDiagTpTx_t tx_s;
+    LinDiagTpRx_t rx_s;
+    uint8_t       req_au8[LIN_TP_MAX_LENGTH];
+    uint8_t       resp_au8[LIN_TP_MAX_LENGTH];
+    uint16_t      respLen_u16;
+    uint8_t       nad_u8;            /* Node of the last request */
+    uint8_t       state_u8;
+    uint32_t      reqFrames_u32;     /* Frames of the last request */
+    uint32_t      respFrames_u32;    /* Frames of the last response, NRC 0x78 included */
+    uint32_t      pending_u32;       /* NRC 0x78 received for the last request */
+    uint32_t      reqEndUs_u32;      /* End of the last request frame */
+    uint32_t      respEndUs_u32;     /* End of the last response frame */
+    uint32_t      deadlineUs_u32;    /* Timeout of the response in progress */
+} LinSimTester_t;
+
+void LinSimTesterInit(LinSimTester_t *const tester_ps);
+
+/* Start a request to node nad_u8, E_NOT_OK while the previous one is in progress */
+Std_ReturnType LinSimTesterRequest(LinSimTester_t *const tester_ps, const uint8_t nad_u8, const uint8_t *const req_pu8,
+    const uint16_t len_u16);
+
+/* Next master request frame, E_NOT_OK when the request is sent. endUs_u32: end of that frame */
+Std_ReturnType LinSimTesterGetMasterReq(LinSimTester_t *const tester_ps, uint8_t *const frame_pu8, const uint32_t endUs_u32);
+
+/* Slave response frame received at endUs_u32 */
+void LinSimTesterSlaveResp(LinSimTester_t *const tester_ps, const uint8_t *const frame_pu8, const uint32_t endUs_u32);
+
+/* Give up the response when nothing arrived before the deadline */
+void LinSimTesterCheckTimeout(LinSimTester_t *const tester_ps, const uint32_t nowUs_u32);
+
+#endif
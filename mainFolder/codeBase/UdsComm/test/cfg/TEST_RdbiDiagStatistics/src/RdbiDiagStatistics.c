@@ -0,0 +1,241 @@
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+/* Services followed by the statistics, responses of other SIDs are not counted */
+static const uint8 diagStatsSids_cau8[] = { 0x19u, 0x22u, 0x23u, 0x2Au, 0x2Cu, 0x2Eu };
+#define DIAG_STATS_SID_COUNT               ((uint8)(sizeof(diagStatsSids_cau8) / sizeof(diagStatsSids_cau8[0])))
+
+/* NRCs counted one by one, the last bin counts any other NRC */
+static const uint8 diagStatsNrcs_cau8[] =
+{
+    kLinDiagNrcGeneralReject, kLinDiagNrcSubFunctionNotSupported, kLinDiagNrcIncorrectMsgLength,
+    kLinDiagNrcResponseTooLong, kLinDiagNrcConditionsNotCorrect, kLinDiagNrcRequestOutOfRange,
+    kLinDiagNrcResponsePending
+};
+#define DIAG_STATS_NRC_BINS                ((uint8)((sizeof(diagStatsNrcs_cau8) / sizeof(diagStatsNrcs_cau8[0])) + 1u))
+
+/* Counters saturate at 0xFFFF, times are in microseconds */
+typedef struct
+{
+    uint16   requests_u16;
+    uint16   positive_u16;
+    uint16   negative_u16;
+    uint8    lastNrc_u8;
+    uint32_t maxUs_u32;
+    uint16   hist_au16[LIN_DIAG_STATS_HIST_BINS];
+} diagStatsDid_t;
+
+typedef struct
+{
+    uint16   positive_u16;
+    uint16   negative_au16[DIAG_STATS_NRC_BINS];
+    uint32_t maxUs_u32;
+    uint16   hist_au16[LIN_DIAG_STATS_HIST_BINS];
+} diagStatsService_t;
+
+/* Readout, big-endian:
+ *   DID entries, services, histogram bins, NRC bins, the NRCs of all bins but the last one
+ *   per DID table entry: first DID, requests, positive, negative, last NRC, max time (4), bins
+ *   per service: SID, positive, negative per NRC bin, max time (4), bins
+ */
+#define DIAG_STATS_DID_RECORD_SIZE         (13u + (2u * LIN_DIAG_STATS_HIST_BINS))
+#define DIAG_STATS_SVC_RECORD_SIZE         (7u + (2u * DIAG_STATS_NRC_BINS) + (2u * LIN_DIAG_STATS_HIST_BINS))
+#define DIAG_STATS_READOUT_SIZE            (4u + (DIAG_STATS_NRC_BINS - 1u) + \
+                                            (DIAG_DID_TABLE_SIZE * DIAG_STATS_DID_RECORD_SIZE) + \
+                                            (DIAG_STATS_SID_COUNT * DIAG_STATS_SVC_RECORD_SIZE))
+
+_Static_assert(DIAG_STATS_READOUT_SIZE <= DID_FDF0_SIZE, "DIAG_STATISTICS: readout larger than the DID");
+_Static_assert(DIAG_STATS_READOUT_SIZE <= DIAG_STREAM_DATA_SIZE, "DIAG_STATISTICS: readout larger than the stream buffer");
+
+/* Shared by every channel, updated without lock: the channels are all served by one task */
+static diagStatsDid_t diagStatsDids_as[DIAG_DID_TABLE_SIZE];
+static diagStatsService_t diagStatsServices_as[DIAG_STATS_SID_COUNT];
+
+static void diagStatsInc(uint16 *const count_pu16)
+{
+    if (*count_pu16 < 0xFFFFu)
+    {
+        (*count_pu16)++;
+    }
+}
+
+/* Add elapsed_u32 to a histogram whose bin 0 ends at 2^shift_u8 */
+static void diagStatsAddTime(uint16 *const hist_pu16, uint32_t *const max_pu32, const uint32_t elapsed_u32,
+    const uint8 shift_u8)
+{
+    uint32_t l_scaled_u32 = elapsed_u32 >> shift_u8;
+    uint8 l_bin_u8 = 0u;
+
+    while ((0u != l_scaled_u32) && (l_bin_u8 < (LIN_DIAG_STATS_HIST_BINS - 1u)))
+    {
+        l_bin_u8++;
+        l_scaled_u32 >>= 1;
+    }
+
+    diagStatsInc(&hist_pu16[l_bin_u8]);
+    if (elapsed_u32 > *max_pu32)
+    {
+        *max_pu32 = elapsed_u32;
+    }
+}
+
+void diagStatsDidDone(const diagDidEntry_t *const entry_ps, const uint8 opStatus_u8, const Std_ReturnType result_,
+    const uint8 nrc_u8, const uint32_t start_u32)
+{
+    /* Same table order as diagDidTable: no search */
+    diagStatsDid_t *const l_stats_ps = &diagStatsDids_as[entry_ps - diagDidTable];
+
+    if (DIAG_OPSTATUS_CANCEL == opStatus_u8)
+    {
+        return;
+    }
+
+    if (DIAG_OPSTATUS_INITIAL == opStatus_u8)
+    {
+        diagStatsInc(&l_stats_ps->requests_u16);
+    }
+
+    diagStatsAddTime(l_stats_ps->hist_au16, &l_stats_ps->maxUs_u32, (uint32_t)(diagStatsNow() - start_u32),
+                     LIN_DIAG_STATS_DID_HIST_SHIFT);
+
+    if (E_OK == result_)
+    {
+        diagStatsInc(&l_stats_ps->positive_u16);
+    }
+    else if (DIAG_E_PENDING != result_)
+    {
+        diagStatsInc(&l_stats_ps->negative_u16);
+        l_stats_ps->lastNrc_u8 = nrc_u8;
+    }
+    else
+    {
+        /* Outcome counted when the handler completes */
+    }
+}
+
+void diagStatsServiceDone(uint8 l_sid_u8, uint8 l_nrc_u8, uint32_t l_start_u32)
+{
+    const uint32_t l_elapsed_u32 = (uint32_t)(diagStatsNow() - l_start_u32);
+    diagStatsService_t *l_stats_ps = NULL;
+    uint8 l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < DIAG_STATS_SID_COUNT; l_idx_u8++)
+    {
+        if (l_sid_u8 == diagStatsSids_cau8[l_idx_u8])
+        {
+            l_stats_ps = &diagStatsServices_as[l_idx_u8];
+            break;
+        }
+    }
+
+    if (NULL == l_stats_ps)
+    {
+        return;
+    }
+
+    diagStatsAddTime(l_stats_ps->hist_au16, &l_stats_ps->maxUs_u32, l_elapsed_u32, LIN_DIAG_STATS_SVC_HIST_SHIFT);
+
+    if (0u == l_nrc_u8)
+    {
+        diagStatsInc(&l_stats_ps->positive_u16);
+        return;
+    }
+
+    /* Not found: l_idx_u8 ends on the last bin */
+    for (l_idx_u8 = 0u; l_idx_u8 < (DIAG_STATS_NRC_BINS - 1u); l_idx_u8++)
+    {
+        if (l_nrc_u8 == diagStatsNrcs_cau8[l_idx_u8])
+        {
+            break;
+        }
+    }
+    diagStatsInc(&l_stats_ps->negative_au16[l_idx_u8]);
+}
+
+void diagStatsClear(void)
+{
+    uint8 *const l_dids_pu8 = (uint8 *)diagStatsDids_as;
+    uint8 *const l_services_pu8 = (uint8 *)diagStatsServices_as;
+    uint16 l_idx_u16;
+
+    for (l_idx_u16 = 0u; l_idx_u16 < sizeof(diagStatsDids_as); l_idx_u16++)
+    {
+        l_dids_pu8[l_idx_u16] = 0u;
+    }
+    for (l_idx_u16 = 0u; l_idx_u16 < sizeof(diagStatsServices_as); l_idx_u16++)
+    {
+        l_services_pu8[l_idx_u16] = 0u;
+    }
+}
+
+static uint8 *diagStatsPut16(uint8 *const out_pu8, const uint16 value_u16)
+{
+    out_pu8[0] = (uint8)(value_u16 >> 8);
+    out_pu8[1] = (uint8)value_u16;
+    return &out_pu8[2];
+}
+
+static uint8 *diagStatsPutTimes(uint8 *out_pu8, const uint32_t max_u32, const uint16 *const hist_pu16)
+{
+    uint8 l_bin_u8;
+
+    out_pu8 = diagStatsPut16(out_pu8, (uint16)(max_u32 >> 16));
+    out_pu8 = diagStatsPut16(out_pu8, (uint16)max_u32);
+    for (l_bin_u8 = 0u; l_bin_u8 < LIN_DIAG_STATS_HIST_BINS; l_bin_u8++)
+    {
+        out_pu8 = diagStatsPut16(out_pu8, hist_pu16[l_bin_u8]);
+    }
+    return out_pu8;
+}
+
+/* Snapshot built in the stream buffer of the node: counters keep running while it is transmitted,
+ * a readout on another channel does not overwrite it
+ */
+Std_ReturnType RdbiDiagStatistics_(uint8*const buffer_pu8, const uint8 **const data_ppu8, uint16*const length_pu16,
+    uint8* const errCode_pu8)
+{
+    uint8 *l_out_pu8 = buffer_pu8;
+    uint8 l_idx_u8;
+
+    (void)errCode_pu8;
+
+    *l_out_pu8++ = (uint8)DIAG_DID_TABLE_SIZE;
+    *l_out_pu8++ = DIAG_STATS_SID_COUNT;
+    *l_out_pu8++ = (uint8)LIN_DIAG_STATS_HIST_BINS;
+    *l_out_pu8++ = DIAG_STATS_NRC_BINS;
+    for (l_idx_u8 = 0u; l_idx_u8 < (DIAG_STATS_NRC_BINS - 1u); l_idx_u8++)
+    {
+        *l_out_pu8++ = diagStatsNrcs_cau8[l_idx_u8];
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < DIAG_DID_TABLE_SIZE; l_idx_u8++)
+    {
+        const diagStatsDid_t *const l_stats_ps = &diagStatsDids_as[l_idx_u8];
+
+        l_out_pu8 = diagStatsPut16(l_out_pu8, diagDidKeys_cau16[l_idx_u8]);
+        l_out_pu8 = diagStatsPut16(l_out_pu8, l_stats_ps->requests_u16);
+        l_out_pu8 = diagStatsPut16(l_out_pu8, l_stats_ps->positive_u16);
+        l_out_pu8 = diagStatsPut16(l_out_pu8, l_stats_ps->negative_u16);
+        *l_out_pu8++ = l_stats_ps->lastNrc_u8;
+        l_out_pu8 = diagStatsPutTimes(l_out_pu8, l_stats_ps->maxUs_u32, l_stats_ps->hist_au16);
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < DIAG_STATS_SID_COUNT; l_idx_u8++)
+    {
+        const diagStatsService_t *const l_stats_ps = &diagStatsServices_as[l_idx_u8];
+        uint8 l_nrc_u8;
+
+        *l_out_pu8++ = diagStatsSids_cau8[l_idx_u8];
+        l_out_pu8 = diagStatsPut16(l_out_pu8, l_stats_ps->positive_u16);
+        for (l_nrc_u8 = 0u; l_nrc_u8 < DIAG_STATS_NRC_BINS; l_nrc_u8++)
+        {
+            l_out_pu8 = diagStatsPut16(l_out_pu8, l_stats_ps->negative_au16[l_nrc_u8]);
+        }
+        l_out_pu8 = diagStatsPutTimes(l_out_pu8, l_stats_ps->maxUs_u32, l_stats_ps->hist_au16);
+    }
+
+    *data_ppu8 = buffer_pu8;
+    *length_pu16 = (uint16)DIAG_STATS_READOUT_SIZE;
+    return E_OK;
+}
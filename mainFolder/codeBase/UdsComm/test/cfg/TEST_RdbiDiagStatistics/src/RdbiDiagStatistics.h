@@ -0,0 +1,17 @@
+
+#ifndef RDBI_DIAG_STATISTICS_H
+#define RDBI_DIAG_STATISTICS_H
+
+#include "diagnostic_cfg_priv.h"
+
+void diagStatsDidDone(const diagDidEntry_t *const entry_ps, const uint8 opStatus_u8, const Std_ReturnType result_,
+    const uint8 nrc_u8, const uint32_t start_u32);
+
+void diagStatsServiceDone(uint8 l_sid_u8, uint8 l_nrc_u8, uint32_t l_start_u32);
+
+void diagStatsClear(void);
+
+Std_ReturnType RdbiDiagStatistics_(uint8*const buffer_pu8, const uint8 **const data_ppu8, uint16*const length_pu16,
+    uint8* const errCode_pu8);
+
+#endif
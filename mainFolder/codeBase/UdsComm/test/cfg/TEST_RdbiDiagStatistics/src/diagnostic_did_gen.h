@@ -0,0 +1,97 @@
+/*
+ * GENERATED FILE - DO NOT EDIT.
+ * Source : diagnostic_did.csv
+ * Tool   : tools/didCfgGen.py
+ */
+
+#ifndef DIAGNOSTIC_DID_GEN_H
+#define DIAGNOSTIC_DID_GEN_H
+
+#include "diagnostic_cfg.h"
+
+#define DIAG_DID_TABLE_SIZE 8u
+
+#define DID_F190_FIRST 0xF190u
+#define DID_F190_LAST 0xF190u
+#define DID_F201_FIRST 0xF201u
+#define DID_F201_LAST 0xF201u
+#define DID_F308_FIRST 0xF308u
+#define DID_F308_LAST 0xF308u
+#define DID_F400_F40F_FIRST 0xF400u
+#define DID_F400_F40F_LAST 0xF40Fu
+#define DID_F410_FIRST 0xF410u
+#define DID_F410_LAST 0xF410u
+#define DID_F420_FIRST 0xF420u
+#define DID_F420_LAST 0xF420u
+#define DID_FD00_FIRST 0xFD00u
+#define DID_FD00_LAST 0xFD00u
+#define DID_FDF0_FIRST 0xFDF0u
+#define DID_FDF0_LAST 0xFDF0u
+
+#define DID_F190_SIZE 17U
+#define DID_F201_SIZE 1U
+#define DID_F308_SIZE 1U
+#define DID_F400_F40F_SIZE 1U
+#define DID_F410_SIZE 2U
+#define DID_F420_SIZE 1U
+#define DID_FD00_SIZE 256U
+#define DID_FDF0_SIZE 512U
+
+#define DIAG_NVM_BLOCK_COUNT 1u
+#define DIAG_NVM_F190_OFFSET 0u
+#define DIAG_NVM_IMAGE_SIZE 17u
+
+#define DIAG_DID_F190_RAM 0u
+#define DIAG_DID_RAM_SIZE 17u
+#define DIAG_CACHE_SLOT_COUNT 16u
+#define DIAG_CACHE_DATA_SIZE 16u
+#define DIAG_STREAM_DATA_SIZE 512u
+
+_Static_assert(DIAG_NVM_BLOCK_COUNT < DIAG_NVM_NO_BLOCK, "too many persisted DIDs");
+_Static_assert(DID_F190_SIZE <= (LIN_DIAG_BUFFER_SIZE - 3u), "VIN: write request does not fit pbLinDiagBuffer");
+
+_Static_assert(DID_F190_SIZE <= (LIN_TP_MAX_LENGTH - 3u), "VIN: response exceeds the transport layer limit");
+_Static_assert(DID_F201_SIZE <= (LIN_TP_MAX_LENGTH - 3u), "PDID_01_OVERVOLT_FLAG: response exceeds the transport layer limit");
+_Static_assert(DID_F308_SIZE <= (LIN_TP_MAX_LENGTH - 3u), "IS_OVERVOLT_FLAG: response exceeds the transport layer limit");
+_Static_assert(DID_F400_F40F_SIZE <= (LIN_DIAG_BUFFER_SIZE - 3u), "CHANNEL_STATUS: response does not fit pbLinDiagBuffer");
+_Static_assert(DID_F410_SIZE <= (LIN_DIAG_BUFFER_SIZE - 3u), "EEPROM_CHECKSUM: response does not fit pbLinDiagBuffer");
+_Static_assert(DID_F420_SIZE <= (LIN_DIAG_BUFFER_SIZE - 3u), "SUPPLY_VOLTAGE: response does not fit pbLinDiagBuffer");
+_Static_assert(DID_FD00_SIZE <= (LIN_TP_MAX_LENGTH - 3u), "CALIBRATION_DUMP: response exceeds the transport layer limit");
+_Static_assert(DID_FDF0_SIZE <= (LIN_TP_MAX_LENGTH - 3u), "DIAG_STATISTICS: response exceeds the transport layer limit");
+_Static_assert((DID_F190_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_F190_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "VIN: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_F201_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_F201_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "PDID_01_OVERVOLT_FLAG: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_F308_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_F308_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "IS_OVERVOLT_FLAG: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_F400_F40F_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_F400_F40F_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "CHANNEL_STATUS: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_F410_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_F410_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "EEPROM_CHECKSUM: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_F420_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_F420_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "SUPPLY_VOLTAGE: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_FD00_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_FD00_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "CALIBRATION_DUMP: DID reserved for dynamically defined DIDs");
+_Static_assert((DID_FDF0_LAST < LIN_DIAG_DYN_DID_FIRST) || (DID_FDF0_FIRST >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "DIAG_STATISTICS: DID reserved for dynamically defined DIDs");
+_Static_assert(DID_F190_FIRST <= DID_F190_LAST, "VIN: range ends before its first DID");
+_Static_assert(DID_F201_FIRST <= DID_F201_LAST, "PDID_01_OVERVOLT_FLAG: range ends before its first DID");
+_Static_assert(DID_F308_FIRST <= DID_F308_LAST, "IS_OVERVOLT_FLAG: range ends before its first DID");
+_Static_assert(DID_F400_F40F_FIRST <= DID_F400_F40F_LAST, "CHANNEL_STATUS: range ends before its first DID");
+_Static_assert(DID_F410_FIRST <= DID_F410_LAST, "EEPROM_CHECKSUM: range ends before its first DID");
+_Static_assert(DID_F420_FIRST <= DID_F420_LAST, "SUPPLY_VOLTAGE: range ends before its first DID");
+_Static_assert(DID_FD00_FIRST <= DID_FD00_LAST, "CALIBRATION_DUMP: range ends before its first DID");
+_Static_assert(DID_FDF0_FIRST <= DID_FDF0_LAST, "DIAG_STATISTICS: range ends before its first DID");
+_Static_assert(DID_F190_LAST < DID_F201_FIRST, "PDID_01_OVERVOLT_FLAG: duplicated DID");
+_Static_assert(DID_F201_LAST < DID_F308_FIRST, "IS_OVERVOLT_FLAG: duplicated DID");
+_Static_assert(DID_F308_LAST < DID_F400_F40F_FIRST, "CHANNEL_STATUS: duplicated DID");
+_Static_assert(DID_F400_F40F_LAST < DID_F410_FIRST, "EEPROM_CHECKSUM: duplicated DID");
+_Static_assert(DID_F410_LAST < DID_F420_FIRST, "SUPPLY_VOLTAGE: duplicated DID");
+_Static_assert(DID_F420_LAST < DID_FD00_FIRST, "CALIBRATION_DUMP: duplicated DID");
+_Static_assert(DID_FD00_LAST < DID_FDF0_FIRST, "DIAG_STATISTICS: duplicated DID");
+
+/* CHANNEL_STATUS */
+Std_ReturnType RdbiChannelStatusRange_(const uint16 offset_u16, uint8*const  output_pu8,
+    const uint8 capacity_u8, uint8*const  size_pu8, uint8* const errCode_pu8);
+
+/* EEPROM_CHECKSUM */
+Std_ReturnType RdbiEepromChecksumAsync_(const uint8 opStatus_u8, uint32_t*const state_pu32, uint8*const  output_pu8,
+    const uint8 capacity_u8, uint8*const  size_pu8, uint8* const errCode_pu8);
+
+/* DIAG_STATISTICS */
+Std_ReturnType RdbiDiagStatistics_(uint8*const buffer_pu8, const uint8 **const data_ppu8,
+    uint16*const length_pu16, uint8* const errCode_pu8);
+
+#endif /* DIAGNOSTIC_DID_GEN_H */
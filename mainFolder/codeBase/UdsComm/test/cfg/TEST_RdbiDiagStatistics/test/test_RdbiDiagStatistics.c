@@ -0,0 +1,231 @@
+#include "unity.h"
+#include "RdbiDiagStatistics.h"
+
+/* Readout layout: header with the 7 listed NRCs, 29-byte DID records, 39-byte service records */
+#define HEADER_SIZE     11u
+#define DID_RECORD(i)   (HEADER_SIZE + ((i) * 29u))
+#define SVC_RECORD(i)   (HEADER_SIZE + (DIAG_DID_TABLE_SIZE * 29u) + ((i) * 39u))
+#define SVC_RDBI        1u   /* 0x19, 0x22, ... */
+
+/* DID table under test: only the keys and the entry addresses are used */
+const uint16 diagDidKeys_cau16[DIAG_DID_TABLE_SIZE] = { 0x0100u, 0x0200u, 0x0300u, 0x0400u, 0x0500u, 0x0600u, 0x0700u };
+
+const diagDidEntry_t diagDidTable[DIAG_DID_TABLE_SIZE];
+
+/* Clock stand-in, in microseconds */
+static uint32_t now_u32;
+
+uint32_t diagStatsNow(void)
+{
+  return now_u32;
+}
+
+/* Stream buffers of two nodes */
+static uint8 buffer_au8[DIAG_STREAM_DATA_SIZE];
+static uint8 otherBuffer_au8[DIAG_STREAM_DATA_SIZE];
+
+static const uint8 *readoutInto(uint8 *const buffer)
+{
+  const uint8 *data = NULL;
+  uint16 length = 0u;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, RdbiDiagStatistics_(buffer, &data, &length, &errCode));
+  TEST_ASSERT_EQUAL_PTR(buffer, data);
+  TEST_ASSERT_TRUE(length <= DID_FDF0_SIZE);
+  TEST_ASSERT_EQUAL_UINT16(SVC_RECORD(6u), length);
+  return data;
+}
+
+static const uint8 *readout(void)
+{
+  return readoutInto(buffer_au8);
+}
+
+static uint16 get16(const uint8 *const data)
+{
+  return (uint16)(((uint16)data[0] << 8) | data[1]);
+}
+
+static uint32_t get32(const uint8 *const data)
+{
+  return ((uint32_t)get16(data) << 16) | get16(&data[2]);
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  diagStatsClear();
+  now_u32 = 1000u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Readout
+ * ============================================================================
+ */
+
+/**
+ * Test: RdbiDiagStatistics_Empty
+ * Description: Read the statistics before anything was counted
+ * Expected: Header describes the layout, every DID record carries its DID and zero counters
+ */
+void test_RdbiDiagStatistics_Empty(void)
+{
+  const uint8 *data = readout();
+  const uint8 nrcs[7] = {0x10, 0x12, 0x13, 0x14, 0x22, 0x31, 0x78};
+  uint8 idx;
+
+  TEST_ASSERT_EQUAL_UINT8(DIAG_DID_TABLE_SIZE, data[0]);
+  TEST_ASSERT_EQUAL_UINT8(6u, data[1]);
+  TEST_ASSERT_EQUAL_UINT8(LIN_DIAG_STATS_HIST_BINS, data[2]);
+  TEST_ASSERT_EQUAL_UINT8(8u, data[3]);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(nrcs, &data[4], 7);
+
+  for (idx = 0u; idx < DIAG_DID_TABLE_SIZE; idx++)
+  {
+    TEST_ASSERT_EQUAL_HEX16(diagDidKeys_cau16[idx], get16(&data[DID_RECORD(idx)]));
+    TEST_ASSERT_EQUAL_UINT16(0u, get16(&data[DID_RECORD(idx) + 2u]));
+  }
+  TEST_ASSERT_EQUAL_HEX8(0x22, data[SVC_RECORD(SVC_RDBI)]);
+}
+
+/* ============================================================================
+ * Test Cases: Per-DID Counters
+ * ============================================================================
+ */
+
+/**
+ * Test: diagStatsDidDone_SynchronousRead
+ * Description: A handler of the third DID answers after 20 us
+ * Expected: One request, one positive, bin 1 (16..32 us), maximum 20 us
+ */
+void test_diagStatsDidDone_SynchronousRead(void)
+{
+  const uint8 *data;
+
+  now_u32 = 1020u;
+  diagStatsDidDone(&diagDidTable[2], DIAG_OPSTATUS_INITIAL, E_OK, 0u, 1000u);
+
+  data = readout();
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(2u) + 2u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(2u) + 4u]));
+  TEST_ASSERT_EQUAL_UINT16(0u, get16(&data[DID_RECORD(2u) + 6u]));
+  TEST_ASSERT_EQUAL_UINT32(20u, get32(&data[DID_RECORD(2u) + 9u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(2u) + 13u + 2u]));
+  TEST_ASSERT_EQUAL_UINT16(0u, get16(&data[DID_RECORD(1u) + 2u]));
+}
+
+/**
+ * Test: diagStatsDidDone_AsynchronousRead
+ * Description: An async handler is pending for 5 us, fails with NRC 0x22 after 2 ms on a poll, then is cancelled
+ * Expected: One request, one negative with its NRC; both calls timed, the longest in the last bin; cancel not counted
+ */
+void test_diagStatsDidDone_AsynchronousRead(void)
+{
+  const uint8 *data;
+
+  now_u32 = 1005u;
+  diagStatsDidDone(&diagDidTable[0], DIAG_OPSTATUS_INITIAL, DIAG_E_PENDING, 0u, 1000u);
+  now_u32 = 5000u;
+  diagStatsDidDone(&diagDidTable[0], DIAG_OPSTATUS_PENDING, E_NOT_OK, kLinDiagNrcConditionsNotCorrect, 3000u);
+  diagStatsDidDone(&diagDidTable[0], DIAG_OPSTATUS_CANCEL, E_OK, 0u, 0u);
+
+  data = readout();
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(0u) + 2u]));
+  TEST_ASSERT_EQUAL_UINT16(0u, get16(&data[DID_RECORD(0u) + 4u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(0u) + 6u]));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcConditionsNotCorrect, data[DID_RECORD(0u) + 8u]);
+  TEST_ASSERT_EQUAL_UINT32(2000u, get32(&data[DID_RECORD(0u) + 9u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(0u) + 13u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[DID_RECORD(0u) + 13u + (2u * (LIN_DIAG_STATS_HIST_BINS - 1u))]));
+}
+
+/**
+ * Test: diagStatsDidDone_ClockWrap
+ * Description: The clock wraps around between start and end of the handler
+ * Expected: The elapsed time is still 10 us
+ */
+void test_diagStatsDidDone_ClockWrap(void)
+{
+  const uint8 *data;
+
+  now_u32 = 4u;
+  diagStatsDidDone(&diagDidTable[6], DIAG_OPSTATUS_INITIAL, E_OK, 0u, 0xFFFFFFFAu);
+
+  data = readout();
+  TEST_ASSERT_EQUAL_UINT32(10u, get32(&data[DID_RECORD(6u) + 9u]));
+}
+
+/* ============================================================================
+ * Test Cases: Per-Service Counters
+ * ============================================================================
+ */
+
+/**
+ * Test: diagStatsServiceDone_ResponsesPerNrc
+ * Description: ReadDataById answers positive after 3 ms, then NRC 0x78, then NRC 0x33 (not listed)
+ * Expected: Positive counted, 0x78 in its bin, 0x33 in the last bin; 3 ms in bin 2 (2..4 ms)
+ */
+void test_diagStatsServiceDone_ResponsesPerNrc(void)
+{
+  const uint8 *data;
+
+  now_u32 = 4000u;
+  diagStatsServiceDone(0x22u, 0u, 1000u);
+  diagStatsServiceDone(0x22u, kLinDiagNrcResponsePending, 4000u);
+  diagStatsServiceDone(0x22u, 0x33u, 4000u);
+
+  data = readout();
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[SVC_RECORD(SVC_RDBI) + 1u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[SVC_RECORD(SVC_RDBI) + 3u + (2u * 6u)]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[SVC_RECORD(SVC_RDBI) + 3u + (2u * 7u)]));
+  TEST_ASSERT_EQUAL_UINT32(3000u, get32(&data[SVC_RECORD(SVC_RDBI) + 19u]));
+  TEST_ASSERT_EQUAL_UINT16(2u, get16(&data[SVC_RECORD(SVC_RDBI) + 23u]));
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&data[SVC_RECORD(SVC_RDBI) + 23u + (2u * 2u)]));
+}
+
+/**
+ * Test: diagStatsServiceDone_UnknownService
+ * Description: Count a response of a service the statistics do not follow, then clear
+ * Expected: No service record changes; clear resets the counted DID
+ */
+void test_diagStatsServiceDone_UnknownService(void)
+{
+  const uint8 *data;
+  uint8 idx;
+
+  diagStatsServiceDone(0x10u, 0u, 0u);
+  diagStatsDidDone(&diagDidTable[1], DIAG_OPSTATUS_INITIAL, E_OK, 0u, 1000u);
+  diagStatsClear();
+
+  data = readout();
+  for (idx = 0u; idx < 6u; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(0u, get16(&data[SVC_RECORD(idx) + 1u]));
+  }
+  TEST_ASSERT_EQUAL_UINT16(0u, get16(&data[DID_RECORD(1u) + 2u]));
+}
+
+/**
+ * Test: RdbiDiagStatistics_NodesApart
+ * Description: Read out into the buffer of a node, count a read, read out into the buffer of another node
+ * Expected: The readout of the first node, still in transmission, keeps the count it was taken with
+ */
+void test_RdbiDiagStatistics_NodesApart(void)
+{
+  const uint8 *first;
+  const uint8 *second;
+
+  diagStatsDidDone(&diagDidTable[1], DIAG_OPSTATUS_INITIAL, E_OK, 0u, 1000u);
+  first = readoutInto(buffer_au8);
+
+  diagStatsDidDone(&diagDidTable[1], DIAG_OPSTATUS_INITIAL, E_OK, 0u, 1000u);
+  second = readoutInto(otherBuffer_au8);
+
+  TEST_ASSERT_EQUAL_UINT16(1u, get16(&first[DID_RECORD(1u) + 2u]));
+  TEST_ASSERT_EQUAL_UINT16(2u, get16(&second[DID_RECORD(1u) + 2u]));
+}
@@ -0,0 +1,73 @@
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+
+
+
+void diagDidCacheMainFunction(diagNode_t *node_ps)
+{
+    node_ps->cacheTicks_u16++;
+}
+
+uint16 diagCacheStamp(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps)
+{
+    const diagDidCache_t *const l_cache_ps = entry_ps->cache_ps;
+
+    return (NULL != l_cache_ps->version_pu16) ? *l_cache_ps->version_pu16 : node_ps->cacheTicks_u16;
+}
+
+Std_ReturnType diagCacheRead(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8*const  size_pu8)
+{
+    const diagDidCache_t *const l_cache_ps = entry_ps->cache_ps;
+    const diagCacheSlot_t *const l_slot_ps = &node_ps->cacheSlots_as[l_cache_ps->slot_u16 + offset_u16];
+    const uint8 *const l_src_pu8 = &node_ps->cacheData_au8[l_cache_ps->data_u16 + (uint16)(offset_u16 * entry_ps->size_u16)];
+    uint16 l_idx_u16;
+
+    if (0u == l_slot_ps->valid_u8)
+    {
+        return E_NOT_OK;
+    }
+
+    if (NULL != l_cache_ps->version_pu16)
+    {
+        if (*l_cache_ps->version_pu16 != l_slot_ps->stamp_u16)
+        {
+            return E_NOT_OK;
+        }
+    }
+    else if ((uint16)(node_ps->cacheTicks_u16 - l_slot_ps->stamp_u16) >= l_cache_ps->ttlTicks_u16)
+    {
+        return E_NOT_OK;
+    }
+    else
+    {
+        /* Within its time-to-live */
+    }
+
+    for (l_idx_u16 = 0u; l_idx_u16 < l_slot_ps->size_u8; l_idx_u16++)
+    {
+        output_pu8[l_idx_u16] = l_src_pu8[l_idx_u16];
+    }
+    *size_pu8 = l_slot_ps->size_u8;
+
+    return E_OK;
+}
+
+void diagCacheWrite(diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    const uint16 stamp_u16, const uint8 *const response_pu8, const uint8 size_u8)
+{
+    const diagDidCache_t *const l_cache_ps = entry_ps->cache_ps;
+    diagCacheSlot_t *const l_slot_ps = &node_ps->cacheSlots_as[l_cache_ps->slot_u16 + offset_u16];
+    uint8 *const l_dst_pu8 = &node_ps->cacheData_au8[l_cache_ps->data_u16 + (uint16)(offset_u16 * entry_ps->size_u16)];
+    const uint8 l_size_u8 = (size_u8 < entry_ps->size_u16) ? size_u8 : (uint8)entry_ps->size_u16;
+    uint16 l_idx_u16;
+
+    for (l_idx_u16 = 0u; l_idx_u16 < l_size_u8; l_idx_u16++)
+    {
+        l_dst_pu8[l_idx_u16] = response_pu8[l_idx_u16];
+    }
+    l_slot_ps->size_u8 = l_size_u8;
+    l_slot_ps->stamp_u16 = stamp_u16;
+    l_slot_ps->valid_u8 = 1u;
+}
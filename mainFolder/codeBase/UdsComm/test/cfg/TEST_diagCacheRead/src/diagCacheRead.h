@@ -0,0 +1,11 @@
+
+
+#ifndef DIAG_CACHE_READ_H
+#define DIAG_CACHE_READ_H
+
+#include "diagnostic_cfg_priv.h"
+
+Std_ReturnType diagCacheRead(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8*const  size_pu8);
+
+#endif
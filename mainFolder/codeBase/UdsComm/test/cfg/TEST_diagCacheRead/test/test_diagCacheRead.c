@@ -0,0 +1,168 @@
+#include "unity.h"
+#include <string.h>
+#include "diagCacheRead.h"
+
+/* TTL cache of a 4-DID range, 2 bytes per DID: node slots 0..3, data 0..7 */
+static const diagDidCache_t ttlCache = { 0u, 0u, 3u, NULL };
+static const diagDidEntry_t ttlEntry = { 0x0200u, 0x0203u, 2u, NULL, NULL, NULL, NULL, NULL, NULL, &ttlCache };
+
+/* Version driven cache of a single DID: node slot 4, data 8..9 */
+static volatile uint16 version_u16;
+static const diagDidCache_t verCache = { 4u, 8u, 0u, &version_u16 };
+static const diagDidEntry_t verEntry = { 0x0100u, 0x0100u, 2u, NULL, NULL, NULL, NULL, NULL, NULL, &verCache };
+
+/* Nodes holding the caches */
+static diagNode_t node;
+static diagNode_t otherNode;
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  memset(&node, 0, sizeof(node));
+  memset(&otherNode, 0, sizeof(otherNode));
+  version_u16 = 0u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Time-To-Live
+ * ============================================================================
+ */
+
+/**
+ * Test: diagCacheRead_EmptySlot
+ * Description: Read a DID never stored in the cache
+ * Expected: E_NOT_OK, the output is left untouched
+ */
+void test_diagCacheRead_EmptySlot(void)
+{
+  uint8 output[2] = {0xAA, 0xAA};
+  uint8 size = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagCacheRead(&node, &ttlEntry, 0u, output, &size));
+  TEST_ASSERT_EQUAL_HEX8(0xAA, output[0]);
+}
+
+/**
+ * Test: diagCacheRead_TtlFreshThenExpired
+ * Description: Store a response, then let the time-to-live (3 ticks) elapse
+ * Expected: Served while younger than 3 ticks, stale afterwards
+ */
+void test_diagCacheRead_TtlFreshThenExpired(void)
+{
+  const uint8 response[2] = {0x12, 0x34};
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+
+  diagCacheWrite(&node, &ttlEntry, 1u, diagCacheStamp(&node, &ttlEntry), response, 2u);
+  diagDidCacheMainFunction(&node);
+  diagDidCacheMainFunction(&node);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagCacheRead(&node, &ttlEntry, 1u, output, &size));
+  TEST_ASSERT_EQUAL_INT(2, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(response, output, 2);
+
+  diagDidCacheMainFunction(&node);
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagCacheRead(&node, &ttlEntry, 1u, output, &size));
+}
+
+/**
+ * Test: diagCacheRead_RangeSlots
+ * Description: Store two DIDs of the same range
+ * Expected: Each DID gets its own response, other slots stay empty
+ */
+void test_diagCacheRead_RangeSlots(void)
+{
+  const uint8 response0[2] = {0x00, 0x01};
+  const uint8 response3[1] = {0x03};
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+
+  diagCacheWrite(&node, &ttlEntry, 0u, diagCacheStamp(&node, &ttlEntry), response0, 2u);
+  diagCacheWrite(&node, &ttlEntry, 3u, diagCacheStamp(&node, &ttlEntry), response3, 1u);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagCacheRead(&node, &ttlEntry, 3u, output, &size));
+  TEST_ASSERT_EQUAL_INT(1, size); /* Size lowered by the handler is kept */
+  TEST_ASSERT_EQUAL_HEX8(0x03, output[0]);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagCacheRead(&node, &ttlEntry, 0u, output, &size));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(response0, output, 2);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagCacheRead(&node, &ttlEntry, 2u, output, &size));
+}
+
+/* ============================================================================
+ * Test Cases: Producer Version
+ * ============================================================================
+ */
+
+/**
+ * Test: diagCacheRead_VersionBump
+ * Description: Store a response, then let the producer bump the version counter
+ * Expected: Served whatever the time until the version changes, stale afterwards
+ */
+void test_diagCacheRead_VersionBump(void)
+{
+  const uint8 response[2] = {0x56, 0x78};
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+  uint16 tick;
+
+  diagCacheWrite(&node, &verEntry, 0u, diagCacheStamp(&node, &verEntry), response, 2u);
+  for (tick = 0u; tick < 100u; tick++)
+  {
+    diagDidCacheMainFunction(&node);
+  }
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagCacheRead(&node, &verEntry, 0u, output, &size));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(response, output, 2);
+
+  version_u16++;
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagCacheRead(&node, &verEntry, 0u, output, &size));
+}
+
+/**
+ * Test: diagCacheRead_VersionBumpDuringHandler
+ * Description: The producer bumps the version between the stamp and the store
+ * Expected: The stored response is already stale
+ */
+void test_diagCacheRead_VersionBumpDuringHandler(void)
+{
+  const uint8 response[2] = {0x9A, 0xBC};
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+  const uint16 stamp = diagCacheStamp(&node, &verEntry);
+
+  version_u16++; /* Value changed while the handler was running */
+  diagCacheWrite(&node, &verEntry, 0u, stamp, response, 2u);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagCacheRead(&node, &verEntry, 0u, output, &size));
+}
+
+/* ============================================================================
+ * Test Cases: Nodes
+ * ============================================================================
+ */
+
+/**
+ * Test: diagCacheRead_NodesApart
+ * Description: Store a response in one node, then read the same DID from another node
+ * Expected: The other node has nothing cached and its own time base
+ */
+void test_diagCacheRead_NodesApart(void)
+{
+  const uint8 response[2] = {0x12, 0x34};
+  uint8 output[2] = {0xAA, 0xAA};
+  uint8 size = 0u;
+
+  diagCacheWrite(&node, &ttlEntry, 1u, diagCacheStamp(&node, &ttlEntry), response, 2u);
+  diagDidCacheMainFunction(&node);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagCacheRead(&otherNode, &ttlEntry, 1u, output, &size));
+  TEST_ASSERT_EQUAL_HEX8(0xAA, output[0]);
+  TEST_ASSERT_EQUAL_UINT16(0u, diagCacheStamp(&otherNode, &ttlEntry));
+  TEST_ASSERT_EQUAL_INT(E_OK, diagCacheRead(&node, &ttlEntry, 1u, output, &size));
+}
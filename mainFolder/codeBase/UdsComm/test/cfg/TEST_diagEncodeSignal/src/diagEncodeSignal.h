@@ -0,0 +1,11 @@
+
+
+#ifndef DIAG_ENCODE_SIGNAL_H
+#define DIAG_ENCODE_SIGNAL_H
+
+#include "diagnostic_cfg_priv.h"
+
+Std_ReturnType diagEncodeSignal(const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8* const errCode_pu8);
+
+#endif
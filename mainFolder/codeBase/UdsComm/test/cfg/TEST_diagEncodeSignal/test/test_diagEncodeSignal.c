@@ -0,0 +1,195 @@
+#include "unity.h"
+#include "diagEncodeSignal.h"
+
+/* Scaled sources, fixed-point constants as written by tools/didCfgGen.py */
+static uint16 voltage_mV_u16;
+static int16_t temperature_dC_s16;
+static int16_t current_as16[3];
+static uint32_t counter_u32;
+
+/* u16:100:0:be:8 - mV in 0.1 V */
+static const diagSignal_t voltageSignal = { &voltage_mV_u16, DIAG_SIGNAL_SRC_U16, 0u, 8u, 32u, 42949673, 2147483648LL };
+static const diagDidEntry_t voltageEntry = { 0xF420u, 0xF420u, 1u, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                                             &voltageSignal };
+
+/* s16:5:-400:be:8 - 0.1 degC in 0.5 degC from -40 degC */
+static const diagSignal_t temperatureSignal = { &temperature_dC_s16, DIAG_SIGNAL_SRC_S16, 0u, 8u, 32u, 858993459,
+                                                345744867328LL };
+static const diagDidEntry_t temperatureEntry = { 0x0100u, 0x0100u, 1u, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                                                 &temperatureSignal };
+
+/* s16:1/4:0:le:s16 - range of 3 DIDs, raw = 4 * phys */
+static const diagSignal_t currentSignal = { current_as16, DIAG_SIGNAL_SRC_S16, DIAG_SIGNAL_SIGNED | DIAG_SIGNAL_LITTLE_ENDIAN,
+                                            16u, 28u, 1073741824, 134217728LL };
+static const diagDidEntry_t currentEntry = { 0x0200u, 0x0202u, 2u, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                                             &currentSignal };
+
+/* u32:1:0:be:12 - 12-bit raw in 2 bytes, with a hook */
+static Std_ReturnType hookResult;
+static uint8 hookCalls;
+
+static Std_ReturnType counterHook(uint8* const errCode_pu8)
+{
+  hookCalls++;
+  if (E_OK != hookResult)
+  {
+    *errCode_pu8 = 0x22u;
+  }
+  return hookResult;
+}
+
+static const diagSignal_t counterSignal = { &counter_u32, DIAG_SIGNAL_SRC_U32, 0u, 12u, 30u, 1073741824, 536870912LL };
+static const diagDidEntry_t counterEntry = { 0x0300u, 0x0300u, 2u, NULL, NULL, NULL, &counterHook, NULL, NULL, NULL, NULL,
+                                             &counterSignal };
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  hookResult = E_OK;
+  hookCalls = 0u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Scaling
+ * ============================================================================
+ */
+
+/**
+ * Test: diagEncodeSignal_MilliVoltToDeciVolt
+ * Description: Encode 12.000 V, 12.049 V and 12.050 V as 0.1 V
+ * Expected: 120, 120 and 121: rounded to nearest, no floating point
+ */
+void test_diagEncodeSignal_MilliVoltToDeciVolt(void)
+{
+  const uint16 input[3] = {12000u, 12049u, 12050u};
+  const uint8 expected[3] = {120u, 120u, 121u};
+  uint8 output[1];
+  uint8 errCode = 0u;
+  uint8 idx;
+
+  for (idx = 0u; idx < 3u; idx++)
+  {
+    voltage_mV_u16 = input[idx];
+    TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&voltageEntry, 0u, output, &errCode));
+    TEST_ASSERT_EQUAL_UINT8(expected[idx], output[0]);
+  }
+}
+
+/**
+ * Test: diagEncodeSignal_Saturation
+ * Description: Encode 30 V as 0.1 V in one byte, and temperatures below and above the 8-bit range
+ * Expected: The raw value saturates to 255 or 0 instead of wrapping
+ */
+void test_diagEncodeSignal_Saturation(void)
+{
+  uint8 output[1];
+  uint8 errCode = 0u;
+
+  voltage_mV_u16 = 30000u;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&voltageEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_UINT8(255u, output[0]);
+
+  temperature_dC_s16 = -405;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&temperatureEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_UINT8(0u, output[0]);
+
+  temperature_dC_s16 = 1000;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&temperatureEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_UINT8(255u, output[0]);
+}
+
+/**
+ * Test: diagEncodeSignal_Offset
+ * Description: Encode 25.0 degC and -37.8 degC in 0.5 degC from -40 degC
+ * Expected: 130 and 4 (-37.8 degC rounds to -38.0 degC)
+ */
+void test_diagEncodeSignal_Offset(void)
+{
+  uint8 output[1];
+  uint8 errCode = 0u;
+
+  temperature_dC_s16 = 250;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&temperatureEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_UINT8(130u, output[0]);
+
+  temperature_dC_s16 = -378;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&temperatureEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_UINT8(4u, output[0]);
+}
+
+/* ============================================================================
+ * Test Cases: Encoding
+ * ============================================================================
+ */
+
+/**
+ * Test: diagEncodeSignal_SignedLittleEndianRange
+ * Description: Read the 3 DIDs of a signed 16-bit little-endian range
+ * Expected: Element [offset] encoded in two's complement, low byte first, saturated at 32767
+ */
+void test_diagEncodeSignal_SignedLittleEndianRange(void)
+{
+  uint8 output[2];
+  uint8 errCode = 0u;
+
+  current_as16[0] = 100;
+  current_as16[1] = -1000;
+  current_as16[2] = 10000;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&currentEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_HEX8(0x90, output[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x01, output[1]);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&currentEntry, 1u, output, &errCode));
+  TEST_ASSERT_EQUAL_HEX8(0x60, output[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xF0, output[1]);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&currentEntry, 2u, output, &errCode));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, output[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x7F, output[1]);
+}
+
+/**
+ * Test: diagEncodeSignal_NarrowRawBigEndian
+ * Description: Encode 1234 and 5000 as a 12-bit raw value in two bytes, big endian
+ * Expected: 0x04D2, then 0x0FFF: saturated to 12 bits, the unused high bits are 0
+ */
+void test_diagEncodeSignal_NarrowRawBigEndian(void)
+{
+  uint8 output[2];
+  uint8 errCode = 0u;
+
+  counter_u32 = 1234u;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&counterEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_HEX8(0x04, output[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xD2, output[1]);
+
+  counter_u32 = 5000u;
+  TEST_ASSERT_EQUAL_INT(E_OK, diagEncodeSignal(&counterEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_HEX8(0x0F, output[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xFF, output[1]);
+  TEST_ASSERT_EQUAL_UINT8(2u, hookCalls);
+}
+
+/**
+ * Test: diagEncodeSignal_HookRefuses
+ * Description: Read a scaled DID whose consistency hook refuses the read
+ * Expected: E_NOT_OK with the hook NRC, the output is left untouched
+ */
+void test_diagEncodeSignal_HookRefuses(void)
+{
+  uint8 output[2] = {0xAA, 0xAA};
+  uint8 errCode = 0u;
+
+  hookResult = E_NOT_OK;
+  counter_u32 = 1u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagEncodeSignal(&counterEntry, 0u, output, &errCode));
+  TEST_ASSERT_EQUAL_HEX8(0x22, errCode);
+  TEST_ASSERT_EQUAL_HEX8(0xAA, output[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xAA, output[1]);
+}
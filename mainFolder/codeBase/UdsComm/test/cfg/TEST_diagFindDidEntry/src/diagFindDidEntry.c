@@ -0,0 +1,45 @@
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+
+
+
+/* Binary search of the DID table: O(log n) whatever the number of DIDs.
+ * Only the dense key array is walked, the descriptor is touched once at the end.
+ */
+const diagDidEntry_t *diagFindDidEntry(const diagDidTable_t *const table_ps, const uint16 did_u16)
+{
+    uint16 l_low_u16 = 0u;
+    uint16 l_high_u16 = table_ps->size_u16;
+    const diagDidEntry_t *l_entry_ps = NULL;
+
+    /* Find the last entry whose first DID is <= did_u16 */
+    while (l_low_u16 < l_high_u16)
+    {
+        const uint16 l_mid_u16 = (uint16)(l_low_u16 + ((l_high_u16 - l_low_u16) >> 1));
+
+        if (did_u16 < table_ps->keys_pcu16[l_mid_u16])
+        {
+            l_high_u16 = l_mid_u16;
+        }
+        else
+        {
+            l_low_u16 = (uint16)(l_mid_u16 + 1u);
+        }
+    }
+
+    if (l_low_u16 > 0u)
+    {
+        l_entry_ps = &table_ps->entries_pcs[l_low_u16 - 1u];
+
+        if (did_u16 > l_entry_ps->didLast_u16)
+        {
+            l_entry_ps = NULL;
+        }
+    }
+
+    return l_entry_ps;
+}
+
+
+
@@ -0,0 +1,10 @@
+
+
+#ifndef DIAG_FIND_DID_ENTRY_H
+#define DIAG_FIND_DID_ENTRY_H
+
+#include "diagnostic_cfg_priv.h"
+
+const diagDidEntry_t *diagFindDidEntry(const diagDidTable_t *const table_ps, const uint16 did_u16);
+
+#endif
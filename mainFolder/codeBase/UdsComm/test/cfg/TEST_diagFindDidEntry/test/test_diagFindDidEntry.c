@@ -0,0 +1,73 @@
+#include "unity.h"
+#include "diagFindDidEntry.h"
+
+/* DID table under test, sorted by didFirst_u16 */
+const uint16 diagDidKeys_cau16[] = { 0x0100u, 0x0200u, 0xF308u, 0xFFFFu };
+
+const diagDidEntry_t diagDidTable[] =
+{
+    { 0x0100u, 0x0100u, 1u, NULL, NULL },
+    { 0x0200u, 0x020Fu, 2u, NULL, NULL },
+    { 0xF308u, 0xF308u, 1u, NULL, NULL },
+    { 0xFFFFu, 0xFFFFu, 4u, NULL, NULL },
+};
+
+const uint16 diagDidTableSize_u16 = (uint16)(sizeof(diagDidTable) / sizeof(diagDidTable[0]));
+
+static const diagDidTable_t table = { diagDidKeys_cau16, diagDidTable, (uint16)(sizeof(diagDidTable) / sizeof(diagDidTable[0])) };
+
+/* Test setup and teardown */
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Single DID Lookup
+ * ============================================================================
+ */
+
+/**
+ * Test: diagFindDidEntry_SingleDidFound
+ * Description: Look up every single DID of the table
+ * Expected: The matching entry is returned
+ */
+void test_diagFindDidEntry_SingleDidFound(void)
+{
+  TEST_ASSERT_EQUAL_PTR(&diagDidTable[0], diagFindDidEntry(&table, 0x0100u));
+  TEST_ASSERT_EQUAL_PTR(&diagDidTable[2], diagFindDidEntry(&table, 0xF308u));
+  TEST_ASSERT_EQUAL_PTR(&diagDidTable[3], diagFindDidEntry(&table, 0xFFFFu));
+}
+
+/**
+ * Test: diagFindDidEntry_UnknownDid
+ * Description: Look up DIDs before, between and after the table entries
+ * Expected: NULL is returned
+ */
+void test_diagFindDidEntry_UnknownDid(void)
+{
+  TEST_ASSERT_NULL(diagFindDidEntry(&table, 0x0000u));
+  TEST_ASSERT_NULL(diagFindDidEntry(&table, 0x0101u));
+  TEST_ASSERT_NULL(diagFindDidEntry(&table, 0x0210u));
+  TEST_ASSERT_NULL(diagFindDidEntry(&table, 0xFFFEu));
+}
+
+/* ============================================================================
+ * Test Cases: Range Lookup
+ * ============================================================================
+ */
+
+/**
+ * Test: diagFindDidEntry_RangeBounds
+ * Description: Look up the first, an inner and the last DID of a range
+ * Expected: The range entry is returned for all of them
+ */
+void test_diagFindDidEntry_RangeBounds(void)
+{
+  TEST_ASSERT_EQUAL_PTR(&diagDidTable[1], diagFindDidEntry(&table, 0x0200u));
+  TEST_ASSERT_EQUAL_PTR(&diagDidTable[1], diagFindDidEntry(&table, 0x0207u));
+  TEST_ASSERT_EQUAL_PTR(&diagDidTable[1], diagFindDidEntry(&table, 0x020Fu));
+}
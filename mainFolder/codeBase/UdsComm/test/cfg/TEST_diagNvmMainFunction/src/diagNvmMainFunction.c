@@ -0,0 +1,113 @@
+#include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+/* DID blocks first, then the fault memory */
+static const diagNvmBlock_t *diagNvmGetBlock(const uint8 block_u8)
+{
+    return (block_u8 < DIAG_NVM_BLOCK_COUNT) ? &diagNvmBlocks[block_u8] : &diagDtcNvmBlock;
+}
+
+/* RAM of block_u8 in node_ps */
+static uint8 *diagNvmGetData(diagNode_t *const node_ps, const uint8 block_u8)
+{
+    return (block_u8 < DIAG_NVM_BLOCK_COUNT) ? &node_ps->didRam_au8[diagNvmBlocks[block_u8].ram_u16]
+                                             : (uint8 *)&node_ps->dtcStore_s;
+}
+
+void diagNvmInit(diagNode_t *node_ps)
+{
+    uint8 l_block_u8;
+
+    for (l_block_u8 = 0u; l_block_u8 < DIAG_NVM_ALL_BLOCKS; l_block_u8++)
+    {
+        const diagNvmBlock_t *const l_block_ps = diagNvmGetBlock(l_block_u8);
+
+        /* No image yet, or a block added after it was written: the source keeps its default */
+        (void)diagNvmBackendRead((uint16)(node_ps->nvmBase_u16 + l_block_ps->offset_u16),
+                                 diagNvmGetData(node_ps, l_block_u8), l_block_ps->size_u16);
+    }
+
+    for (l_block_u8 = 0u; l_block_u8 < DIAG_NVM_ALL_BLOCKS; l_block_u8++)
+    {
+        node_ps->nvmDirty_au8[l_block_u8] = 0u;
+    }
+    node_ps->nvmDirtyCount_u8 = 0u;
+    node_ps->nvmQuietTicks_u16 = 0u;
+    node_ps->nvmAgeTicks_u16 = 0u;
+}
+
+void diagNvmMarkDirty(diagNode_t *const node_ps, const uint8 block_u8)
+{
+    if (0u == node_ps->nvmDirtyCount_u8)
+    {
+        node_ps->nvmAgeTicks_u16 = 0u;
+    }
+
+    if (0u == node_ps->nvmDirty_au8[block_u8])
+    {
+        node_ps->nvmDirty_au8[block_u8] = 1u;
+        node_ps->nvmDirtyCount_u8++;
+    }
+
+    node_ps->nvmQuietTicks_u16 = 0u;
+}
+
+Std_ReturnType diagNvmFlush(diagNode_t *node_ps)
+{
+    Std_ReturnType l_result_;
+    uint8 l_block_u8;
+
+    if (0u == node_ps->nvmDirtyCount_u8)
+    {
+        return E_OK;
+    }
+
+    l_result_ = diagNvmBackendBegin();
+
+    for (l_block_u8 = 0u; (l_block_u8 < DIAG_NVM_ALL_BLOCKS) && (E_OK == l_result_); l_block_u8++)
+    {
+        if (0u != node_ps->nvmDirty_au8[l_block_u8])
+        {
+            const diagNvmBlock_t *const l_block_ps = diagNvmGetBlock(l_block_u8);
+
+            l_result_ = diagNvmBackendWrite((uint16)(node_ps->nvmBase_u16 + l_block_ps->offset_u16),
+                                            diagNvmGetData(node_ps, l_block_u8), l_block_ps->size_u16);
+        }
+    }
+
+    /* Always closed, but the batch only counts when every write and the programming succeeded */
+    if ((E_OK != diagNvmBackendEnd()) || (E_OK != l_result_))
+    {
+        /* Blocks stay dirty: the whole batch is retried on the next commit */
+        node_ps->nvmQuietTicks_u16 = 0u;
+        node_ps->nvmAgeTicks_u16 = 0u;
+        return E_NOT_OK;
+    }
+
+    for (l_block_u8 = 0u; l_block_u8 < DIAG_NVM_ALL_BLOCKS; l_block_u8++)
+    {
+        node_ps->nvmDirty_au8[l_block_u8] = 0u;
+    }
+    node_ps->nvmDirtyCount_u8 = 0u;
+
+    return E_OK;
+}
+
+void diagNvmMainFunction(diagNode_t *node_ps)
+{
+    if (0u == node_ps->nvmDirtyCount_u8)
+    {
+        return;
+    }
+
+    node_ps->nvmQuietTicks_u16++;
+    node_ps->nvmAgeTicks_u16++;
+
+    /* Wait for the end of the write burst, but not forever when the tester keeps writing */
+    if ((node_ps->nvmQuietTicks_u16 >= LIN_DIAG_MS_TO_TICKS(LIN_DIAG_NVM_COMMIT_DELAY_MS)) ||
+        (node_ps->nvmAgeTicks_u16 >= LIN_DIAG_MS_TO_TICKS(LIN_DIAG_NVM_COMMIT_MAX_MS)))
+    {
+        (void)diagNvmFlush(node_ps);
+    }
+}
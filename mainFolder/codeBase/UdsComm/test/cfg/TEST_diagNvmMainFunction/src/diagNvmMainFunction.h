@@ -0,0 +1,15 @@
+
+#ifndef DIAG_NVM_MAIN_FUNCTION_H
+#define DIAG_NVM_MAIN_FUNCTION_H
+
+#include "diagnostic_cfg_priv.h"
+
+void diagNvmInit(diagNode_t *node_ps);
+
+void diagNvmMarkDirty(diagNode_t *const node_ps, const uint8 block_u8);
+
+Std_ReturnType diagNvmFlush(diagNode_t *node_ps);
+
+void diagNvmMainFunction(diagNode_t *node_ps);
+
+#endif
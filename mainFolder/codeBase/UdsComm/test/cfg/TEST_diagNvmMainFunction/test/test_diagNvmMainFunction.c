@@ -0,0 +1,277 @@
+#include "unity.h"
+#include <string.h>
+#include "diagNvmMainFunction.h"
+
+#define QUIET_TICKS LIN_DIAG_MS_TO_TICKS(LIN_DIAG_NVM_COMMIT_DELAY_MS)
+#define MAX_TICKS   LIN_DIAG_MS_TO_TICKS(LIN_DIAG_NVM_COMMIT_MAX_MS)
+
+/* Node under test: the DID block is its RAM bytes 0..3, at offset 0 of the image,
+ * the first 4 bytes of its fault memory follow the DID image
+ */
+static diagNode_t node;
+#define source_au8      node.didRam_au8
+#define faultMemory_pu8 ((uint8 *)&node.dtcStore_s)
+
+const diagNvmBlock_t diagNvmBlocks[DIAG_NVM_BLOCK_COUNT + 1u] =
+{
+    { 0u, 0u, 4u },
+    { 0u, 4u, 0u },
+};
+
+const diagNvmBlock_t diagDtcNvmBlock = { 0u, 4u, 4u };
+
+/* Backend stand-in: NVM image of two node slots (8 bytes each) and call log */
+static uint8 image_au8[16];
+static Std_ReturnType readResult_;
+static Std_ReturnType writeResult_;
+static uint8 beginCalls_u8;
+static uint8 writeCalls_u8;
+static uint8 endCalls_u8;
+
+Std_ReturnType diagNvmBackendRead(const uint16 offset_u16, uint8*const  data_pu8, const uint16 length_u16)
+{
+  if (E_OK == readResult_)
+  {
+    memcpy(data_pu8, &image_au8[offset_u16], length_u16);
+  }
+  return readResult_;
+}
+
+Std_ReturnType diagNvmBackendBegin(void)
+{
+  beginCalls_u8++;
+  return E_OK;
+}
+
+Std_ReturnType diagNvmBackendWrite(const uint16 offset_u16, const uint8 *const data_pu8, const uint16 length_u16)
+{
+  writeCalls_u8++;
+  if (E_OK == writeResult_)
+  {
+    memcpy(&image_au8[offset_u16], data_pu8, length_u16);
+  }
+  return writeResult_;
+}
+
+Std_ReturnType diagNvmBackendEnd(void)
+{
+  endCalls_u8++;
+  return E_OK;
+}
+
+static void tick(uint16 count_u16)
+{
+  while (count_u16-- > 0u)
+  {
+    diagNvmMainFunction(&node);
+  }
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  memset(&node, 0, sizeof(node));
+  memset(image_au8, 0, sizeof(image_au8));
+  readResult_ = E_NOT_OK;
+  writeResult_ = E_OK;
+  diagNvmInit(&node);
+  beginCalls_u8 = 0u;
+  writeCalls_u8 = 0u;
+  endCalls_u8 = 0u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Init
+ * ============================================================================
+ */
+
+/**
+ * Test: diagNvmInit_LoadsImage
+ * Description: Init with a persisted image available
+ * Expected: The source holds the persisted value
+ */
+void test_diagNvmInit_LoadsImage(void)
+{
+  const uint8 expected[4] = {0x11, 0x22, 0x33, 0x44};
+
+  memcpy(image_au8, expected, sizeof(expected));
+  readResult_ = E_OK;
+  diagNvmInit(&node);
+
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, source_au8, 4);
+}
+
+/**
+ * Test: diagNvmInit_NoImage
+ * Description: Init when the backend has no image
+ * Expected: The source keeps its default value
+ */
+void test_diagNvmInit_NoImage(void)
+{
+  source_au8[0] = 0x5Au;
+  diagNvmInit(&node);
+
+  TEST_ASSERT_EQUAL_HEX8(0x5A, source_au8[0]);
+}
+
+/* ============================================================================
+ * Test Cases: Batched Commit
+ * ============================================================================
+ */
+
+/**
+ * Test: diagNvmMainFunction_NothingWritten
+ * Description: Run the commit task for longer than the maximum delay without writes
+ * Expected: The backend is never called
+ */
+void test_diagNvmMainFunction_NothingWritten(void)
+{
+  tick(MAX_TICKS + 1u);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, beginCalls_u8);
+}
+
+/**
+ * Test: diagNvmMainFunction_BurstCoalesced
+ * Description: Write the block three times, then stay quiet for the commit delay
+ * Expected: Nothing committed before the delay, then a single batch with the last value
+ */
+void test_diagNvmMainFunction_BurstCoalesced(void)
+{
+  uint8 l_write_u8;
+
+  for (l_write_u8 = 1u; l_write_u8 <= 3u; l_write_u8++)
+  {
+    source_au8[0] = l_write_u8;
+    diagNvmMarkDirty(&node, 0u);
+    tick(1u);
+  }
+
+  tick(QUIET_TICKS - 2u);
+  TEST_ASSERT_EQUAL_UINT8(0u, beginCalls_u8);
+
+  tick(1u);
+  TEST_ASSERT_EQUAL_UINT8(1u, beginCalls_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, writeCalls_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, endCalls_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x03, image_au8[0]);
+
+  /* Committed: nothing left for the next periods */
+  tick(MAX_TICKS);
+  TEST_ASSERT_EQUAL_UINT8(1u, beginCalls_u8);
+}
+
+/**
+ * Test: diagNvmMainFunction_ContinuousWrites
+ * Description: Write again before the commit delay is over, for longer than the maximum delay
+ * Expected: The batch is committed once the maximum delay is reached
+ */
+void test_diagNvmMainFunction_ContinuousWrites(void)
+{
+  uint16 l_tick_u16;
+
+  for (l_tick_u16 = 0u; l_tick_u16 < (MAX_TICKS - 1u); l_tick_u16++)
+  {
+    diagNvmMarkDirty(&node, 0u);
+    tick(1u);
+  }
+  TEST_ASSERT_EQUAL_UINT8(0u, beginCalls_u8);
+
+  diagNvmMarkDirty(&node, 0u);
+  tick(1u);
+  TEST_ASSERT_EQUAL_UINT8(1u, beginCalls_u8);
+}
+
+/**
+ * Test: diagNvmMainFunction_BackendFailureRetried
+ * Description: The backend refuses the first batch, then accepts it
+ * Expected: The batch is closed and retried after a new commit delay
+ */
+void test_diagNvmMainFunction_BackendFailureRetried(void)
+{
+  source_au8[0] = 0x77u;
+  diagNvmMarkDirty(&node, 0u);
+  writeResult_ = E_NOT_OK;
+  tick(QUIET_TICKS);
+  TEST_ASSERT_EQUAL_UINT8(1u, beginCalls_u8);
+  TEST_ASSERT_EQUAL_UINT8(1u, endCalls_u8);
+
+  writeResult_ = E_OK;
+  tick(QUIET_TICKS);
+  TEST_ASSERT_EQUAL_UINT8(2u, beginCalls_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x77, image_au8[0]);
+}
+
+/**
+ * Test: diagNvmMainFunction_DidAndDtcSameBatch
+ * Description: Write a DID and update the fault memory, then stay quiet for the commit delay
+ * Expected: One batch writing both blocks at their image offsets
+ */
+void test_diagNvmMainFunction_DidAndDtcSameBatch(void)
+{
+  source_au8[0] = 0x11u;
+  diagNvmMarkDirty(&node, 0u);
+  faultMemory_pu8[0] = 0x22u;
+  diagNvmMarkDirty(&node, DIAG_NVM_DTC_BLOCK);
+
+  tick(QUIET_TICKS);
+
+  TEST_ASSERT_EQUAL_UINT8(1u, beginCalls_u8);
+  TEST_ASSERT_EQUAL_UINT8(2u, writeCalls_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x11, image_au8[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x22, image_au8[4]);
+}
+
+/* ============================================================================
+ * Test Cases: Flush
+ * ============================================================================
+ */
+
+/**
+ * Test: diagNvmFlush_Immediate
+ * Description: Flush right after a write, then again with nothing staged
+ * Expected: The first flush commits the block, the second one does not call the backend
+ */
+void test_diagNvmFlush_Immediate(void)
+{
+  source_au8[3] = 0xA5u;
+  diagNvmMarkDirty(&node, 0u);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagNvmFlush(&node));
+  TEST_ASSERT_EQUAL_HEX8(0xA5, image_au8[3]);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagNvmFlush(&node));
+  TEST_ASSERT_EQUAL_UINT8(1u, beginCalls_u8);
+}
+
+/* ============================================================================
+ * Test Cases: Node Slots
+ * ============================================================================
+ */
+
+/**
+ * Test: diagNvmFlush_NodeSlot
+ * Description: Load and commit a node whose slot starts at offset 8 of the image
+ * Expected: The node loads and writes its own slot, the slot of node 0 is untouched
+ */
+void test_diagNvmFlush_NodeSlot(void)
+{
+  const uint8 expected[4] = {0x11, 0x22, 0x33, 0x44};
+
+  memcpy(&image_au8[8], expected, sizeof(expected));
+  readResult_ = E_OK;
+  node.nvmBase_u16 = 8u;
+  diagNvmInit(&node);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, source_au8, 4);
+
+  source_au8[0] = 0x55u;
+  diagNvmMarkDirty(&node, 0u);
+  TEST_ASSERT_EQUAL_INT(E_OK, diagNvmFlush(&node));
+
+  TEST_ASSERT_EQUAL_HEX8(0x55, image_au8[8]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, image_au8[0]);
+}
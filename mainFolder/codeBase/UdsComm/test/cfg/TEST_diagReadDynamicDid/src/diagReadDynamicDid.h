@@ -0,0 +1,17 @@
+
+
+#ifndef DIAG_READ_DYNAMIC_DID_H
+#define DIAG_READ_DYNAMIC_DID_H
+
+#include "diagnostic_cfg_priv.h"
+
+Std_ReturnType defineDynamicDid(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_dynDid_u16, const uint8 *l_parts_pu8, uint8 l_partCount_u8);
+
+Std_ReturnType clearDynamicDid(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_dynDid_u16);
+
+const diagDynDid_t *diagFindDynamicDid(const diagNode_t *const node_ps, const uint16 did_u16);
+
+Std_ReturnType diagReadDynamicDid(diagNode_t *const node_ps, const diagDynDid_t *const dyn_ps, uint8*const  output_pu8,
+    uint8*const  size_pu8, uint8* const errCode_pu8);
+
+#endif
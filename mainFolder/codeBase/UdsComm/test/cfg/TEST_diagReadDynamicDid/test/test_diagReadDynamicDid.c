@@ -0,0 +1,166 @@
+#include "unity.h"
+#include <string.h>
+#include "diagReadDynamicDid.h"
+#include "mock_diagnostic_cfg.h"
+
+/* Source DIDs: two data DIDs and a 4-byte handler DID */
+static uint8 srcByte_u8 = 0x11u;
+static uint8 srcArray_au8[4] = {0x21u, 0x22u, 0x23u, 0x24u};
+
+const uint16 diagDidKeys_cau16[] = { 0x0100u, 0x0200u, 0x0300u };
+
+const diagDidEntry_t diagDidTable[] =
+{
+    { 0x0100u, 0x0100u, 1u, NULL, NULL, &srcByte_u8, NULL, NULL, NULL, NULL },
+    { 0x0200u, 0x0200u, 4u, NULL, NULL, srcArray_au8, NULL, NULL, NULL, NULL },
+    { 0x0300u, 0x0300u, 4u, NULL, NULL, NULL, NULL, NULL, NULL, NULL }, /* Handler served by the mock */
+};
+
+const uint16 diagDidTableSize_u16 = (uint16)(sizeof(diagDidTable) / sizeof(diagDidTable[0]));
+
+static const diagDidTable_t table = { diagDidKeys_cau16, diagDidTable, (uint16)(sizeof(diagDidTable) / sizeof(diagDidTable[0])) };
+
+/* Node whose composite DIDs are defined, bound to the table above */
+static diagNode_t node;
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  uint8 errCode = 0u;
+  memset(&node, 0, sizeof(node));
+  node.table_ps = &table;
+  (void)clearDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_ALL);
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Definition
+ * ============================================================================
+ */
+
+/**
+ * Test: defineDynamicDid_DataSlices
+ * Description: Define a composite DID from a whole data DID and a slice of another
+ * Expected: The parts are gathered in definition order
+ */
+void test_defineDynamicDid_DataSlices(void)
+{
+  const uint8 parts[8] = {0x01, 0x00, 1, 1,   0x02, 0x00, 2, 2};
+  const uint8 expected[3] = {0x11, 0x22, 0x23};
+  uint8 output[8] = {0};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST, parts, 2u));
+  TEST_ASSERT_NOT_NULL(diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagReadDynamicDid(&node, diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST), output, &size, &errCode));
+  TEST_ASSERT_EQUAL_INT(3, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, output, 3);
+}
+
+/**
+ * Test: defineDynamicDid_AppendParts
+ * Description: Define the same composite DID in two requests
+ * Expected: The second request appends its part
+ */
+void test_defineDynamicDid_AppendParts(void)
+{
+  const uint8 part1[4] = {0x01, 0x00, 1, 1};
+  const uint8 part2[4] = {0x02, 0x00, 4, 1};
+  const uint8 expected[2] = {0x11, 0x24};
+  uint8 output[8] = {0};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST, part1, 1u));
+  TEST_ASSERT_EQUAL_INT(E_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST, part2, 1u));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagReadDynamicDid(&node, diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST), output, &size, &errCode));
+  TEST_ASSERT_EQUAL_INT(2, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, output, 2);
+}
+
+/**
+ * Test: defineDynamicDid_RefusedPartLeavesDefinition
+ * Description: Define a composite DID with a valid part and a slice past the end of its source
+ * Expected: NRC 0x31, the composite DID stays undefined
+ */
+void test_defineDynamicDid_RefusedPartLeavesDefinition(void)
+{
+  const uint8 parts[8] = {0x01, 0x00, 1, 1,   0x02, 0x00, 4, 2};
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST, parts, 2u));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+  TEST_ASSERT_NULL(diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST));
+}
+
+/**
+ * Test: defineDynamicDid_OutsideReservedRange
+ * Description: Define a DID outside LIN_DIAG_DYN_DID_FIRST..+LIN_DIAG_DYN_DID_COUNT
+ * Expected: NRC 0x31
+ */
+void test_defineDynamicDid_OutsideReservedRange(void)
+{
+  const uint8 parts[4] = {0x01, 0x00, 1, 1};
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT, parts, 1u));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+}
+
+/**
+ * Test: clearDynamicDid_One
+ * Description: Define two composite DIDs and clear the first one
+ * Expected: Only the second one is still defined
+ */
+void test_clearDynamicDid_One(void)
+{
+  const uint8 parts[4] = {0x01, 0x00, 1, 1};
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST, parts, 1u));
+  TEST_ASSERT_EQUAL_INT(E_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST + 1u, parts, 1u));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, clearDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST));
+
+  TEST_ASSERT_NULL(diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST));
+  TEST_ASSERT_NOT_NULL(diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST + 1u));
+}
+
+/* ============================================================================
+ * Test Cases: Handler Sources
+ * ============================================================================
+ */
+
+/**
+ * Test: diagReadDynamicDid_HandlerSliceMovedDown
+ * Description: Read a composite DID made of a data byte and bytes 3..4 of a handler DID
+ * Expected: The handler writes its whole DID after the data byte, the slice is moved down in place
+ */
+void test_diagReadDynamicDid_HandlerSliceMovedDown(void)
+{
+  const uint8 parts[8] = {0x01, 0x00, 1, 1,   0x03, 0x00, 3, 2};
+  uint8 handler_output[4] = {0x31, 0x32, 0x33, 0x34};
+  const uint8 expected[3] = {0x11, 0x33, 0x34};
+  uint8 output[8] = {0};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, defineDynamicDid(&node, &errCode, LIN_DIAG_DYN_DID_FIRST, parts, 2u));
+  TEST_ASSERT_EQUAL_INT(5, diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST)->span_u8); /* 1 + whole handler DID */
+
+  expect_getHandlersForReadDataById(&node, NULL, 0x0300, NULL, NULL, &output[1], 4);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(4);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(handler_output, 4);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagReadDynamicDid(&node, diagFindDynamicDid(&node, LIN_DIAG_DYN_DID_FIRST), output, &size, &errCode));
+  TEST_ASSERT_EQUAL_INT(3, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, output, 3);
+}
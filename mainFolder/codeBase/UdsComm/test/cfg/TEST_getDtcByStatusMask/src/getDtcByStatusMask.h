@@ -0,0 +1,16 @@
+
+#ifndef GET_DTC_BY_STATUS_MASK_H
+#define GET_DTC_BY_STATUS_MASK_H
+
+#include "diagnostic_cfg_priv.h"
+
+void diagDtcInit(diagNode_t *node_ps);
+
+Std_ReturnType diagDtcReportEvent(diagNode_t *node_ps, uint8 l_event_u8, uint8 l_failed_u8, const uint8 *l_snapshot_pu8);
+
+uint8 getDtcByStatusMask(diagNode_t *node_ps, uint8 l_statusMask_u8, uint8 *l_out_pu8);
+
+Std_ReturnType getDtcByNumber(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint32_t l_dtc_u32, uint8 *l_status_pu8, uint8 *l_occurrence_pu8,
+    const uint8 **l_snapshot_ppu8);
+
+#endif
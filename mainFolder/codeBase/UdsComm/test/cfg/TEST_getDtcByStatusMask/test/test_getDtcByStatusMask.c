@@ -0,0 +1,206 @@
+#include "unity.h"
+#include <string.h>
+#include "getDtcByStatusMask.h"
+
+#define DTC_STATUS_FAILED    (DIAG_DTC_STATUS_TF | DIAG_DTC_STATUS_TFTOC | DIAG_DTC_STATUS_PDTC | \
+                              DIAG_DTC_STATUS_CDTC | DIAG_DTC_STATUS_TFSLC)
+
+/* Node under test */
+static diagNode_t node;
+
+/* NVM stand-in: fault memory commits requested */
+static uint8 dirtyCalls_u8;
+
+void diagNvmMarkDirty(diagNode_t *const node_ps, const uint8 block_u8)
+{
+  TEST_ASSERT_EQUAL_PTR(&node, node_ps);
+  TEST_ASSERT_EQUAL_UINT8(DIAG_NVM_DTC_BLOCK, block_u8);
+  dirtyCalls_u8++;
+}
+
+/* The store is persisted in the node: an all-zero image is an empty fault memory */
+static void clearStore(void)
+{
+  memset(&node.dtcStore_s, 0, sizeof(node.dtcStore_s));
+  diagDtcInit(&node);
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  clearStore();
+  dirtyCalls_u8 = 0u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Event Reporting
+ * ============================================================================
+ */
+
+/**
+ * Test: diagDtcReportEvent_FirstFailure
+ * Description: Report a failure of the overvoltage event with a snapshot
+ * Expected: DTC stored with failed/confirmed status, occurrence 1, snapshot kept, one NVM commit requested
+ */
+void test_diagDtcReportEvent_FirstFailure(void)
+{
+  const uint8 snapshot[LIN_DIAG_DTC_SNAPSHOT_SIZE] = {0x3A, 0x98, 0x02, 0x00};
+  const uint8 *stored = NULL;
+  uint8 status = 0u;
+  uint8 occurrence = 0u;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 1u, snapshot));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getDtcByNumber(&node, &errCode, diagDtcNumbers_cau32[DIAG_DTC_EVENT_OVERVOLTAGE],
+                                             &status, &occurrence, &stored));
+  TEST_ASSERT_EQUAL_HEX8(DTC_STATUS_FAILED, status);
+  TEST_ASSERT_EQUAL_UINT8(1u, occurrence);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(snapshot, stored, LIN_DIAG_DTC_SNAPSHOT_SIZE);
+  TEST_ASSERT_EQUAL_UINT8(1u, dirtyCalls_u8);
+}
+
+/**
+ * Test: diagDtcReportEvent_RepeatedResults
+ * Description: Report failed twice, passed twice, then failed again
+ * Expected: Only the changes request a commit; the occurrence counter counts the two failures
+ */
+void test_diagDtcReportEvent_RepeatedResults(void)
+{
+  const uint8 *stored = NULL;
+  uint8 status = 0u;
+  uint8 occurrence = 0u;
+  uint8 errCode = 0u;
+
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 1u, NULL);
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 1u, NULL);
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 0u, NULL);
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 0u, NULL);
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 1u, NULL);
+
+  (void)getDtcByNumber(&node, &errCode, diagDtcNumbers_cau32[DIAG_DTC_EVENT_OVERVOLTAGE], &status, &occurrence, &stored);
+  TEST_ASSERT_EQUAL_UINT8(2u, occurrence);
+  TEST_ASSERT_EQUAL_UINT8(3u, dirtyCalls_u8);
+}
+
+/**
+ * Test: diagDtcReportEvent_PassedNeverFailed
+ * Description: Report a passed result for an event that never failed
+ * Expected: Nothing stored, no commit requested
+ */
+void test_diagDtcReportEvent_PassedNeverFailed(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, diagDtcReportEvent(&node, DIAG_DTC_EVENT_UNDERVOLTAGE, 0u, NULL));
+
+  TEST_ASSERT_EQUAL_UINT8(0u, getDtcByStatusMask(&node, 0xFFu, NULL));
+  TEST_ASSERT_EQUAL_UINT8(0u, dirtyCalls_u8);
+}
+
+/**
+ * Test: diagDtcReportEvent_UnknownEvent
+ * Description: Report an event beyond DIAG_DTC_EVENT_COUNT
+ * Expected: E_NOT_OK, nothing stored
+ */
+void test_diagDtcReportEvent_UnknownEvent(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, diagDtcReportEvent(&node, DIAG_DTC_EVENT_COUNT, 1u, NULL));
+  TEST_ASSERT_EQUAL_UINT8(0u, getDtcByStatusMask(&node, 0xFFu, NULL));
+}
+
+/* ============================================================================
+ * Test Cases: Status Mask Queries
+ * ============================================================================
+ */
+
+/**
+ * Test: getDtcByStatusMask_OrderAndFilter
+ * Description: Overvoltage fails then heals, undervoltage fails; query testFailed, then confirmedDTC
+ * Expected: testFailed matches undervoltage only; confirmedDTC matches both, oldest first
+ */
+void test_getDtcByStatusMask_OrderAndFilter(void)
+{
+  const uint32_t ov = diagDtcNumbers_cau32[DIAG_DTC_EVENT_OVERVOLTAGE];
+  const uint32_t uv = diagDtcNumbers_cau32[DIAG_DTC_EVENT_UNDERVOLTAGE];
+  uint8 records[4u * LIN_DIAG_DTC_CAPACITY];
+
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 1u, NULL);
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 0u, NULL);
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_UNDERVOLTAGE, 1u, NULL);
+
+  TEST_ASSERT_EQUAL_UINT8(1u, getDtcByStatusMask(&node, DIAG_DTC_STATUS_TF, records));
+  TEST_ASSERT_EQUAL_HEX8((uint8)(uv >> 16), records[0]);
+  TEST_ASSERT_EQUAL_HEX8((uint8)uv, records[2]);
+  TEST_ASSERT_EQUAL_HEX8(DTC_STATUS_FAILED, records[3]);
+
+  TEST_ASSERT_EQUAL_UINT8(2u, getDtcByStatusMask(&node, DIAG_DTC_STATUS_CDTC, records));
+  TEST_ASSERT_EQUAL_HEX8((uint8)ov, records[2]);
+  TEST_ASSERT_EQUAL_HEX8((uint8)(DTC_STATUS_FAILED & (uint8)~DIAG_DTC_STATUS_TF), records[3]);
+  TEST_ASSERT_EQUAL_HEX8((uint8)uv, records[6]);
+}
+
+/**
+ * Test: getDtcByStatusMask_UnsupportedBits
+ * Description: Query with status bits the fault memory does not maintain
+ * Expected: No match, even with DTCs stored
+ */
+void test_getDtcByStatusMask_UnsupportedBits(void)
+{
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_OVERVOLTAGE, 1u, NULL);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, getDtcByStatusMask(&node, (uint8)~DIAG_DTC_STATUS_AVAILABILITY, NULL));
+}
+
+/* ============================================================================
+ * Test Cases: Persistence
+ * ============================================================================
+ */
+
+/**
+ * Test: diagDtcInit_NewOperationCycle
+ * Description: Store a failure, then init again on the same (persisted) store
+ * Expected: DTC kept with its status, testFailedThisOperationCycle cleared and the index rebuilt
+ */
+void test_diagDtcInit_NewOperationCycle(void)
+{
+  uint8 records[4u * LIN_DIAG_DTC_CAPACITY];
+
+  (void)diagDtcReportEvent(&node, DIAG_DTC_EVENT_UNDERVOLTAGE, 1u, NULL);
+  diagDtcInit(&node);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, getDtcByStatusMask(&node, DIAG_DTC_STATUS_TFTOC, NULL));
+  TEST_ASSERT_EQUAL_UINT8(1u, getDtcByStatusMask(&node, DIAG_DTC_STATUS_TF, records));
+  TEST_ASSERT_EQUAL_HEX8((uint8)(DTC_STATUS_FAILED & (uint8)~DIAG_DTC_STATUS_TFTOC), records[3]);
+}
+
+/**
+ * Test: diagDtcInit_CorruptedStore
+ * Description: Init on a store whose count exceeds the capacity
+ * Expected: The fault memory starts empty
+ */
+void test_diagDtcInit_CorruptedStore(void)
+{
+  memset(&node.dtcStore_s, 0xFF, sizeof(node.dtcStore_s));
+  diagDtcInit(&node);
+
+  TEST_ASSERT_EQUAL_UINT8(0u, getDtcByStatusMask(&node, 0xFFu, NULL));
+}
+
+/**
+ * Test: getDtcByNumber_UnknownDtc
+ * Description: Read the data of a DTC number this ECU does not know
+ * Expected: E_NOT_OK with NRC 0x31
+ */
+void test_getDtcByNumber_UnknownDtc(void)
+{
+  const uint8 *stored = NULL;
+  uint8 status = 0u;
+  uint8 occurrence = 0u;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getDtcByNumber(&node, &errCode, 0x123456u, &status, &occurrence, &stored));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+}
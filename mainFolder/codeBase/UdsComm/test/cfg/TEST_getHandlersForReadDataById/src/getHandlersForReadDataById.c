@@ -0,0 +1,160 @@
+#include "diagnostic_cfg_priv.h"
+#define NULL ((void *)0)
+
+
+
+
+const diagDidEntry_t *diagFindDidEntry(const diagDidTable_t *const table_ps, const uint16 did_u16)
+{
+    uint16 l_low_u16 = 0u;
+    uint16 l_high_u16 = table_ps->size_u16;
+    const diagDidEntry_t *l_entry_ps = NULL;
+
+    /* Find the last entry whose first DID is <= did_u16 */
+    while (l_low_u16 < l_high_u16)
+    {
+        const uint16 l_mid_u16 = (uint16)(l_low_u16 + ((l_high_u16 - l_low_u16) >> 1));
+
+        if (did_u16 < table_ps->keys_pcu16[l_mid_u16])
+        {
+            l_high_u16 = l_mid_u16;
+        }
+        else
+        {
+            l_low_u16 = (uint16)(l_mid_u16 + 1u);
+        }
+    }
+
+    if (l_low_u16 > 0u)
+    {
+        l_entry_ps = &table_ps->entries_pcs[l_low_u16 - 1u];
+
+        if (did_u16 > l_entry_ps->didLast_u16)
+        {
+            l_entry_ps = NULL;
+        }
+    }
+
+    return l_entry_ps;
+}
+
+const uint8 *diagDidData(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16)
+{
+    const uint16 l_pos_u16 = (uint16)(offset_u16 * entry_ps->size_u16);
+
+    return (NULL != entry_ps->write_ps) ? &node_ps->didRam_au8[entry_ps->write_ps->ram_u16 + l_pos_u16]
+                                        : &entry_ps->data_pu8[l_pos_u16];
+}
+
+Std_ReturnType diagCopyDidData(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps,
+    const uint16 offset_u16, uint8*const  output_pu8, uint8* const errCode_pu8)
+{
+    const uint8 *const l_src_pu8 = diagDidData(node_ps, entry_ps, offset_u16);
+    uint16 l_idx_u16;
+
+    if ((NULL != entry_ps->dataHook_pf) && (E_OK != entry_ps->dataHook_pf(errCode_pu8)))
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u16 = 0u; l_idx_u16 < entry_ps->size_u16; l_idx_u16++)
+    {
+        output_pu8[l_idx_u16] = l_src_pu8[l_idx_u16];
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType getHandlersForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16,  uint8 *l_diagBufSize_u8,
+    Std_ReturnType *l_didSupported_,  uint8 *l_diagBuf_pu8, uint8 l_diagBufCapacity_u8)
+{
+    const diagDidEntry_t *const l_entry_ps = diagFindDidEntry(node_ps->table_ps, l_did_cu16);
+    const uint16 l_offset_u16 = (NULL != l_entry_ps) ? (uint16)(l_did_cu16 - l_entry_ps->didFirst_u16) : 0u;
+    Std_ReturnType l_result_ = E_OK;
+    uint8 l_errCode_u8 = 0;
+    uint32_t l_start_u32;
+
+    if (NULL == l_entry_ps)
+    {
+        const diagDynDid_t *const l_dyn_ps = diagFindDynamicDid(node_ps, l_did_cu16);
+
+        if (NULL == l_dyn_ps)
+        {
+            *l_didSupported_  = E_NOT_OK;
+            *l_errCode_pu8 = kLinDiagNrcRequestOutOfRange;
+            return E_NOT_OK;
+        }
+
+        if (l_dyn_ps->span_u8 > l_diagBufCapacity_u8)
+        {
+            *l_errCode_pu8 = kLinDiagNrcResponseTooLong;
+            return E_NOT_OK;
+        }
+
+        l_result_ = diagReadDynamicDid(node_ps, l_dyn_ps, l_diagBuf_pu8, l_diagBufSize_u8, &l_errCode_u8);
+        if (E_OK != l_result_)
+        {
+            *l_errCode_pu8 = (0u != l_errCode_u8) ? l_errCode_u8 : kLinDiagNrcConditionsNotCorrect;
+        }
+        return l_result_;
+    }
+
+    /* Streamed DIDs never go through the buffer, see getStreamForReadDataById */
+    if ((l_entry_ps->size_u16 > l_diagBufCapacity_u8) || (NULL != l_entry_ps->streamHandler_pf))
+    {
+        *l_errCode_pu8 = kLinDiagNrcResponseTooLong;
+        return E_NOT_OK;
+    }
+
+    *l_diagBufSize_u8 = (uint8)l_entry_ps->size_u16;
+    l_start_u32 = diagStatsNow();
+
+    if (NULL != l_entry_ps->data_pu8)
+    {
+        l_result_ = diagCopyDidData(node_ps, l_entry_ps, l_offset_u16, l_diagBuf_pu8, &l_errCode_u8);
+    }
+    else if (NULL != l_entry_ps->signal_ps)
+    {
+        l_result_ = diagEncodeSignal(l_entry_ps, l_offset_u16, l_diagBuf_pu8, &l_errCode_u8);
+    }
+    else if (NULL != l_entry_ps->asyncHandler_pf)
+    {
+        l_result_ = l_entry_ps->asyncHandler_pf(DIAG_OPSTATUS_INITIAL, &node_ps->asyncState_u32, l_diagBuf_pu8,
+                                                l_diagBufCapacity_u8, l_diagBufSize_u8, &l_errCode_u8);
+    }
+    else if ((NULL != l_entry_ps->cache_ps) &&
+             (E_OK == diagCacheRead(node_ps, l_entry_ps, l_offset_u16, l_diagBuf_pu8, l_diagBufSize_u8)))
+    {
+        /* Fresh response in the cache: no handler call */
+    }
+    else
+    {
+        /* Taken before the call: a value changing while the handler runs is not cached as fresh */
+        const uint16 l_stamp_u16 = (NULL != l_entry_ps->cache_ps) ? diagCacheStamp(node_ps, l_entry_ps) : 0u;
+
+        if (NULL != l_entry_ps->rangeHandler_pf)
+        {
+            l_result_ = l_entry_ps->rangeHandler_pf(l_offset_u16, l_diagBuf_pu8, l_diagBufCapacity_u8, l_diagBufSize_u8,
+                                                    &l_errCode_u8);
+        }
+        else
+        {
+            l_result_ = l_entry_ps->handler_pf(l_diagBuf_pu8, l_diagBufCapacity_u8, l_diagBufSize_u8, &l_errCode_u8);
+        }
+
+        if ((E_OK == l_result_) && (NULL != l_entry_ps->cache_ps))
+        {
+            diagCacheWrite(node_ps, l_entry_ps, l_offset_u16, l_stamp_u16, l_diagBuf_pu8, *l_diagBufSize_u8);
+        }
+    }
+
+    if ((E_OK != l_result_) && (DIAG_E_PENDING != l_result_))
+    {
+        /* A handler refusing the read without an NRC gets the generic one */
+        *l_errCode_pu8 = (0u != l_errCode_u8) ? l_errCode_u8 : kLinDiagNrcConditionsNotCorrect;
+    }
+
+    diagStatsDidDone(l_entry_ps, DIAG_OPSTATUS_INITIAL, l_result_, *l_errCode_pu8, l_start_u32);
+
+    return l_result_;
+}
@@ -0,0 +1,11 @@
+
+
+#ifndef GET_HANDLERS_FOR_READ_DATA_BY_ID_H
+#define GET_HANDLERS_FOR_READ_DATA_BY_ID_H
+
+#include "diagnostic_cfg_priv.h"
+
+Std_ReturnType getHandlersForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16,  uint8 *l_diagBufSize_u8,
+    Std_ReturnType *l_didSupported_,  uint8 *l_diagBuf_pu8, uint8 l_diagBufCapacity_u8);
+
+#endif
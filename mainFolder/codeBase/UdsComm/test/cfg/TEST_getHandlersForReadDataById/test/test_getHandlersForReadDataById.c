@@ -0,0 +1,278 @@
+#include "unity.h"
+#include <string.h>
+#include "getHandlersForReadDataById.h"
+
+/* Data sources: a single 2-byte DID and a range of 4 DIDs, 2 bytes each */
+static uint8 single_au8[2] = {0x12u, 0x34u};
+static uint8 range_au8[4u * 2u] = {0x00u, 0x01u, 0x10u, 0x11u, 0x20u, 0x21u, 0x30u, 0x31u};
+
+/* Consistency hook of the guarded DID */
+static Std_ReturnType hookResult;
+static uint8 hookNrc;
+static uint8 hookCalls;
+
+static Std_ReturnType guardHook(uint8* const errCode_pu8)
+{
+  hookCalls++;
+  if (E_OK != hookResult)
+  {
+    *errCode_pu8 = hookNrc;
+  }
+  return hookResult;
+}
+
+/* Writable DID: served from the RAM of the node, single_au8 is only its default */
+static const diagDidWrite_t write_0400 = { 0u, DIAG_NVM_NO_BLOCK };
+
+const uint16 diagDidKeys_cau16[] = { 0x0100u, 0x0200u, 0x0300u, 0x0400u };
+
+const diagDidEntry_t diagDidTable[] =
+{
+    { 0x0100u, 0x0100u, 2u, NULL, NULL, single_au8, NULL, NULL, NULL, NULL, NULL, NULL },
+    { 0x0200u, 0x0203u, 2u, NULL, NULL, range_au8, NULL, NULL, NULL, NULL, NULL, NULL },
+    { 0x0300u, 0x0300u, 2u, NULL, NULL, single_au8, &guardHook, NULL, NULL, NULL, NULL, NULL },
+    { 0x0400u, 0x0400u, 2u, NULL, NULL, single_au8, NULL, NULL, NULL, NULL, &write_0400, NULL },
+};
+
+const uint16 diagDidTableSize_u16 = (uint16)(sizeof(diagDidTable) / sizeof(diagDidTable[0]));
+
+static const diagDidTable_t table = { diagDidKeys_cau16, diagDidTable, (uint16)(sizeof(diagDidTable) / sizeof(diagDidTable[0])) };
+
+/* Node served, bound to the table above */
+static diagNode_t node;
+
+/* Stand-ins of the rest of the configuration layer, data DIDs do not reach them */
+uint32_t diagStatsNow(void)
+{
+  return 0u;
+}
+
+void diagStatsDidDone(const diagDidEntry_t *const entry_ps, const uint8 opStatus_u8, const Std_ReturnType result_,
+    const uint8 nrc_u8, const uint32_t start_u32)
+{
+  (void)entry_ps;
+  (void)opStatus_u8;
+  (void)result_;
+  (void)nrc_u8;
+  (void)start_u32;
+}
+
+const diagDynDid_t *diagFindDynamicDid(const diagNode_t *const node_ps, const uint16 did_u16)
+{
+  (void)node_ps;
+  (void)did_u16;
+  return NULL;
+}
+
+Std_ReturnType diagReadDynamicDid(diagNode_t *const node_ps, const diagDynDid_t *const dyn_ps, uint8*const  output_pu8,
+    uint8*const  size_pu8, uint8* const errCode_pu8)
+{
+  (void)node_ps;
+  (void)dyn_ps;
+  (void)output_pu8;
+  (void)size_pu8;
+  (void)errCode_pu8;
+  TEST_FAIL_MESSAGE("no dynamic DID defined");
+  return E_NOT_OK;
+}
+
+Std_ReturnType diagEncodeSignal(const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8* const errCode_pu8)
+{
+  (void)entry_ps;
+  (void)offset_u16;
+  (void)output_pu8;
+  (void)errCode_pu8;
+  TEST_FAIL_MESSAGE("no scaled DID in the table");
+  return E_NOT_OK;
+}
+
+Std_ReturnType diagCacheRead(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8*const  size_pu8)
+{
+  (void)node_ps;
+  (void)entry_ps;
+  (void)offset_u16;
+  (void)output_pu8;
+  (void)size_pu8;
+  TEST_FAIL_MESSAGE("no cached DID in the table");
+  return E_NOT_OK;
+}
+
+uint16 diagCacheStamp(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps)
+{
+  (void)node_ps;
+  (void)entry_ps;
+  return 0u;
+}
+
+void diagCacheWrite(diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    const uint16 stamp_u16, const uint8 *const response_pu8, const uint8 size_u8)
+{
+  (void)node_ps;
+  (void)entry_ps;
+  (void)offset_u16;
+  (void)stamp_u16;
+  (void)response_pu8;
+  (void)size_u8;
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  hookResult = E_OK;
+  hookNrc = 0u;
+  hookCalls = 0u;
+  memset(&node, 0, sizeof(node));
+  node.table_ps = &table;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Data DIDs
+ * ============================================================================
+ */
+
+/**
+ * Test: getHandlersForReadDataById_SingleDataDid
+ * Description: Read a single 2-byte data DID into a buffer with room to spare
+ * Expected: E_OK, the source copied and its size reported, nothing written past it
+ */
+void test_getHandlersForReadDataById_SingleDataDid(void)
+{
+  const uint8 expected[3] = {0x12, 0x34, 0xAA};
+  uint8 output[3] = {0xAA, 0xAA, 0xAA};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+  Std_ReturnType supported = E_OK;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getHandlersForReadDataById(&node, &errCode, 0x0100u, &size, &supported, output, 3u));
+  TEST_ASSERT_EQUAL_INT(E_OK, supported);
+  TEST_ASSERT_EQUAL_INT(2, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, output, sizeof(expected));
+}
+
+/**
+ * Test: getHandlersForReadDataById_RangeElement
+ * Description: Read the first, third and last DID of a 4-DID data range
+ * Expected: Element [offset] of the source, offset * size_u16 bytes in
+ */
+void test_getHandlersForReadDataById_RangeElement(void)
+{
+  const uint8 expected0[2] = {0x00, 0x01};
+  const uint8 expected2[2] = {0x20, 0x21};
+  const uint8 expected3[2] = {0x30, 0x31};
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+  Std_ReturnType supported = E_OK;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getHandlersForReadDataById(&node, &errCode, 0x0200u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected0, output, 2);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getHandlersForReadDataById(&node, &errCode, 0x0202u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected2, output, 2);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getHandlersForReadDataById(&node, &errCode, 0x0203u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_INT(2, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected3, output, 2);
+}
+
+/**
+ * Test: getHandlersForReadDataById_HookRefuses
+ * Description: Read a data DID whose consistency hook refuses with NRC 0x24, then accepts
+ * Expected: E_NOT_OK with the NRC of the hook and the output untouched, then the data
+ */
+void test_getHandlersForReadDataById_HookRefuses(void)
+{
+  const uint8 expected[2] = {0x12, 0x34};
+  uint8 output[2] = {0xAA, 0xAA};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+  Std_ReturnType supported = E_OK;
+
+  hookResult = E_NOT_OK;
+  hookNrc = 0x24u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getHandlersForReadDataById(&node, &errCode, 0x0300u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_INT(E_OK, supported); /* Supported, refused for now */
+  TEST_ASSERT_EQUAL_HEX8(0x24, errCode);
+  TEST_ASSERT_EQUAL_HEX8(0xAA, output[0]);
+
+  hookResult = E_OK;
+  TEST_ASSERT_EQUAL_INT(E_OK, getHandlersForReadDataById(&node, &errCode, 0x0300u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, output, 2);
+  TEST_ASSERT_EQUAL_UINT8(2u, hookCalls);
+}
+
+/**
+ * Test: getHandlersForReadDataById_WritableFromNode
+ * Description: Read a writable data DID after its copy in the node RAM was changed
+ * Expected: E_OK with the bytes of the node, not the ones of the default source
+ */
+void test_getHandlersForReadDataById_WritableFromNode(void)
+{
+  const uint8 expected[2] = {0x56, 0x78};
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+  Std_ReturnType supported = E_OK;
+
+  node.didRam_au8[0] = 0x56u;
+  node.didRam_au8[1] = 0x78u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getHandlersForReadDataById(&node, &errCode, 0x0400u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_INT(2, size);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, output, 2);
+  TEST_ASSERT_EQUAL_HEX8(0x12, single_au8[0]);
+}
+
+/* ============================================================================
+ * Test Cases: Refused Reads
+ * ============================================================================
+ */
+
+/**
+ * Test: getHandlersForReadDataById_UnsupportedDid
+ * Description: Read a DID in none of the table entries, between two ranges and past the last
+ * Expected: E_NOT_OK, the DID reported unsupported with NRC 0x31
+ */
+void test_getHandlersForReadDataById_UnsupportedDid(void)
+{
+  uint8 output[2] = {0};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+  Std_ReturnType supported = E_OK;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getHandlersForReadDataById(&node, &errCode, 0x0204u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, supported);
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+
+  supported = E_OK;
+  errCode = 0u;
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getHandlersForReadDataById(&node, &errCode, 0xF190u, &size, &supported, output, 2u));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, supported);
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+}
+
+/**
+ * Test: getHandlersForReadDataById_OverCapacity
+ * Description: Read a 2-byte data DID into a buffer of one byte
+ * Expected: E_NOT_OK with NRC 0x14, nothing written and the hook not called
+ */
+void test_getHandlersForReadDataById_OverCapacity(void)
+{
+  uint8 output[2] = {0xAA, 0xAA};
+  uint8 size = 0u;
+  uint8 errCode = 0u;
+  Std_ReturnType supported = E_OK;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getHandlersForReadDataById(&node, &errCode, 0x0300u, &size, &supported, output, 1u));
+  TEST_ASSERT_EQUAL_INT(E_OK, supported);
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcResponseTooLong, errCode);
+  TEST_ASSERT_EQUAL_HEX8(0xAA, output[0]);
+  TEST_ASSERT_EQUAL_UINT8(0u, hookCalls);
+}
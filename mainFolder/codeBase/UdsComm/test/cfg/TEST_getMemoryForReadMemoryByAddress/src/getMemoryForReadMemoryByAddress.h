@@ -0,0 +1,10 @@
+
+#ifndef GET_MEMORY_FOR_READ_MEMORY_BY_ADDRESS_H
+#define GET_MEMORY_FOR_READ_MEMORY_BY_ADDRESS_H
+
+#include "diagnostic_cfg_priv.h"
+
+Std_ReturnType getMemoryForReadMemoryByAddress(uint8 *l_errCode_pu8, uintptr_t l_address_uptr, uint16 l_size_u16,
+    const uint8 **l_data_ppu8);
+
+#endif
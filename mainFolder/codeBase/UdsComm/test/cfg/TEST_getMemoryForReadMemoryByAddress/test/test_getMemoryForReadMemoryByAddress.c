@@ -0,0 +1,122 @@
+#include "unity.h"
+#include "getMemoryForReadMemoryByAddress.h"
+
+/* Whitelist under test: two RAM structures */
+static uint8 structA_au8[16];
+static uint8 structB_au8[4];
+
+const diagMemRegion_t diagMemRegions[] =
+{
+    { structA_au8, sizeof(structA_au8) },
+    { structB_au8, sizeof(structB_au8) },
+};
+
+const uint8 diagMemRegionCount_u8 = 2u;
+
+/* Test setup and teardown */
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Whitelisted Windows
+ * ============================================================================
+ */
+
+/**
+ * Test: getMemoryForReadMemoryByAddress_WholeRegion
+ * Description: Read a whole region, then its last byte
+ * Expected: E_OK, the data points into the region itself (no copy)
+ */
+void test_getMemoryForReadMemoryByAddress_WholeRegion(void)
+{
+  const uint8 *data = NULL;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getMemoryForReadMemoryByAddress(&errCode, (uintptr_t)structA_au8, 16u, &data));
+  TEST_ASSERT_EQUAL_PTR(structA_au8, data);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getMemoryForReadMemoryByAddress(&errCode, (uintptr_t)&structA_au8[15], 1u, &data));
+  TEST_ASSERT_EQUAL_PTR(&structA_au8[15], data);
+}
+
+/**
+ * Test: getMemoryForReadMemoryByAddress_SecondRegion
+ * Description: Read inside the second region of the whitelist
+ * Expected: E_OK with the matching address
+ */
+void test_getMemoryForReadMemoryByAddress_SecondRegion(void)
+{
+  const uint8 *data = NULL;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, getMemoryForReadMemoryByAddress(&errCode, (uintptr_t)&structB_au8[1], 3u, &data));
+  TEST_ASSERT_EQUAL_PTR(&structB_au8[1], data);
+}
+
+/* ============================================================================
+ * Test Cases: Refused Windows
+ * ============================================================================
+ */
+
+/**
+ * Test: getMemoryForReadMemoryByAddress_PastRegionEnd
+ * Description: Read one byte more than the region holds
+ * Expected: E_NOT_OK with NRC 0x31
+ */
+void test_getMemoryForReadMemoryByAddress_PastRegionEnd(void)
+{
+  const uint8 *data = NULL;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getMemoryForReadMemoryByAddress(&errCode, (uintptr_t)&structA_au8[1], 16u, &data));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+  TEST_ASSERT_NULL(data);
+}
+
+/**
+ * Test: getMemoryForReadMemoryByAddress_BeforeRegion
+ * Description: Start the window one byte before a region
+ * Expected: E_NOT_OK with NRC 0x31
+ */
+void test_getMemoryForReadMemoryByAddress_BeforeRegion(void)
+{
+  const uint8 *data = NULL;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK,
+                        getMemoryForReadMemoryByAddress(&errCode, (uintptr_t)structB_au8 - 1u, 2u, &data));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+}
+
+/**
+ * Test: getMemoryForReadMemoryByAddress_WrappingAddress
+ * Description: Window at the top of the address space, its end wraps around to 0
+ * Expected: E_NOT_OK with NRC 0x31
+ */
+void test_getMemoryForReadMemoryByAddress_WrappingAddress(void)
+{
+  const uint8 *data = NULL;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getMemoryForReadMemoryByAddress(&errCode, UINTPTR_MAX, 2u, &data));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+}
+
+/**
+ * Test: getMemoryForReadMemoryByAddress_ZeroSize
+ * Description: Read zero bytes at the start of a region
+ * Expected: E_NOT_OK with NRC 0x31
+ */
+void test_getMemoryForReadMemoryByAddress_ZeroSize(void)
+{
+  const uint8 *data = NULL;
+  uint8 errCode = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, getMemoryForReadMemoryByAddress(&errCode, (uintptr_t)structA_au8, 0u, &data));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcRequestOutOfRange, errCode);
+}
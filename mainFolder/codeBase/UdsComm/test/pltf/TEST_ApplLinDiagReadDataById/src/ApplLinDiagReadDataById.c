@@ -5,40 +5,224 @@ uint8_t pbLinDiagBuffer[32];
 /* Message length */
 uint16_t g_linDiagDataLength = 0;
 
+LinDiag_Channel_t LinDiag_DefaultChannel =
+{
+    .req_pu8  = pbLinDiagBuffer,
+    .resp_pu8 = pbLinDiagBuffer,
+    .nad_u8   = LIN_DIAG_NODE_NAD,
+    .reqNad_u8 = LIN_DIAG_NODE_NAD,  /* The LIN stack fills pbLinDiagBuffer with requests for this node only */
+    .node_ps  = &diagDefaultNode,
+    .session_u8 = LIN_DIAG_SESSION_DEFAULT,
+};
 
 
 
-void ApplLinDiagReadDataById(void)
+
+void LinDiagStartRequest(LinDiag_Channel_t *const ch_ps)
 {
-  const uint16_t l_did_cu16 = ((uint16_t)(pbLinDiagBuffer[1] << 8) & 0xFF00) |
-                              ((uint16_t)pbLinDiagBuffer[2] & 0x00FF);
+    ch_ps->reqStart_u32 = diagStatsNow();
+    ch_ps->sid_u8 = ch_ps->req_pu8[0];
+    ch_ps->respTail_pu8 = NULL;
+    ch_ps->respTailLen_u16 = 0u;
+    LinDiagCaptureRequest(ch_ps);
+}
+
+Std_ReturnType LinDiagReadDataById(LinDiag_Channel_t *const ch_ps)
+{
+  const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+  const uint16_t l_didCount_cu16 = (l_reqLen_cu16 > 0u) ? (uint16_t)((l_reqLen_cu16 - 1u) / 2u) : 0u;
+  Std_ReturnType l_result_ = E_OK;
+  uint16_t l_idx_u16;
+
+  /* Request for another node: no response, a pending request of this node goes on */
+  checkCurrentNad(ch_ps->reqNad_u8, ch_ps->nad_u8, &l_result_);
+  if (E_OK != l_result_) {
+    return l_result_;
+  }
+
+  LinDiagCancelPending(ch_ps);
+  LinDiagStartRequest(ch_ps);
+
+  checkMsgDataLength(l_reqLen_cu16, &l_result_);
+
+  /* SID followed by a whole number of DIDs */
+  if ((E_OK == l_result_) &&
+      ((0u == l_didCount_cu16) || (0u == (l_reqLen_cu16 & 1u)) || (l_didCount_cu16 > LIN_DIAG_RDBI_MAX_DIDS))) {
+    l_result_ = E_NOT_OK;
+  }
+
+  if (E_OK != l_result_) {
+    LinDiagSendNegResponse(ch_ps, kLinDiagNrcIncorrectMsgLength);
+    return l_result_;
+  }
+
+  /* The response may overwrite the request in place: save the DID list first */
+  for (l_idx_u16 = 0u; l_idx_u16 < l_didCount_cu16; l_idx_u16++) {
+    ch_ps->rdbiDids_au16[l_idx_u16] = ((uint16_t)(ch_ps->req_pu8[1u + (2u * l_idx_u16)] << 8) & 0xFF00) |
+                                      ((uint16_t)ch_ps->req_pu8[2u + (2u * l_idx_u16)] & 0x00FF);
+  }
+  ch_ps->rdbiDidCount_u8 = (uint8_t)l_didCount_cu16;
+  ch_ps->rdbiDidIdx_u8 = 0u;
+  ch_ps->rdbiRespPos_u8 = 1u;
+  ch_ps->rdbiSupported_u8 = 0u;
+  ch_ps->rcrrpSent_u8 = 0u;
+  ch_ps->pendingTicks_u16 = 0u;
+  ch_ps->pendingTotal_u16 = 0u;
+
+  return LinDiagRdbiAssemble(ch_ps, DIAG_OPSTATUS_INITIAL);
+}
+
+Std_ReturnType LinDiagRdbiAssemble(LinDiag_Channel_t *const ch_ps, uint8_t opStatus_u8)
+{
+  const uint8_t l_didCount_cu8 = ch_ps->rdbiDidCount_u8;
+  uint8_t * const l_resp_pu8 = ch_ps->resp_pu8;
   Std_ReturnType l_result_ = E_OK;
   uint8_t l_errCode_u8 = 0;
-  uint8_t * const l_diagBuf_pu8 = &pbLinDiagBuffer[3];
-  uint8_t l_diagBufSize_u8 = 0;
-  Std_ReturnType l_didSupported_ = E_OK;
+  uint8_t l_respPos_u8 = ch_ps->rdbiRespPos_u8;
+
+  ch_ps->pending_u8 = 0u;
+
+  /* Single pass: DID + data of every supported DID appended in request order */
+  for (; (ch_ps->rdbiDidIdx_u8 < l_didCount_cu8) && (E_OK == l_result_); ch_ps->rdbiDidIdx_u8++) {
+    const uint16_t l_did_cu16 = ch_ps->rdbiDids_au16[ch_ps->rdbiDidIdx_u8];
+    uint8_t l_diagBufSize_u8 = 0;
+    Std_ReturnType l_didSupported_ = E_OK;
 
-  checkCurrentNad((uint8_t)0u, &l_result_);
+    if ((l_respPos_u8 + 2u) >= LIN_DIAG_BUFFER_SIZE) {
+      l_result_ = E_NOT_OK;
+      l_errCode_u8 = kLinDiagNrcResponseTooLong;
+      break;
+    }
+
+    if (DIAG_OPSTATUS_PENDING == opStatus_u8) {
+      /* Resume the pending DID, the next ones start from scratch */
+      l_result_ = pollHandlerForReadDataById(ch_ps->node_ps, &l_errCode_u8, l_did_cu16, &l_diagBufSize_u8,
+                                             &l_resp_pu8[l_respPos_u8 + 2u],
+                                             (uint8_t)(LIN_DIAG_BUFFER_SIZE - l_respPos_u8 - 2u), DIAG_OPSTATUS_PENDING);
+      opStatus_u8 = DIAG_OPSTATUS_INITIAL;
+    } else {
+      l_result_ = getHandlersForReadDataById(ch_ps->node_ps, &l_errCode_u8, l_did_cu16, &l_diagBufSize_u8, &l_didSupported_,
+                                             &l_resp_pu8[l_respPos_u8 + 2u],
+                                             (uint8_t)(LIN_DIAG_BUFFER_SIZE - l_respPos_u8 - 2u));
+    }
 
-  if (E_OK == l_result_) {
-    checkMsgDataLength(g_linDiagDataLength, &l_result_);
+    if (DIAG_E_PENDING == l_result_) {
+      /* Keep the DID index: LinDiagMainFunction resumes here */
+      ch_ps->rdbiRespPos_u8 = l_respPos_u8;
+      ch_ps->pending_u8 = 1u;
+      return DIAG_E_PENDING;
+    } else if (E_NOT_OK == l_didSupported_) {
+      /* Unsupported DIDs are left out, the request fails only if none is supported */
+      l_result_ = E_OK;
+    } else if (E_OK == l_result_) {
+      l_resp_pu8[l_respPos_u8] = (uint8_t)(l_did_cu16 >> 8);
+      l_resp_pu8[l_respPos_u8 + 1u] = (uint8_t)l_did_cu16;
+      l_respPos_u8 = (uint8_t)(l_respPos_u8 + 2u + l_diagBufSize_u8);
+      ch_ps->rdbiSupported_u8++;
+    } else if ((kLinDiagNrcResponseTooLong == l_errCode_u8) && (1u == l_didCount_cu8)) {
+      /* A lone DID too long for the buffer is streamed in place by the transport layer */
+      l_result_ = getStreamForReadDataById(ch_ps->node_ps, &l_errCode_u8, l_did_cu16,
+                                           &ch_ps->respTail_pu8, &ch_ps->respTailLen_u16);
+      if (E_OK == l_result_) {
+        l_resp_pu8[1] = (uint8_t)(l_did_cu16 >> 8);
+        l_resp_pu8[2] = (uint8_t)l_did_cu16;
+        l_respPos_u8 = 3u;
+        ch_ps->rdbiSupported_u8++;
+      } else {
+        ch_ps->respTail_pu8 = NULL;
+        ch_ps->respTailLen_u16 = 0u;
+      }
+    } else {
+      /* NRC already set by the DID layer */
+    }
   }
 
-  if (E_OK == l_result_) {
-    l_result_ = getHandlersForReadDataById(l_errCode_u8, l_did_cu16, &l_diagBufSize_u8, &l_didSupported_, l_diagBuf_pu8);
+  if ((E_OK == l_result_) && (0u == ch_ps->rdbiSupported_u8)) {
+    l_result_ = E_NOT_OK;
+    l_errCode_u8 = kLinDiagNrcRequestOutOfRange;
   }
 
   switch (l_result_)
   {
     case E_OK:
-      g_linDiagDataLength = l_diagBufSize_u8 + 2u;
-      LinDiagSendPosResponse();
+      l_resp_pu8[0] = (uint8_t)(ch_ps->sid_u8 + kLinDiagPosRespSidOffset);
+      ch_ps->respLen_u16 = l_respPos_u8;
+      LinDiagSendPosResponse(ch_ps);
       break;
     default:
-      LinDiagSendNegResponse(l_errCode_u8);
+      LinDiagSendNegResponse(ch_ps, l_errCode_u8);
       break;
   }
+
+  return l_result_;
+}
+
+void LinDiagCancelPending(LinDiag_Channel_t *const ch_ps)
+{
+  const uint8_t l_respPos_u8 = ch_ps->rdbiRespPos_u8;
+  uint8_t l_diagBufSize_u8 = 0;
+  uint8_t l_errCode_u8 = 0;
+
+  if (0u != ch_ps->pending_u8) {
+    ch_ps->pending_u8 = 0u;
+    (void)pollHandlerForReadDataById(ch_ps->node_ps, &l_errCode_u8, ch_ps->rdbiDids_au16[ch_ps->rdbiDidIdx_u8],
+                                     &l_diagBufSize_u8, &ch_ps->resp_pu8[l_respPos_u8 + 2u],
+                                     (uint8_t)(LIN_DIAG_BUFFER_SIZE - l_respPos_u8 - 2u), DIAG_OPSTATUS_CANCEL);
+  }
 }
 
+Std_ReturnType LinDiagMainFunction(LinDiag_Channel_t *const ch_ps)
+{
+  Std_ReturnType l_result_;
+
+  if (0u == ch_ps->pending_u8) {
+    return E_NOT_OK;
+  }
+
+  ch_ps->pendingTicks_u16++;
+  ch_ps->pendingTotal_u16++;
+
+  /* Let the previous NRC 0x78 go out before answering */
+  if (E_OK == LinDiagTpIsTxBusy(&ch_ps->tpTx_s)) {
+    return DIAG_E_PENDING;
+  }
+
+  l_result_ = LinDiagRdbiAssemble(ch_ps, DIAG_OPSTATUS_PENDING);
 
+  if (DIAG_E_PENDING == l_result_) {
+    /* One tick before the limit: sent on the tick that reaches it, NRC 0x78 would be on the bus too late */
+    const uint16_t l_rcrrpTicks_cu16 = (0u != ch_ps->rcrrpSent_u8) ? (uint16_t)(LIN_DIAG_MS_TO_TICKS(LIN_DIAG_P2STAR_MS) - 1u)
+                                                                   : (uint16_t)(LIN_DIAG_MS_TO_TICKS(LIN_DIAG_P2_MS) - 1u);
 
+    if (ch_ps->pendingTotal_u16 >= LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PENDING_TIMEOUT_MS)) {
+      LinDiagCancelPending(ch_ps);
+      LinDiagSendNegResponse(ch_ps, kLinDiagNrcGeneralReject);
+      l_result_ = E_NOT_OK;
+    } else if (ch_ps->pendingTicks_u16 >= l_rcrrpTicks_cu16) {
+      LinDiagSendNegResponse(ch_ps, kLinDiagNrcResponsePending);
+      ch_ps->rcrrpSent_u8 = 1u;
+      ch_ps->pendingTicks_u16 = 0u;
+    } else {
+      /* Still within the server timing */
+    }
+  }
+
+  return l_result_;
+}
+
+void ApplLinDiagReadDataById(void)
+{
+  LinDiag_DefaultChannel.reqLen_u16 = g_linDiagDataLength;
+
+  if (E_OK == LinDiagReadDataById(&LinDiag_DefaultChannel)) {
+    /* Legacy length: DID + data, response SID excluded */
+    g_linDiagDataLength = (uint16_t)(LinDiag_DefaultChannel.respLen_u16 - 1u + LinDiag_DefaultChannel.respTailLen_u16);
+  }
+}
+
+void ApplLinDiagMainFunction(void)
+{
+  if (E_OK == LinDiagMainFunction(&LinDiag_DefaultChannel)) {
+    g_linDiagDataLength = (uint16_t)(LinDiag_DefaultChannel.respLen_u16 - 1u + LinDiag_DefaultChannel.respTailLen_u16);
+  }
+}
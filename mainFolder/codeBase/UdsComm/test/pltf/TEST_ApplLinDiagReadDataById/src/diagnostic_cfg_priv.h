@@ -5,15 +5,287 @@
 
 #include "diagnostic_cfg.h"
 
-#define DID_F308_SIZE 1U
+/* DID handler: writes at most capacity_u8 bytes to output_pu8. *size_pu8 holds the
+ * table size on entry and can be lowered by the handler.
+ */
+typedef Std_ReturnType (*diagHandler_t)(uint8*const  output_pu8, const uint8 capacity_u8,
+                                        uint8*const  size_pu8, uint8* const errCode_pu8);
 
-typedef Std_ReturnType (*diagHandler_t)(uint8*const  output_pu8, uint8*const  size_pu8,
-                                        uint8* const errCode_pu8);
+/* Shared handler of a DID range: offset_u16 is the DID distance from the first DID of the range */
+typedef Std_ReturnType (*diagRangeHandler_t)(const uint16 offset_u16, uint8*const  output_pu8,
+                                             const uint8 capacity_u8, uint8*const  size_pu8,
+                                             uint8* const errCode_pu8);
 
-Std_ReturnType RdbiVhitOverVoltageFaultDiag_(uint8*const  output_pu8,
+/* Streamed DID handler: points *data_ppu8 at its data, sent in place by the transport layer.
+ * Data built on request goes in buffer_pu8 (DIAG_STREAM_DATA_SIZE bytes), which belongs to the
+ * node served: a read on another node does not overwrite it. The data must stay unchanged
+ * until LinDiagTpIsTxBusy() returns E_NOT_OK.
+ */
+typedef Std_ReturnType (*diagStreamHandler_t)(uint8*const buffer_pu8, const uint8 **const data_ppu8,
+                                              uint16*const length_pu16, uint8* const errCode_pu8);
+
+/* Asynchronous DID handler for slow sources: called with DIAG_OPSTATUS_INITIAL, then
+ * with DIAG_OPSTATUS_PENDING while it returns DIAG_E_PENDING, or DIAG_OPSTATUS_CANCEL
+ * when the request is dropped. The output buffer is the same on every call. *state_pu32
+ * belongs to the node served: its progress between calls goes there, not in a static.
+ */
+typedef Std_ReturnType (*diagAsyncHandler_t)(const uint8 opStatus_u8, uint32_t*const state_pu32, uint8*const  output_pu8,
+                                             const uint8 capacity_u8, uint8*const  size_pu8,
+                                             uint8* const errCode_pu8);
+
+/* Optional consistency hook of a data or scaled DID, called before the read: it can latch a
+ * consistent value into the source or refuse the read by returning E_NOT_OK.
+ */
+typedef Std_ReturnType (*diagDataHook_t)(uint8* const errCode_pu8);
+
+/* Cached response of one DID */
+typedef struct
+{
+    uint16 stamp_u16;   /* Tick or producer version when the response was stored */
+    uint8  size_u8;
+    uint8  valid_u8;
+} diagCacheSlot_t;
+
+/* Response cache of a handler DID (one slot per DID of a range), held by every node.
+ * Freshness: ttlTicks_u16 ticks of diagDidCacheMainFunction, or while *version_pu16
+ * keeps the value it had before the handler call when version_pu16 is set.
+ */
+typedef struct
+{
+    uint16                 slot_u16;     /* First slot in diagNode_t.cacheSlots_as */
+    uint16                 data_u16;     /* Offset in diagNode_t.cacheData_au8, size_u16 bytes per slot */
+    uint16                 ttlTicks_u16;
+    const volatile uint16 *version_pu16;
+} diagDidCache_t;
+
+/* WriteDataById target of a data DID: its copy in the node RAM, started from the data source by
+ * diagNodeInit and served instead of it. Persisted unless nvmBlock_u8 is DIAG_NVM_NO_BLOCK.
+ */
+#define DIAG_NVM_NO_BLOCK                  ((uint8)0xFFu)
+typedef struct
+{
+    uint16 ram_u16;        /* Offset in diagNode_t.didRam_au8 */
+    uint8  nvmBlock_u8;    /* Index in diagNvmBlocks */
+} diagDidWrite_t;
+
+/* Persisted DID copy at ram_u16 of the node RAM, at offset_u16 of the NVM image of the node */
+typedef struct
+{
+    uint16  ram_u16;
+    uint16  offset_u16;
+    uint16  size_u16;
+} diagNvmBlock_t;
+
+/* Source type of a scaled DID */
+#define DIAG_SIGNAL_SRC_U8                 ((uint8)0u)
+#define DIAG_SIGNAL_SRC_U16                ((uint8)1u)
+#define DIAG_SIGNAL_SRC_U32                ((uint8)2u)
+#define DIAG_SIGNAL_SRC_S8                 ((uint8)3u)
+#define DIAG_SIGNAL_SRC_S16                ((uint8)4u)
+#define DIAG_SIGNAL_SRC_S32                ((uint8)5u)
+
+/* Raw value options of a scaled DID */
+#define DIAG_SIGNAL_SIGNED                 ((uint8)0x01u)   /* Two's complement raw value */
+#define DIAG_SIGNAL_LITTLE_ENDIAN          ((uint8)0x02u)   /* Least significant byte first */
+
+/* Scaling of a scaled DID: physical = raw * factor + offset, both in source units.
+ * The generator turns them into raw = floor((phys * mul_s32 + add_s64) / 2^shift_u8),
+ * rounded to nearest; the raw value saturates to bits_u8 and fills the size_u16 bytes
+ * of the DID. A range reads element [offset] of a source array.
+ */
+typedef struct
+{
+    const void *src_pv;
+    uint8       srcType_u8;
+    uint8       flags_u8;
+    uint8       bits_u8;       /* 1..32 */
+    uint8       shift_u8;      /* 0..32 */
+    int32_t     mul_s32;
+    int64_t     add_s64;
+} diagSignal_t;
+
+/* DID descriptor: a single DID has didFirst_u16 == didLast_u16 and a handler_pf,
+ * a DID range has didFirst_u16 < didLast_u16 and a rangeHandler_pf.
+ * A data DID has data_pu8 set instead of a handler and is served by direct copy
+ * of size_u16 bytes (element [offset] for a range); when it does not fit
+ * pbLinDiagBuffer it is streamed in place like a streamHandler_pf DID, whose
+ * size_u16 is the maximum length. An asyncHandler_pf DID may complete later.
+ * A handler DID with cache_ps set is answered from the cache while it is fresh.
+ * A data DID with write_ps set accepts WriteDataById and is served from the node RAM.
+ * A scaled DID has signal_ps set instead of a handler and is encoded from its source.
+ */
+typedef struct
+{
+    uint16              didFirst_u16;
+    uint16              didLast_u16;
+    uint16              size_u16;
+    diagHandler_t       handler_pf;
+    diagRangeHandler_t  rangeHandler_pf;
+    const uint8        *data_pu8;
+    diagDataHook_t      dataHook_pf;
+    diagStreamHandler_t streamHandler_pf;
+    diagAsyncHandler_t  asyncHandler_pf;
+    const diagDidCache_t *cache_ps;
+    const diagDidWrite_t *write_ps;
+    const diagSignal_t  *signal_ps;
+} diagDidEntry_t;
+
+/* DID size defines and handler prototypes, generated from diagnostic_did.csv */
+#include "diagnostic_did_gen.h"
+
+/* DID table, sorted by didFirst_u16 with no overlapping ranges.
+ * keys_pcu16[i] == entries_pcs[i].didFirst_u16, kept apart for the search.
+ */
+typedef struct
+{
+    const uint16         *keys_pcu16;
+    const diagDidEntry_t *entries_pcs;
+    uint16                size_u16;
+} diagDidTable_t;
+
+/* Generated DID table (diagnostic_did_gen.c), the one of every node bound by diagNodeInit */
+extern const uint16 diagDidKeys_cau16[];
+extern const diagDidEntry_t diagDidTable[];
+extern const uint16 diagDidTableSize_u16;
+extern const diagDidTable_t diagDidTableCfg;
+
+/* Persisted DIDs in NVM image order, DIAG_NVM_BLOCK_COUNT entries and a sentinel (diagnostic_did_gen.c) */
+extern const diagNvmBlock_t diagNvmBlocks[];
+
+const diagDidEntry_t *diagFindDidEntry(const diagDidTable_t *const table_ps, const uint16 did_u16);
+
+/* Bytes of DID didFirst_u16 + offset_u16 of a data DID: node RAM copy when writable, the source otherwise */
+const uint8 *diagDidData(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16);
+
+Std_ReturnType diagCopyDidData(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps,
+    const uint16 offset_u16, uint8*const  output_pu8, uint8* const errCode_pu8);
+
+/* Serve a scaled DID: hook, then the source value scaled and encoded in size_u16 bytes (diagnostic_cfg_signal.c) */
+Std_ReturnType diagEncodeSignal(const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8* const errCode_pu8);
+
+/* Copy the cached response of DID didFirst_u16 + offset_u16 to output_pu8, E_NOT_OK if missing or stale */
+Std_ReturnType diagCacheRead(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16,
+    uint8*const  output_pu8, uint8*const  size_pu8);
+
+/* Freshness reference to take before calling the handler, passed back to diagCacheWrite */
+uint16 diagCacheStamp(const diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps);
+
+void diagCacheWrite(diagNode_t *const node_ps, const diagDidEntry_t *const entry_ps, const uint16 offset_u16, const uint16 stamp_u16,
+    const uint8 *const response_pu8, const uint8 size_u8);
+
+/* Memory region readable with ReadMemoryByAddress */
+typedef struct
+{
+    const uint8 *start_pu8;
+    uint32_t     size_u32;
+} diagMemRegion_t;
+
+/* ReadMemoryByAddress whitelist (diagnostic_cfg_mem.c) */
+extern const diagMemRegion_t diagMemRegions[];
+extern const uint8 diagMemRegionCount_u8;
+
+/* Count one call of the handler of entry_ps that started at l_start_u32: a request with
+ * DIAG_OPSTATUS_INITIAL, then a positive or negative (l_nrc_u8) outcome unless still pending.
+ * Calls with DIAG_OPSTATUS_CANCEL are not counted.
+ */
+void diagStatsDidDone(const diagDidEntry_t *const entry_ps, const uint8 opStatus_u8, const Std_ReturnType result_,
+    const uint8 nrc_u8, const uint32_t start_u32);
+
+/* Stored DTC */
+typedef struct
+{
+    uint8 event_u8;
+    uint8 status_u8;
+    uint8 occurrence_u8;    /* Failures since the DTC was stored, saturated */
+    uint8 snapshot_au8[LIN_DIAG_DTC_SNAPSHOT_SIZE];
+} diagDtcSlot_t;
+
+/* Persisted fault memory: slots in order of first failure */
+typedef struct
+{
+    uint8         count_u8;
+    diagDtcSlot_t slots_as[LIN_DIAG_DTC_CAPACITY];
+} diagDtcStore_t;
+
+/* DTC number (3 bytes) of every fault event (diagnostic_cfg_dtc.c) */
+extern const uint32_t diagDtcNumbers_cau32[DIAG_DTC_EVENT_COUNT];
+
+/* NVM block of the fault memory, after the DID image (diagnostic_cfg_dtc.c), read from and written
+ * to diagNode_t.dtcStore_s. Its index follows the DID blocks, so a commit writes DIDs and DTCs in
+ * the same batch.
+ */
+#define DIAG_NVM_DTC_BLOCK                 ((uint8)DIAG_NVM_BLOCK_COUNT)
+#define DIAG_NVM_ALL_BLOCKS                (DIAG_NVM_BLOCK_COUNT + 1u)
+extern const diagNvmBlock_t diagDtcNvmBlock;
+
+/* NVM slot of one node: DID image then fault memory, node n at n * DIAG_NVM_NODE_SIZE */
+#define DIAG_NVM_NODE_SIZE                 (DIAG_NVM_IMAGE_SIZE + sizeof(diagDtcStore_t))
+
+/* Stage block_u8 of node_ps for the next commit */
+void diagNvmMarkDirty(diagNode_t *const node_ps, const uint8 block_u8);
+
+/* NVM backend, diagnostic_nvm_file.c on the host. A commit is one batch: Begin, a Write per
+ * dirty block, End; the backend may buffer the writes and program them in End.
+ * Read leaves data_pu8 untouched when it fails.
+ */
+Std_ReturnType diagNvmBackendRead(const uint16 offset_u16, uint8*const  data_pu8, const uint16 length_u16);
+Std_ReturnType diagNvmBackendBegin(void);
+Std_ReturnType diagNvmBackendWrite(const uint16 offset_u16, const uint8 *const data_pu8, const uint16 length_u16);
+Std_ReturnType diagNvmBackendEnd(void);
+
+/* Slice of a source DID in a composite DID */
+typedef struct
+{
+    uint16 srcDid_u16;
+    uint8  position_u8;    /* First byte, 0-based */
+    uint8  size_u8;
+} diagDynPart_t;
+
+/* Composite DID defined at runtime, read by gathering its parts in the response */
+typedef struct
+{
+    uint8         count_u8;   /* 0: not defined */
+    uint8         size_u8;    /* Response size, parts together */
+    uint8         span_u8;    /* Buffer needed while gathering: handler sources are written whole */
+    diagDynPart_t parts_as[LIN_DIAG_DYN_DID_PARTS];
+} diagDynDid_t;
+
+/* DID context of one node (diagNode_t), started by diagNodeInit */
+struct diagNode_s
+{
+    const diagDidTable_t *table_ps;
+    uint8           didRam_au8[DIAG_DID_RAM_SIZE];         /* Writable DIDs, see diagDidWrite_t */
+    diagDynDid_t    dynDids_as[LIN_DIAG_DYN_DID_COUNT];    /* Indexed by DID - LIN_DIAG_DYN_DID_FIRST */
+    uint16          cacheTicks_u16;                        /* Ticks of diagDidCacheMainFunction, wraps around */
+    diagCacheSlot_t cacheSlots_as[DIAG_CACHE_SLOT_COUNT];
+    uint8           cacheData_au8[DIAG_CACHE_DATA_SIZE];
+    uint32_t        asyncState_u32;                        /* Of the asynchronous DID in progress, one at a time */
+    uint8           streamData_au8[DIAG_STREAM_DATA_SIZE]; /* Streamed DID in transmission, when built on request */
+    diagDtcStore_t  dtcStore_s;
+    uint8           dtcEventSlot_au8[DIAG_DTC_EVENT_COUNT];
+    uint32_t        dtcStatusIndex_au32[8];                /* See diagnostic_cfg_dtc.c */
+    uint16          nvmBase_u16;                           /* Offset of the node slot in the NVM image */
+    uint8           nvmDirty_au8[DIAG_NVM_ALL_BLOCKS];     /* Blocks written since the last commit */
+    uint8           nvmDirtyCount_u8;
+    uint16          nvmQuietTicks_u16;                     /* Since the last write / the first write of the batch */
+    uint16          nvmAgeTicks_u16;
+};
+
+/* Defined composite DID of node_ps, NULL if did_u16 is not one */
+const diagDynDid_t *diagFindDynamicDid(const diagNode_t *const node_ps, const uint16 did_u16);
+
+/* Gather the parts of dyn_ps into output_pu8 (at least dyn_ps->span_u8 bytes), no intermediate buffer */
+Std_ReturnType diagReadDynamicDid(diagNode_t *const node_ps, const diagDynDid_t *const dyn_ps, uint8*const  output_pu8,
     uint8*const  size_pu8, uint8* const errCode_pu8);
 
-Std_ReturnType Subfunction_Request_Out_Of_Range(uint8*const  output_pu8,
+/* Data DID sources (defined in diagnostic_cfg.c) */
+extern uint8 diagOverVoltageFlag_u8;
+extern uint8 diagVin_au8[DID_F190_SIZE];
+extern uint8 diagCalibrationDump_au8[DID_FD00_SIZE];
+extern uint16 diagSupplyVoltage_mV_u16;
+
+Std_ReturnType Subfunction_Request_Out_Of_Range(uint8*const  output_pu8, const uint8 capacity_u8,
     uint8*const  size_pu8, uint8* const errCode_pu8);
 
-#endif
\ No newline at end of file
+#endif
@@ -1,16 +1,50 @@
 #include "unity.h"
 #include "ApplLinDiagReadDataById.h"
 #include "diagnostic_cfg.h"
+#include "diagnostic_cfg_priv.h"
 #include "mock_diagnostic_cfg.h"
 
 /* Global buffers normally provided by LIN stack */
 uint8_t pbLinDiagBuffer[32];
 /* Message length */
 uint16_t g_linDiagDataLength = 0;
+/* Node of the default channel, only passed through to the mocked configuration layer */
+diagNode_t diagDefaultNode;
 
 /* Mock functions */
-void LinDiagSendPosResponse(void);
-void LinDiagSendNegResponse(uint8_t errorCode);
+void LinDiagSendPosResponse(LinDiag_Channel_t *const ch_ps);
+void LinDiagSendNegResponse(LinDiag_Channel_t *const ch_ps, uint8_t errorCode);
+Std_ReturnType LinDiagTpIsTxBusy(const LinDiagTpTx_t *const tx_ps);
+void LinDiagCaptureRequest(const LinDiag_Channel_t *const ch_ps);
+
+/* Ticks after which NRC 0x78 is sent: one tick before P2 / P2* is over */
+#define P2_TICKS        (LIN_DIAG_MS_TO_TICKS(LIN_DIAG_P2_MS) - 1u)
+#define P2STAR_TICKS    (LIN_DIAG_MS_TO_TICKS(LIN_DIAG_P2STAR_MS) - 1u)
+
+/* Default channel waiting for the handler of 0x22 F410, ticks counted so far given */
+static void setPendingF410(uint16_t pendingTicks, uint16_t pendingTotal, uint8_t rcrrpSent)
+{
+  LinDiag_DefaultChannel.sid_u8 = 0x22;
+  LinDiag_DefaultChannel.rdbiDids_au16[0] = 0xF410;
+  LinDiag_DefaultChannel.rdbiDidCount_u8 = 1u;
+  LinDiag_DefaultChannel.rdbiDidIdx_u8 = 0u;
+  LinDiag_DefaultChannel.rdbiRespPos_u8 = 1u;
+  LinDiag_DefaultChannel.rdbiSupported_u8 = 0u;
+  LinDiag_DefaultChannel.rcrrpSent_u8 = rcrrpSent;
+  LinDiag_DefaultChannel.pendingTicks_u16 = pendingTicks;
+  LinDiag_DefaultChannel.pendingTotal_u16 = pendingTotal;
+  LinDiag_DefaultChannel.pending_u8 = 1u;
+}
+
+/* One tick of the task on which the handler of F410 is still busy */
+static void expectStillPending(void)
+{
+  expect_LinDiagTpIsTxBusy(&LinDiag_DefaultChannel.tpTx_s);
+  expect_LinDiagTpIsTxBusy_and_return(E_NOT_OK);
+
+  expect_pollHandlerForReadDataById(&diagDefaultNode, NULL, 0xF410, NULL, &pbLinDiagBuffer[3], 29, DIAG_OPSTATUS_PENDING);
+  expect_pollHandlerForReadDataById_and_return(DIAG_E_PENDING);
+}
 
 /* Test setup and teardown */
 void setUp(void)
@@ -18,6 +52,9 @@ void setUp(void)
   /* Initialize buffers before each test */
   memset(pbLinDiagBuffer, 0, sizeof(pbLinDiagBuffer));
   g_linDiagDataLength = 0;
+  LinDiag_DefaultChannel.respTail_pu8 = NULL;
+  LinDiag_DefaultChannel.respTailLen_u16 = 0u;
+  LinDiag_DefaultChannel.pending_u8 = 0u;
 }
 
 void tearDown(void)
@@ -45,19 +82,22 @@ void test_ApplLinDiagReadDataById_SuccessfulReadWithValidData(void)
   uint8_t response_size = 2;
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
-  expect_getHandlersForReadDataById(0, 0xF308, NULL, NULL, response_buffer);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
   expect_getHandlersForReadDataById_args_l_diagBufSize_(2);
   expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
   expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 2);
   expect_getHandlersForReadDataById_and_return(E_OK);
   
-  expect_LinDiagSendPosResponse();
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -82,19 +122,22 @@ void test_ApplLinDiagReadDataById_DifferentValidDID(void)
   uint8_t response_size = 3;
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
-  expect_getHandlersForReadDataById(0, 0x1234, NULL, NULL, response_buffer);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0x1234, NULL, NULL, &pbLinDiagBuffer[3], 29);
   expect_getHandlersForReadDataById_args_l_diagBufSize_(3);
   expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
   expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 3);
   expect_getHandlersForReadDataById_and_return(E_OK);
   
-  expect_LinDiagSendPosResponse();
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -110,8 +153,8 @@ void test_ApplLinDiagReadDataById_DifferentValidDID(void)
 
 /**
  * Test: ApplLinDiagReadDataById_InvalidNAD
- * Description: Test when current NAD check fails
- * Expected: Negative response is sent, further processing stops
+ * Description: Test a request addressed to another node
+ * Expected: No response is sent, the request is not taken up
  */
 void test_ApplLinDiagReadDataById_InvalidNAD(void)
 {
@@ -119,13 +162,10 @@ void test_ApplLinDiagReadDataById_InvalidNAD(void)
   uint8_t test_data[4] = {0x22, 0xF3, 0x08, 0x00};
   memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
   g_linDiagDataLength = 3;
-  uint8_t error_code = 0x12;
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_NOT_OK);
-  
-  expect_LinDiagSendNegResponse(error_code);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -150,16 +190,19 @@ void test_ApplLinDiagReadDataById_InvalidMessageLength(void)
   uint8_t test_data[4] = {0x22, 0xF3, 0x08, 0x00};
   memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
   g_linDiagDataLength = 65535; /* Invalid length */
-  uint8_t error_code = 0x31;
+  uint8_t error_code = 0x13; /* Incorrect message length */
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(65535, NULL);
   expect_checkMsgDataLength_args_l_result_(E_NOT_OK);
   
-  expect_LinDiagSendNegResponse(error_code);
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, error_code);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -187,17 +230,21 @@ void test_ApplLinDiagReadDataById_UnsupportedDID(void)
   uint8_t error_code = 0x31; /* Request out of range */
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
-  expect_getHandlersForReadDataById(0, 0xFFFF, NULL, NULL, NULL);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xFFFF, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_errCode_pu8(error_code);
   expect_getHandlersForReadDataById_args_l_didSupported_(E_NOT_OK);
   expect_getHandlersForReadDataById_and_return(E_NOT_OK);
   
-  expect_LinDiagSendNegResponse(error_code);
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, error_code);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -209,7 +256,7 @@ void test_ApplLinDiagReadDataById_UnsupportedDID(void)
 /**
  * Test: ApplLinDiagReadDataById_HandlerError
  * Description: Test when handler returns an error during processing
- * Expected: Negative response is sent
+ * Expected: Negative response is sent with the NRC set by the handler
  */
 void test_ApplLinDiagReadDataById_HandlerError(void)
 {
@@ -220,17 +267,21 @@ void test_ApplLinDiagReadDataById_HandlerError(void)
   uint8_t error_code = 0x22;
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
-  expect_getHandlersForReadDataById(0, 0xF308, NULL, NULL, NULL);
-  expect_getHandlersForReadDataById_args_l_didSupported_(E_NOT_OK);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_errCode_pu8(error_code);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
   expect_getHandlersForReadDataById_and_return(E_NOT_OK);
   
-  expect_LinDiagSendNegResponse(error_code);
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, error_code);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -259,20 +310,23 @@ void test_ApplLinDiagReadDataById_DIDExtractionFromBuffer(void)
   uint8_t response_buffer[2] = {0x12, 0x34};
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
   /* Verify correct DID extraction: (0xAB << 8) | 0xCD = 0xABCD */
-  expect_getHandlersForReadDataById(0, 0xABCD, NULL, NULL, response_buffer);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xABCD, NULL, NULL, &pbLinDiagBuffer[3], 29);
   expect_getHandlersForReadDataById_args_l_diagBufSize_(2);
   expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
   expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 2);
   expect_getHandlersForReadDataById_and_return(E_OK);
   
-  expect_LinDiagSendPosResponse();
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -301,19 +355,22 @@ void test_ApplLinDiagReadDataById_MinimumDataLength(void)
   uint8_t response_buffer[1] = {0xFF};
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
-  expect_getHandlersForReadDataById(0, 0x0001, NULL, NULL, response_buffer);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0x0001, NULL, NULL, &pbLinDiagBuffer[3], 29);
   expect_getHandlersForReadDataById_args_l_diagBufSize_(1);
   expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
   expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 1);
   expect_getHandlersForReadDataById_and_return(E_OK);
   
-  expect_LinDiagSendPosResponse();
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -341,19 +398,22 @@ void test_ApplLinDiagReadDataById_LargeResponseData(void)
   }
 
   /* Expectations */
-  expect_checkCurrentNad(0, NULL);
+  expect_checkCurrentNad(0x01, 0x01, NULL);
   expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
   
   expect_checkMsgDataLength(3, NULL);
   expect_checkMsgDataLength_args_l_result_(E_OK);
   
-  expect_getHandlersForReadDataById(0, 0xF308, NULL, NULL, response_buffer);
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
   expect_getHandlersForReadDataById_args_l_diagBufSize_(28);
   expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
   expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 28);
   expect_getHandlersForReadDataById_and_return(E_OK);
   
-  expect_LinDiagSendPosResponse();
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
 
   /* Execute */
   ApplLinDiagReadDataById();
@@ -362,6 +422,523 @@ void test_ApplLinDiagReadDataById_LargeResponseData(void)
   TEST_ASSERT_EQUAL_INT(30, g_linDiagDataLength); /* 28 + 2 */
 }
 
+/* ============================================================================
+ * Test Cases: Request Format Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: ApplLinDiagReadDataById_IncompleteDID
+ * Description: Test with a request length that does not hold a whole DID list
+ * Expected: Negative response with incorrect message length, handler not called
+ */
+void test_ApplLinDiagReadDataById_IncompleteDID(void)
+{
+  /* Setup */
+  uint8_t test_data[4] = {0x22, 0xF3, 0x08, 0xF4};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 4;
+  uint8_t error_code = 0x13; /* Incorrect message length */
 
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
 
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
 
+  expect_checkMsgDataLength(4, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, error_code);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(4, g_linDiagDataLength);
+}
+
+/* ============================================================================
+ * Test Cases: Multiple DID Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: ApplLinDiagReadDataById_MultipleDIDs
+ * Description: Test a request carrying two supported DIDs
+ * Expected: Both DIDs and their data are assembled in request order
+ */
+void test_ApplLinDiagReadDataById_MultipleDIDs(void)
+{
+  /* Setup */
+  uint8_t test_data[5] = {0x22, 0xF3, 0x08, 0xF4, 0x05};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 5;
+
+  uint8_t response_buffer_1[1] = {0x01};
+  uint8_t response_buffer_2[2] = {0xAA, 0xBB};
+  uint8_t expected_response[8] = {0x62, 0xF3, 0x08, 0x01, 0xF4, 0x05, 0xAA, 0xBB};
+
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(5, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(1);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer_1, 1);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF405, NULL, NULL, &pbLinDiagBuffer[6], 26);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(2);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer_2, 2);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(7, g_linDiagDataLength); /* (2 + 1) + (2 + 2) */
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_response, pbLinDiagBuffer, sizeof(expected_response));
+}
+
+/**
+ * Test: ApplLinDiagReadDataById_UnsupportedDIDSkipped
+ * Description: Test a request mixing an unsupported and a supported DID
+ * Expected: The unsupported DID is left out of a positive response
+ */
+void test_ApplLinDiagReadDataById_UnsupportedDIDSkipped(void)
+{
+  /* Setup */
+  uint8_t test_data[5] = {0x22, 0xFF, 0xFF, 0xF3, 0x08};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 5;
+
+  uint8_t response_buffer[1] = {0x01};
+  uint8_t expected_response[4] = {0x62, 0xF3, 0x08, 0x01};
+
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(5, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xFFFF, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_errCode_pu8(0x31);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_NOT_OK);
+  expect_getHandlersForReadDataById_and_return(E_NOT_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(1);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 1);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(3, g_linDiagDataLength); /* 1 + 2 */
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_response, pbLinDiagBuffer, sizeof(expected_response));
+}
+
+/**
+ * Test: ApplLinDiagReadDataById_ResponseTooLong
+ * Description: Test when the DID layer reports that the response does not fit
+ * Expected: Negative response with response too long
+ */
+void test_ApplLinDiagReadDataById_ResponseTooLong(void)
+{
+  /* Setup */
+  uint8_t test_data[5] = {0x22, 0xF3, 0x08, 0xF4, 0x05};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 5;
+
+  uint8_t response_buffer[28] = {0};
+  uint8_t error_code = 0x14; /* Response too long */
+
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(5, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(28);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 28);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, error_code);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(5, g_linDiagDataLength);
+}
+
+/* ============================================================================
+ * Test Cases: Streamed DID Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: ApplLinDiagReadDataById_StreamedDID
+ * Description: Test a lone DID too long for pbLinDiagBuffer
+ * Expected: The DID data is left in place as response tail, length covers it
+ */
+void test_ApplLinDiagReadDataById_StreamedDID(void)
+{
+  /* Setup */
+  uint8_t test_data[3] = {0x22, 0xFD, 0x00};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 3;
+
+  static const uint8_t calibration_dump[256] = {0};
+  const uint8_t *calibration_ptr = calibration_dump;
+
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(3, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xFD00, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_errCode_pu8(0x14);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_and_return(E_NOT_OK);
+
+  expect_getStreamForReadDataById(&diagDefaultNode, NULL, 0xFD00, NULL, NULL);
+  expect_getStreamForReadDataById_args_l_data_ppu8(calibration_ptr);
+  expect_getStreamForReadDataById_args_l_length_pu16(256);
+  expect_getStreamForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(258, g_linDiagDataLength); /* 256 + 2 */
+  TEST_ASSERT_EQUAL_PTR(calibration_dump, LinDiag_DefaultChannel.respTail_pu8);
+  TEST_ASSERT_EQUAL_HEX8(0xFD, pbLinDiagBuffer[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, pbLinDiagBuffer[2]);
+}
+
+/* ============================================================================
+ * Test Cases: Channel Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagReadDataById_SeparateBuffers
+ * Description: Serve a request on a channel with its own request and response buffers
+ * Expected: The request is left untouched, the response is built in the response buffer
+ */
+void test_LinDiagReadDataById_SeparateBuffers(void)
+{
+  /* Setup */
+  uint8_t request[LIN_DIAG_BUFFER_SIZE] = {0x22, 0xF3, 0x08};
+  uint8_t response[LIN_DIAG_BUFFER_SIZE] = {0};
+  LinDiag_Channel_t channel = {0};
+  channel.req_pu8 = request;
+  channel.resp_pu8 = response;
+  channel.reqLen_u16 = 3;
+
+  uint8_t response_buffer[1] = {0x01};
+  uint8_t expected_request[3] = {0x22, 0xF3, 0x08};
+  uint8_t expected_response[4] = {0x62, 0xF3, 0x08, 0x01};
+
+  /* Expectations */
+  expect_checkCurrentNad(0, 0, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(3, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &response[3], 29);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(1);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 1);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendPosResponse(&channel);
+
+  /* Execute */
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagReadDataById(&channel));
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(4, channel.respLen_u16); /* SID + DID + 1 */
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_request, request, sizeof(expected_request));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_response, response, sizeof(expected_response));
+  TEST_ASSERT_EQUAL_INT(0, g_linDiagDataLength); /* Legacy globals untouched */
+}
+
+/* ============================================================================
+ * Test Cases: Asynchronous DID Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: ApplLinDiagReadDataById_AsyncDidPending
+ * Description: Test a DID whose handler answers DIAG_E_PENDING
+ * Expected: No response is sent yet, the channel keeps the DID pending
+ */
+void test_ApplLinDiagReadDataById_AsyncDidPending(void)
+{
+  /* Setup */
+  uint8_t test_data[3] = {0x22, 0xF4, 0x10};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 3;
+
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(3, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF410, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_and_return(DIAG_E_PENDING);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(3, g_linDiagDataLength); /* Unchanged until completion */
+  TEST_ASSERT_EQUAL_INT(1, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.rdbiDidIdx_u8);
+}
+
+/**
+ * Test: ApplLinDiagMainFunction_AsyncDidCompleted
+ * Description: Poll a pending DID whose handler has finished
+ * Expected: The handler is resumed on the same buffer, positive response is sent
+ */
+void test_ApplLinDiagMainFunction_AsyncDidCompleted(void)
+{
+  /* Setup: 0x22 F410 pending */
+  LinDiag_DefaultChannel.sid_u8 = 0x22;
+  LinDiag_DefaultChannel.rdbiDids_au16[0] = 0xF410;
+  LinDiag_DefaultChannel.rdbiDidCount_u8 = 1u;
+  LinDiag_DefaultChannel.rdbiDidIdx_u8 = 0u;
+  LinDiag_DefaultChannel.rdbiRespPos_u8 = 1u;
+  LinDiag_DefaultChannel.rdbiSupported_u8 = 0u;
+  LinDiag_DefaultChannel.pendingTicks_u16 = 0u;
+  LinDiag_DefaultChannel.pendingTotal_u16 = 0u;
+  LinDiag_DefaultChannel.pending_u8 = 1u;
+
+  uint8_t response_buffer[2] = {0xC3, 0x5A};
+  uint8_t expected_response[5] = {0x62, 0xF4, 0x10, 0xC3, 0x5A};
+
+  /* Expectations */
+  expect_LinDiagTpIsTxBusy(&LinDiag_DefaultChannel.tpTx_s);
+  expect_LinDiagTpIsTxBusy_and_return(E_NOT_OK);
+
+  expect_pollHandlerForReadDataById(&diagDefaultNode, NULL, 0xF410, NULL, &pbLinDiagBuffer[3], 29, DIAG_OPSTATUS_PENDING);
+  expect_pollHandlerForReadDataById_args_l_diagBufSize_u8(2);
+  expect_pollHandlerForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 2);
+  expect_pollHandlerForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
+
+  /* Execute */
+  ApplLinDiagMainFunction();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(4, g_linDiagDataLength); /* 2 + 2 */
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_response, pbLinDiagBuffer, sizeof(expected_response));
+}
+
+/* ============================================================================
+ * Test Cases: Server Timing Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: ApplLinDiagMainFunction_ResponsePendingAfterP2
+ * Description: Poll a DID still busy for one tick less than LIN_DIAG_P2_MS
+ * Expected: Nothing sent before, NRC 0x78 on the last tick (before P2 is over), the P2* count starts over
+ */
+void test_ApplLinDiagMainFunction_ResponsePendingAfterP2(void)
+{
+  uint16_t tick;
+
+  /* Setup */
+  setPendingF410(0u, 0u, 0u);
+
+  /* Execute: all ticks but the last are within P2 */
+  for (tick = 1u; tick < P2_TICKS; tick++)
+  {
+    expectStillPending();
+    ApplLinDiagMainFunction();
+  }
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.rcrrpSent_u8);
+
+  expectStillPending();
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, kLinDiagNrcResponsePending);
+  ApplLinDiagMainFunction();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(1, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_INT(1, LinDiag_DefaultChannel.rcrrpSent_u8);
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.pendingTicks_u16);
+  TEST_ASSERT_EQUAL_INT(P2_TICKS, LinDiag_DefaultChannel.pendingTotal_u16);
+  TEST_ASSERT_TRUE((LinDiag_DefaultChannel.pendingTotal_u16 * LIN_DIAG_MAIN_PERIOD_MS) < LIN_DIAG_P2_MS);
+  TEST_ASSERT_EQUAL_INT(0, g_linDiagDataLength); /* No positive response yet */
+}
+
+/**
+ * Test: ApplLinDiagMainFunction_ResponsePendingRepeatedAfterP2Star
+ * Description: Poll a DID still busy after a first NRC 0x78, up to LIN_DIAG_P2STAR_MS
+ * Expected: The P2 period no longer applies, NRC 0x78 again one tick before P2* is over
+ */
+void test_ApplLinDiagMainFunction_ResponsePendingRepeatedAfterP2Star(void)
+{
+  const uint16_t p2Ticks = P2_TICKS;
+  const uint16_t p2StarTicks = P2STAR_TICKS;
+
+  /* Setup: two ticks short of P2*, well past P2 */
+  setPendingF410(p2StarTicks - 2u, p2Ticks + p2StarTicks - 2u, 1u);
+
+  /* Execute */
+  expectStillPending();
+  ApplLinDiagMainFunction();
+  TEST_ASSERT_EQUAL_INT(p2StarTicks - 1u, LinDiag_DefaultChannel.pendingTicks_u16);
+
+  expectStillPending();
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, kLinDiagNrcResponsePending);
+  ApplLinDiagMainFunction();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(1, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.pendingTicks_u16);
+  TEST_ASSERT_EQUAL_INT(p2Ticks + p2StarTicks, LinDiag_DefaultChannel.pendingTotal_u16);
+}
+
+/**
+ * Test: ApplLinDiagMainFunction_PendingTimeout
+ * Description: Poll a DID still busy when LIN_DIAG_PENDING_TIMEOUT_MS is reached
+ * Expected: The handler is cancelled, NRC 0x10 is sent, the channel is idle again
+ */
+void test_ApplLinDiagMainFunction_PendingTimeout(void)
+{
+  /* Setup: one tick short of the timeout */
+  setPendingF410(0u, LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PENDING_TIMEOUT_MS) - 1u, 1u);
+
+  /* Expectations */
+  expectStillPending();
+
+  expect_pollHandlerForReadDataById(&diagDefaultNode, NULL, 0xF410, NULL, &pbLinDiagBuffer[3], 29, DIAG_OPSTATUS_CANCEL);
+  expect_pollHandlerForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendNegResponse(&LinDiag_DefaultChannel, kLinDiagNrcGeneralReject);
+
+  /* Execute */
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagMainFunction(&LinDiag_DefaultChannel));
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagMainFunction(&LinDiag_DefaultChannel)); /* Idle */
+}
+
+/**
+ * Test: ApplLinDiagMainFunction_TxBusy
+ * Description: Run the task while the previous NRC 0x78 is still being transmitted
+ * Expected: The handler is not polled, the ticks are still counted
+ */
+void test_ApplLinDiagMainFunction_TxBusy(void)
+{
+  /* Setup */
+  setPendingF410(3u, 8u, 1u);
+
+  /* Expectations */
+  expect_LinDiagTpIsTxBusy(&LinDiag_DefaultChannel.tpTx_s);
+  expect_LinDiagTpIsTxBusy_and_return(E_OK);
+
+  /* Execute */
+  TEST_ASSERT_EQUAL_INT(DIAG_E_PENDING, LinDiagMainFunction(&LinDiag_DefaultChannel));
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(1, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_INT(4, LinDiag_DefaultChannel.pendingTicks_u16);
+  TEST_ASSERT_EQUAL_INT(9, LinDiag_DefaultChannel.pendingTotal_u16);
+}
+
+/**
+ * Test: ApplLinDiagReadDataById_NewRequestCancelsPending
+ * Description: Receive 0x22 F308 while the handler of F410 is still busy
+ * Expected: F410 is cancelled with DIAG_OPSTATUS_CANCEL, the new request is answered
+ */
+void test_ApplLinDiagReadDataById_NewRequestCancelsPending(void)
+{
+  /* Setup */
+  uint8_t test_data[3] = {0x22, 0xF3, 0x08};
+  memcpy(pbLinDiagBuffer, test_data, sizeof(test_data));
+  g_linDiagDataLength = 3;
+  setPendingF410(2u, 2u, 0u);
+
+  uint8_t response_buffer[2] = {0xAA, 0xBB};
+
+  /* Expectations */
+  expect_checkCurrentNad(0x01, 0x01, NULL);
+  expect_checkCurrentNad_args_l_result_(E_OK);
+
+  expect_pollHandlerForReadDataById(&diagDefaultNode, NULL, 0xF410, NULL, &pbLinDiagBuffer[3], 29, DIAG_OPSTATUS_CANCEL);
+  expect_pollHandlerForReadDataById_and_return(E_OK);
+
+  expect_diagStatsNow();
+  expect_diagStatsNow_and_return(0u);
+
+  expect_checkMsgDataLength(3, NULL);
+  expect_checkMsgDataLength_args_l_result_(E_OK);
+
+  expect_getHandlersForReadDataById(&diagDefaultNode, NULL, 0xF308, NULL, NULL, &pbLinDiagBuffer[3], 29);
+  expect_getHandlersForReadDataById_args_l_diagBufSize_(2);
+  expect_getHandlersForReadDataById_args_l_didSupported_(E_OK);
+  expect_getHandlersForReadDataById_ReturnThruPtr_l_diagBuf_pu8(response_buffer, 2);
+  expect_getHandlersForReadDataById_and_return(E_OK);
+
+  expect_LinDiagSendPosResponse(&LinDiag_DefaultChannel);
+
+  /* Execute */
+  ApplLinDiagReadDataById();
+
+  /* Verify */
+  TEST_ASSERT_EQUAL_INT(4, g_linDiagDataLength); /* 2 + 2 */
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.pending_u8);
+  TEST_ASSERT_EQUAL_INT(0, LinDiag_DefaultChannel.pendingTicks_u16);
+}
@@ -0,0 +1,75 @@
+
+
+#ifndef DIAGNOSTIC_CAPTURE_H
+#define DIAGNOSTIC_CAPTURE_H
+
+#include "diagnostic.h"
+
+#define LIN_DIAG_CAPTURE_MAGIC         0x5043444Cu    /* "LDCP" */
+
+/* Record kinds */
+#define LIN_DIAG_CAPTURE_REQUEST       ((uint8_t)0x01u)   /* Request taken up, SID included */
+#define LIN_DIAG_CAPTURE_RESPONSE      ((uint8_t)0x02u)   /* Response sent: positive, negative or NRC 0x78 */
+#define LIN_DIAG_CAPTURE_PAD           ((uint8_t)0xFFu)   /* Unused end of the ring, the next record is at 0 */
+
+/* Ring header, at the start of the capture memory. Host byte order: the capture is
+ * read on the machine (or the architecture) that wrote it.
+ */
+typedef struct
+{
+    uint32_t magic_u32;
+    uint32_t size_u32;      /* Bytes of the record area after the header */
+    uint32_t head_u32;      /* Next record written here */
+    uint32_t tail_u32;      /* Oldest record */
+    uint32_t used_u32;      /* Bytes from tail_u32 to head_u32, padding included */
+    uint32_t lost_u32;      /* Records longer than the ring, not stored */
+} LinDiagCaptureHdr_t;
+
+/* Record header, followed by len_u16 bytes of message. A record never wraps around:
+ * an end of the ring too short for it is padded (implicitly below the record header size).
+ */
+typedef struct
+{
+    uint16_t len_u16;
+    uint8_t  kind_u8;
+    uint8_t  nad_u8;        /* Request: NAD it was addressed to. Response: NAD of the node. */
+    uint32_t timeUs_u32;    /* diagStatsNow() */
+} LinDiagCaptureRec_t;
+
+/* Position of a reader in a ring */
+typedef struct
+{
+    uint32_t pos_u32;
+    uint32_t left_u32;      /* Bytes of the ring still to read */
+} LinDiagCaptureCursor_t;
+
+/* Record every request and response of the channels into the ring at mem_pu8 (size_u32 bytes, header
+ * included), appending to the records already there when the memory holds a ring of the same size.
+ * Oldest records are overwritten when the ring is full. NULL stops the recording.
+ * Records are written by the task serving the channels, one for all of them (see LinDiag_Channel_t).
+ */
+void LinDiagCaptureStart(uint8_t *const mem_pu8, const uint32_t size_u32);
+
+/* Record the request in ch_ps->req_pu8 (called when a request is taken up) */
+void LinDiagCaptureRequest(const LinDiag_Channel_t *const ch_ps);
+
+/* Record a response of ch_ps: head_pu8 then tail_pu8 (NULL if none) as sent */
+void LinDiagCaptureResponse(const LinDiag_Channel_t *const ch_ps, const uint8_t *const head_pu8, const uint16_t headLen_u16,
+    const uint8_t *const tail_pu8, const uint16_t tailLen_u16);
+
+/* Reader: first record of the ring at mem_pu8, oldest first. E_NOT_OK if mem_pu8 holds no ring. */
+Std_ReturnType LinDiagCaptureOpen(const uint8_t *const mem_pu8, LinDiagCaptureCursor_t *const cur_ps);
+
+/* Reader: next record and its message (pointer into the ring), E_NOT_OK after the last one */
+Std_ReturnType LinDiagCaptureNext(const uint8_t *const mem_pu8, LinDiagCaptureCursor_t *const cur_ps,
+    LinDiagCaptureRec_t *const rec_ps, const uint8_t **const msg_ppu8);
+
+#define kLinDiagCaptureHdrSize         ((uint32_t)sizeof(LinDiagCaptureHdr_t))
+#define kLinDiagCaptureRecSize         ((uint32_t)sizeof(LinDiagCaptureRec_t))
+
+_Static_assert(sizeof(LinDiagCaptureRec_t) == 8u, "LinDiagCaptureRec_t must stay packed: it is the on-disk record header");
+
+/* Bytes a record takes at pos_u32 of the record area, padding to the end of the ring included */
+uint32_t LinDiagCaptureRecSpan(const LinDiagCaptureHdr_t *const hdr_ps, const uint8_t *const area_pu8, const uint32_t pos_u32);
+
+#endif
@@ -0,0 +1,224 @@
+#include "unity.h"
+#include "LinDiagCaptureNext.h"
+
+/* Ring memory: header then 64 bytes of records, word aligned */
+#define AREA_SIZE 64u
+static uint32_t memory[(sizeof(LinDiagCaptureHdr_t) + AREA_SIZE) / 4u];
+static uint8_t *const mem = (uint8_t *)memory;
+static const LinDiagCaptureHdr_t *const hdr = (const LinDiagCaptureHdr_t *)memory;
+
+static LinDiag_Channel_t ch;
+static uint8_t req[LIN_DIAG_BUFFER_SIZE];
+static uint32_t now;
+
+/* Stand-in of the statistics clock: timestamps of the records */
+uint32_t diagStatsNow(void)
+{
+  return now;
+}
+
+/* Record a request of len bytes, all of them equal to tag */
+static void request(const uint8_t tag, const uint16_t len)
+{
+  uint16_t idx;
+
+  for (idx = 0u; idx < len; idx++)
+  {
+    req[idx] = tag;
+  }
+  ch.reqLen_u16 = len;
+  LinDiagCaptureRequest(&ch);
+}
+
+/* Tags of the records in the ring, oldest first */
+static uint8_t readTags(uint8_t *const tags, const uint8_t max)
+{
+  LinDiagCaptureCursor_t cur;
+  LinDiagCaptureRec_t rec;
+  const uint8_t *msg;
+  uint8_t count = 0u;
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagCaptureOpen(mem, &cur));
+  while ((count < max) && (E_OK == LinDiagCaptureNext(mem, &cur, &rec, &msg)))
+  {
+    tags[count] = msg[0];
+    count++;
+  }
+  return count;
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  uint8_t idx;
+
+  for (idx = 0u; idx < (sizeof(memory) / 4u); idx++)
+  {
+    memory[idx] = 0u;
+  }
+  ch.req_pu8 = req;
+  ch.nad_u8 = 0x10u;
+  ch.reqNad_u8 = 0x7Fu;
+  now = 1000u;
+  LinDiagCaptureStart(mem, sizeof(memory));
+}
+
+void tearDown(void)
+{
+  LinDiagCaptureStart(NULL, 0u);
+}
+
+/* ============================================================================
+ * Test Cases: Records
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagCaptureNext_RequestAndResponse
+ * Description: Record a request to the wildcard NAD, then a response sent as head and tail
+ * Expected: Both read back in order with their NAD and time, the response in one piece
+ */
+void test_LinDiagCaptureNext_RequestAndResponse(void)
+{
+  const uint8_t head[3] = {0x62, 0xF1, 0x90};
+  const uint8_t tail[2] = {0x41, 0x42};
+  LinDiagCaptureCursor_t cur;
+  LinDiagCaptureRec_t rec;
+  const uint8_t *msg;
+
+  req[0] = 0x22u;
+  req[1] = 0xF1u;
+  req[2] = 0x90u;
+  ch.reqLen_u16 = 3u;
+  LinDiagCaptureRequest(&ch);
+  now = 1500u;
+  LinDiagCaptureResponse(&ch, head, 3u, tail, 2u);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagCaptureOpen(mem, &cur));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagCaptureNext(mem, &cur, &rec, &msg));
+  TEST_ASSERT_EQUAL_HEX8(LIN_DIAG_CAPTURE_REQUEST, rec.kind_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x7F, rec.nad_u8);
+  TEST_ASSERT_EQUAL_UINT32(1000u, rec.timeUs_u32);
+  TEST_ASSERT_EQUAL_UINT16(3u, rec.len_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(req, msg, 3);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagCaptureNext(mem, &cur, &rec, &msg));
+  TEST_ASSERT_EQUAL_HEX8(LIN_DIAG_CAPTURE_RESPONSE, rec.kind_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x10, rec.nad_u8);
+  TEST_ASSERT_EQUAL_UINT32(1500u, rec.timeUs_u32);
+  TEST_ASSERT_EQUAL_UINT16(5u, rec.len_u16);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(head, msg, 3);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(tail, &msg[3], 2);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagCaptureNext(mem, &cur, &rec, &msg));
+}
+
+/**
+ * Test: LinDiagCaptureNext_Off
+ * Description: Read memory that holds no ring, then record with the capture stopped
+ * Expected: No ring found, nothing written
+ */
+void test_LinDiagCaptureNext_Off(void)
+{
+  LinDiagCaptureCursor_t cur;
+
+  LinDiagCaptureStart(NULL, 0u);
+  memory[0] = 0u;
+  request(1u, 3u);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagCaptureOpen(mem, &cur));
+  TEST_ASSERT_EQUAL_HEX8(0x00, mem[sizeof(LinDiagCaptureHdr_t)]);
+}
+
+/**
+ * Test: LinDiagCaptureNext_TooLong
+ * Description: Record a response longer than the whole ring after a request
+ * Expected: Counted as lost, the request is still there
+ */
+void test_LinDiagCaptureNext_TooLong(void)
+{
+  uint8_t tags[4];
+
+  request(1u, 3u);
+  LinDiagCaptureResponse(&ch, req, LIN_DIAG_BUFFER_SIZE, req, LIN_DIAG_BUFFER_SIZE);
+
+  TEST_ASSERT_EQUAL_UINT32(1u, hdr->lost_u32);
+  TEST_ASSERT_EQUAL_UINT8(1u, readTags(tags, 4u));
+  TEST_ASSERT_EQUAL_UINT8(1u, tags[0]);
+}
+
+/* ============================================================================
+ * Test Cases: Ring
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagCaptureNext_WrapWithPadRecord
+ * Description: Record 6 records of 11 bytes in 64 bytes: 9 bytes left at the end for the 6th
+ * Expected: The end is padded, the oldest record dropped, records 2 to 6 read in order
+ */
+void test_LinDiagCaptureNext_WrapWithPadRecord(void)
+{
+  uint8_t tags[8];
+  uint8_t idx;
+
+  for (idx = 1u; idx <= 6u; idx++)
+  {
+    request(idx, 3u);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(11u, hdr->head_u32);
+  TEST_ASSERT_EQUAL_UINT32(AREA_SIZE, hdr->used_u32);
+  TEST_ASSERT_EQUAL_UINT8(5u, readTags(tags, 8u));
+  for (idx = 0u; idx < 5u; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(idx + 2u, tags[idx]);
+  }
+}
+
+/**
+ * Test: LinDiagCaptureNext_WrapWithImplicitPad
+ * Description: Record 12-byte records in 64 bytes: 4 bytes left at the end, less than a record header
+ * Expected: The 4 bytes are skipped without a pad record, records 2 to 6 read in order
+ */
+void test_LinDiagCaptureNext_WrapWithImplicitPad(void)
+{
+  uint8_t tags[8];
+  uint8_t idx;
+
+  for (idx = 1u; idx <= 6u; idx++)
+  {
+    request(idx, 4u);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(12u, hdr->head_u32);
+  TEST_ASSERT_EQUAL_UINT8(5u, readTags(tags, 8u));
+  for (idx = 0u; idx < 5u; idx++)
+  {
+    TEST_ASSERT_EQUAL_UINT8(idx + 2u, tags[idx]);
+  }
+}
+
+/**
+ * Test: LinDiagCaptureNext_AppendOnRestart
+ * Description: Record 2 requests, restart the capture on the same memory and record a 3rd,
+ *              then restart it with another size
+ * Expected: 3 records after the first restart, an empty ring after the second
+ */
+void test_LinDiagCaptureNext_AppendOnRestart(void)
+{
+  uint8_t tags[4];
+
+  request(1u, 3u);
+  request(2u, 3u);
+  LinDiagCaptureStart(mem, sizeof(memory));
+  request(3u, 3u);
+
+  TEST_ASSERT_EQUAL_UINT8(3u, readTags(tags, 4u));
+  TEST_ASSERT_EQUAL_UINT8(1u, tags[0]);
+  TEST_ASSERT_EQUAL_UINT8(3u, tags[2]);
+
+  LinDiagCaptureStart(mem, sizeof(memory) - 4u);
+  TEST_ASSERT_EQUAL_UINT8(0u, readTags(tags, 4u));
+}
@@ -0,0 +1,86 @@
+#include "LinDiagDispatch.h"
+#include <stddef.h>
+
+Std_ReturnType LinDiagDispatchInit(LinDiagDispatch_t *const disp_ps, const LinDiagService_t *const services_ps,
+    const uint8_t count_u8)
+{
+    uint16_t l_sid_u16;
+    uint8_t l_idx_u8;
+
+    for (l_sid_u16 = 0u; l_sid_u16 < 256u; l_sid_u16++)
+    {
+        disp_ps->sidToService_au8[l_sid_u16] = LIN_DIAG_DISPATCH_NO_SERVICE;
+    }
+    disp_ps->services_ps = services_ps;
+
+    if (count_u8 >= LIN_DIAG_DISPATCH_NO_SERVICE)
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < count_u8; l_idx_u8++)
+    {
+        const LinDiagService_t *const l_svc_ps = &services_ps[l_idx_u8];
+
+        if ((LIN_DIAG_DISPATCH_NO_SERVICE != disp_ps->sidToService_au8[l_svc_ps->sid_u8]) ||
+            (0u == l_svc_ps->minLen_u16) || (l_svc_ps->minLen_u16 > l_svc_ps->maxLen_u16) ||
+            (l_svc_ps->maxLen_u16 > LIN_DIAG_BUFFER_SIZE) || (0u == l_svc_ps->lenStep_u8) ||
+            (NULL == l_svc_ps->service_pf))
+        {
+            return E_NOT_OK;
+        }
+        disp_ps->sidToService_au8[l_svc_ps->sid_u8] = l_idx_u8;
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType LinDiagDispatch(const LinDiagDispatch_t *const disp_ps, LinDiag_Channel_t *const ch_ps)
+{
+    const uint16_t l_reqLen_cu16 = ch_ps->reqLen_u16;
+    const uint8_t l_session_cu8 = ch_ps->session_u8;
+    const LinDiagService_t *l_svc_ps;
+    Std_ReturnType l_result_ = E_OK;
+    uint8_t l_errCode_u8 = 0u;
+    uint8_t l_idx_u8;
+
+    /* Request for another node: no response, a pending request of this node goes on */
+    checkCurrentNad(ch_ps->reqNad_u8, ch_ps->nad_u8, &l_result_);
+    if ((E_OK != l_result_) || (0u == l_reqLen_cu16))
+    {
+        return E_NOT_OK;
+    }
+
+    /* A new request ends the pending one, whatever its service */
+    LinDiagCancelPending(ch_ps);
+
+    l_idx_u8 = disp_ps->sidToService_au8[ch_ps->req_pu8[0]];
+    if (LIN_DIAG_DISPATCH_NO_SERVICE == l_idx_u8)
+    {
+        l_errCode_u8 = kLinDiagNrcServiceNotSupported;
+    }
+    else
+    {
+        l_svc_ps = &disp_ps->services_ps[l_idx_u8];
+
+        if ((0u == l_session_cu8) || (l_session_cu8 > kLinDiagDispatchMaxSession) ||
+            (0u == (l_svc_ps->sessions_u8 & LIN_DIAG_IN_SESSION(l_session_cu8))))
+        {
+            l_errCode_u8 = kLinDiagNrcServiceNotInSession;
+        }
+        else if ((l_reqLen_cu16 < l_svc_ps->minLen_u16) || (l_reqLen_cu16 > l_svc_ps->maxLen_u16) ||
+                 (0u != ((l_reqLen_cu16 - l_svc_ps->minLen_u16) % l_svc_ps->lenStep_u8)))
+        {
+            l_errCode_u8 = kLinDiagNrcIncorrectMsgLength;
+        }
+        else
+        {
+            return l_svc_ps->service_pf(ch_ps);
+        }
+    }
+
+    LinDiagStartRequest(ch_ps);
+    LinDiagSendNegResponse(ch_ps, l_errCode_u8);
+
+    return E_NOT_OK;
+}
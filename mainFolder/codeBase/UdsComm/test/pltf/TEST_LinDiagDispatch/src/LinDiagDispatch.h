@@ -0,0 +1,63 @@
+
+
+#ifndef DIAGNOSTIC_DISPATCH_H
+#define DIAGNOSTIC_DISPATCH_H
+
+#include "diagnostic.h"
+
+#define LIN_DIAG_DISPATCH_NO_SERVICE   ((uint8_t)0xFFu)
+
+/* Sessions a service is available in: LIN_DIAG_SESSION_* as a bit mask */
+#define LIN_DIAG_IN_SESSION(session)   ((uint8_t)(1u << ((session) - 1u)))
+#define LIN_DIAG_IN_ALL_SESSIONS       ((uint8_t)(LIN_DIAG_IN_SESSION(LIN_DIAG_SESSION_DEFAULT) | \
+                                                  LIN_DIAG_IN_SESSION(LIN_DIAG_SESSION_PROGRAMMING) | \
+                                                  LIN_DIAG_IN_SESSION(LIN_DIAG_SESSION_EXTENDED)))
+
+/* Service of a channel, called with a request that passed the checks of its descriptor */
+typedef Std_ReturnType (*LinDiagService_pf)(LinDiag_Channel_t *const ch_ps);
+
+/* Service descriptor. Request lengths count the SID: minLen_u16 .. maxLen_u16 (equal for
+ * an exact length), and a multiple of lenStep_u8 past minLen_u16 (1: any length).
+ * Checks depending on the request content (sub-function, address format) stay in the service.
+ */
+typedef struct
+{
+    uint8_t           sid_u8;
+    uint8_t           sessions_u8;     /* LIN_DIAG_IN_SESSION() mask */
+    uint16_t          minLen_u16;
+    uint16_t          maxLen_u16;
+    uint8_t           lenStep_u8;
+    LinDiagService_pf service_pf;
+} LinDiagService_t;
+
+/* Service table of a node: the SID of a request selects its descriptor in one table lookup.
+ * A dispatcher holds no channel state and can serve every channel of a gateway.
+ */
+typedef struct
+{
+    const LinDiagService_t *services_ps;
+    uint8_t                 sidToService_au8[256];   /* Descriptor index per SID, LIN_DIAG_DISPATCH_NO_SERVICE if none */
+} LinDiagDispatch_t;
+
+/* Index count_u8 descriptors of services_ps. E_NOT_OK when a SID comes twice or
+ * the length rules of a descriptor are not within 1 .. LIN_DIAG_BUFFER_SIZE.
+ */
+Std_ReturnType LinDiagDispatchInit(LinDiagDispatch_t *const disp_ps, const LinDiagService_t *const services_ps,
+    const uint8_t count_u8);
+
+/* Serve the request in ch_ps->req_pu8. A request for another NAD gets no response (E_NOT_OK).
+ * Any other request ends the pending one of the channel, then is refused with service not
+ * supported, service not supported in active session or incorrect length (E_NOT_OK) before
+ * the service sees it. Returns the result of the service otherwise.
+ */
+Std_ReturnType LinDiagDispatch(const LinDiagDispatch_t *const disp_ps, LinDiag_Channel_t *const ch_ps);
+
+/* Sessions a descriptor mask can hold */
+#define kLinDiagDispatchMaxSession     ((uint8_t)8u)
+
+/* Request helpers of diagnostic.c */
+void LinDiagStartRequest(LinDiag_Channel_t *const ch_ps);
+void LinDiagSendNegResponse(LinDiag_Channel_t *const ch_ps, uint8_t errorCode);
+void LinDiagCancelPending(LinDiag_Channel_t *const ch_ps);
+
+#endif
@@ -0,0 +1,198 @@
+#include "unity.h"
+#include "LinDiagDispatch.h"
+
+static LinDiagDispatch_t disp;
+static LinDiag_Channel_t ch;
+static uint8_t req[LIN_DIAG_BUFFER_SIZE];
+
+/* Stand-ins of the request helpers and of the services: record what the dispatcher did */
+static uint8_t nrc;
+static uint8_t nrcCount;
+static uint8_t cancelCount;
+static uint8_t readCount;
+static uint8_t writeCount;
+
+void checkCurrentNad(uint8 currentNad, uint8 nodeNad, Std_ReturnType *result)
+{
+  *result = ((currentNad == nodeNad) || (LIN_DIAG_NAD_WILDCARD == currentNad)) ? E_OK : E_NOT_OK;
+}
+
+void LinDiagStartRequest(LinDiag_Channel_t *const ch_ps)
+{
+  ch_ps->sid_u8 = ch_ps->req_pu8[0];
+}
+
+void LinDiagSendNegResponse(LinDiag_Channel_t *const ch_ps, uint8_t errorCode)
+{
+  (void)ch_ps;
+  nrc = errorCode;
+  nrcCount++;
+}
+
+void LinDiagCancelPending(LinDiag_Channel_t *const ch_ps)
+{
+  (void)ch_ps;
+  cancelCount++;
+}
+
+static Std_ReturnType readService(LinDiag_Channel_t *const ch_ps)
+{
+  (void)ch_ps;
+  readCount++;
+  return E_OK;
+}
+
+static Std_ReturnType writeService(LinDiag_Channel_t *const ch_ps)
+{
+  (void)ch_ps;
+  writeCount++;
+  return E_OK;
+}
+
+/* ReadDataById-like: 1 to 3 DIDs. WriteDataById-like: 4 bytes exactly, extended session only. */
+static const LinDiagService_t services[2] =
+{
+  { 0x22u, LIN_DIAG_IN_ALL_SESSIONS, 3u, 7u, 2u, &readService },
+  { 0x2Eu, LIN_DIAG_IN_SESSION(LIN_DIAG_SESSION_EXTENDED), 4u, 4u, 1u, &writeService },
+};
+
+static void request(const uint8_t sid, const uint16_t len)
+{
+  req[0] = sid;
+  ch.reqLen_u16 = len;
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagDispatchInit(&disp, services, 2u));
+  ch.req_pu8 = req;
+  ch.nad_u8 = 0x10u;
+  ch.reqNad_u8 = 0x10u;
+  ch.session_u8 = LIN_DIAG_SESSION_DEFAULT;
+  nrc = 0u;
+  nrcCount = 0u;
+  cancelCount = 0u;
+  readCount = 0u;
+  writeCount = 0u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Service Table
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagDispatchInit_InvalidTable
+ * Description: Index a table with a SID twice, then one with a maximum length past the buffer
+ * Expected: Both refused
+ */
+void test_LinDiagDispatchInit_InvalidTable(void)
+{
+  const LinDiagService_t twice[2] =
+  {
+    { 0x22u, LIN_DIAG_IN_ALL_SESSIONS, 3u, 7u, 2u, &readService },
+    { 0x22u, LIN_DIAG_IN_ALL_SESSIONS, 3u, 5u, 2u, &readService },
+  };
+  const LinDiagService_t tooLong[1] =
+  {
+    { 0x2Eu, LIN_DIAG_IN_ALL_SESSIONS, 4u, LIN_DIAG_BUFFER_SIZE + 1u, 1u, &writeService },
+  };
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagDispatchInit(&disp, twice, 2u));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagDispatchInit(&disp, tooLong, 1u));
+}
+
+/**
+ * Test: LinDiagDispatch_ServiceBySid
+ * Description: Dispatch a well-formed request of each service, in the extended session
+ * Expected: Each service called once, no negative response, the pending request ended first
+ */
+void test_LinDiagDispatch_ServiceBySid(void)
+{
+  ch.session_u8 = LIN_DIAG_SESSION_EXTENDED;
+
+  request(0x22u, 5u);
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagDispatch(&disp, &ch));
+  request(0x2Eu, 4u);
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagDispatch(&disp, &ch));
+
+  TEST_ASSERT_EQUAL_UINT8(1u, readCount);
+  TEST_ASSERT_EQUAL_UINT8(1u, writeCount);
+  TEST_ASSERT_EQUAL_UINT8(0u, nrcCount);
+  TEST_ASSERT_EQUAL_UINT8(2u, cancelCount);
+}
+
+/* ============================================================================
+ * Test Cases: Refused Requests
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagDispatch_ServiceNotSupported
+ * Description: Dispatch a request with a SID missing from the table
+ * Expected: NRC 0x11, no service called
+ */
+void test_LinDiagDispatch_ServiceNotSupported(void)
+{
+  request(0x31u, 4u);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagDispatch(&disp, &ch));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcServiceNotSupported, nrc);
+  TEST_ASSERT_EQUAL_HEX8(0x31, ch.sid_u8);
+  TEST_ASSERT_EQUAL_UINT8(0u, readCount + writeCount);
+}
+
+/**
+ * Test: LinDiagDispatch_NotInSession
+ * Description: Dispatch the extended-only service in the default session, with a wrong length too
+ * Expected: NRC 0x7F: the session is checked before the length
+ */
+void test_LinDiagDispatch_NotInSession(void)
+{
+  request(0x2Eu, 3u);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagDispatch(&disp, &ch));
+  TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcServiceNotInSession, nrc);
+  TEST_ASSERT_EQUAL_UINT8(0u, writeCount);
+}
+
+/**
+ * Test: LinDiagDispatch_LengthRules
+ * Description: Dispatch ReadDataById-like requests of 1, 2, 4 and 9 bytes
+ * Expected: NRC 0x13 for each (too short, too short, half a DID, too long), no service called
+ */
+void test_LinDiagDispatch_LengthRules(void)
+{
+  const uint16_t lengths[4] = {1u, 2u, 4u, 9u};
+  uint8_t idx;
+
+  for (idx = 0u; idx < 4u; idx++)
+  {
+    request(0x22u, lengths[idx]);
+    TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagDispatch(&disp, &ch));
+    TEST_ASSERT_EQUAL_HEX8(kLinDiagNrcIncorrectMsgLength, nrc);
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(4u, nrcCount);
+  TEST_ASSERT_EQUAL_UINT8(0u, readCount);
+}
+
+/**
+ * Test: LinDiagDispatch_OtherNad
+ * Description: Dispatch a malformed request addressed to another node
+ * Expected: No response at all and the pending request of this node goes on
+ */
+void test_LinDiagDispatch_OtherNad(void)
+{
+  ch.reqNad_u8 = 0x11u;
+  request(0x22u, 2u);
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagDispatch(&disp, &ch));
+  TEST_ASSERT_EQUAL_UINT8(0u, nrcCount);
+  TEST_ASSERT_EQUAL_UINT8(0u, cancelCount);
+}
@@ -0,0 +1,69 @@
+#include "LinDiagGatewayRxFrame.h"
+#include <stddef.h>
+
+void LinDiagGatewayInit(LinDiagGateway_t *const gw_ps)
+{
+    uint16_t l_nad_u16;
+
+    for (l_nad_u16 = 0u; l_nad_u16 < 256u; l_nad_u16++)
+    {
+        gw_ps->nadToNode_au8[l_nad_u16] = LIN_DIAG_GATEWAY_NO_NODE;
+    }
+    gw_ps->nodeCount_u8 = 0u;
+    gw_ps->respNode_u8 = LIN_DIAG_GATEWAY_NO_NODE;
+}
+
+Std_ReturnType LinDiagGatewayAddNode(LinDiagGateway_t *const gw_ps, LinDiag_Channel_t *const ch_ps)
+{
+    const uint8_t l_nad_cu8 = ch_ps->nad_u8;
+
+    if ((gw_ps->nodeCount_u8 >= LIN_DIAG_GATEWAY_NODES) ||
+        (kLinDiagNadSleep == l_nad_cu8) || (kLinDiagNadFunctional == l_nad_cu8) || (LIN_DIAG_NAD_WILDCARD == l_nad_cu8) ||
+        (LIN_DIAG_GATEWAY_NO_NODE != gw_ps->nadToNode_au8[l_nad_cu8]))
+    {
+        return E_NOT_OK;
+    }
+
+    gw_ps->nodes_aps[gw_ps->nodeCount_u8] = ch_ps;
+    gw_ps->nadToNode_au8[l_nad_cu8] = gw_ps->nodeCount_u8;
+    gw_ps->nodeCount_u8++;
+
+    return E_OK;
+}
+
+uint8_t LinDiagGatewaySelectNode(LinDiagGateway_t *const gw_ps, const uint8_t nad_u8)
+{
+    const uint8_t l_node_cu8 = gw_ps->nadToNode_au8[nad_u8];
+
+    if (LIN_DIAG_GATEWAY_NO_NODE != l_node_cu8)
+    {
+        gw_ps->respNode_u8 = l_node_cu8;
+    }
+
+    return l_node_cu8;
+}
+
+LinDiag_Channel_t *LinDiagGatewayRxFrame(LinDiagGateway_t *const gw_ps, const uint8_t *const frame_pu8)
+{
+    const uint8_t l_node_cu8 = LinDiagGatewaySelectNode(gw_ps, frame_pu8[0]);
+    LinDiag_Channel_t *l_ch_ps;
+
+    if (LIN_DIAG_GATEWAY_NO_NODE == l_node_cu8)
+    {
+        return NULL;
+    }
+
+    l_ch_ps = gw_ps->nodes_aps[l_node_cu8];
+
+    return (E_OK == LinDiagRxFrame(l_ch_ps, frame_pu8)) ? l_ch_ps : NULL;
+}
+
+Std_ReturnType LinDiagGatewayGetTxFrame(LinDiagGateway_t *const gw_ps, uint8_t *const frame_pu8)
+{
+    if (LIN_DIAG_GATEWAY_NO_NODE == gw_ps->respNode_u8)
+    {
+        return E_NOT_OK;
+    }
+
+    return LinDiagGetTxFrame(gw_ps->nodes_aps[gw_ps->respNode_u8], frame_pu8);
+}
@@ -0,0 +1,113 @@
+
+
+#ifndef DIAGNOSTIC_H
+#define DIAGNOSTIC_H
+
+#include <stdint.h>
+#include "diagnostic_cfg.h"
+#include "diagnostic_tp.h"
+
+extern uint8_t pbLinDiagBuffer[LIN_DIAG_BUFFER_SIZE];
+/* Message length */
+extern uint16_t g_linDiagDataLength;
+
+/* Most DIDs a single ReadDataById request can carry: SID + 2 bytes per DID */
+#define LIN_DIAG_RDBI_MAX_DIDS ((LIN_DIAG_BUFFER_SIZE - 1u) / 2u)
+
+/* Diagnostic sessions (DiagnosticSessionControl values) */
+#define LIN_DIAG_SESSION_DEFAULT       ((uint8_t)0x01u)
+#define LIN_DIAG_SESSION_PROGRAMMING   ((uint8_t)0x02u)
+#define LIN_DIAG_SESSION_EXTENDED      ((uint8_t)0x03u)
+
+/* Scheduler of ReadDataByPeriodicIdentifier, see diagnostic_periodic.h */
+typedef struct LinDiagPeriodic_s LinDiagPeriodic_t;
+
+/* Diagnostic channel: everything a request needs from reception to response.
+ * Channels keep their requests apart but share the statistics, the capture ring and the NVM
+ * backend: serve every channel from one task. Interrupts only feed the request queues.
+ */
+typedef struct
+{
+    uint8_t       *req_pu8;          /* Request buffer, LIN_DIAG_BUFFER_SIZE bytes */
+    uint8_t       *resp_pu8;         /* Response buffer, LIN_DIAG_BUFFER_SIZE bytes, may alias req_pu8 */
+    uint16_t       reqLen_u16;       /* Request length, SID included */
+    uint16_t       respLen_u16;      /* Response length in resp_pu8, response SID included */
+    const uint8_t *respTail_pu8;     /* Response part sent in place after resp_pu8 (streamed DID), NULL if none */
+    uint16_t       respTailLen_u16;
+    uint8_t        negResp_au8[3];   /* Negative response: 0x7F, request SID, NRC */
+    uint8_t        nad_u8;
+    uint8_t        reqNad_u8;        /* NAD the request in req_pu8 was addressed to */
+    diagNode_t    *node_ps;          /* DID table and DID state of the node, see diagNodeInit */
+    LinDiagPeriodic_t *periodic_ps;  /* Periodic identifiers of the channel, NULL if it serves no 0x2A */
+    uint8_t        sid_u8;           /* SID of the request being served */
+    uint8_t        session_u8;       /* Active session, LIN_DIAG_SESSION_* */
+    uint32_t       reqStart_u32;     /* diagStatsNow() when the request was taken up */
+    /* ReadDataById in progress, kept across calls while an asynchronous DID is pending */
+    uint16_t       rdbiDids_au16[LIN_DIAG_RDBI_MAX_DIDS];
+    uint8_t        rdbiDidCount_u8;
+    uint8_t        rdbiDidIdx_u8;    /* DID being served */
+    uint8_t        rdbiRespPos_u8;   /* Next free byte of resp_pu8 */
+    uint8_t        rdbiSupported_u8;
+    uint8_t        pending_u8;       /* Asynchronous DID pending, polled by LinDiagMainFunction */
+    uint8_t        rcrrpSent_u8;     /* Response pending (NRC 0x78) already sent for this request */
+    uint16_t       pendingTicks_u16; /* LinDiagMainFunction calls since the request or the last NRC 0x78 */
+    uint16_t       pendingTotal_u16; /* LinDiagMainFunction calls since the request */
+    LinDiagTpTx_t  tpTx_s;
+    LinDiagTpRx_t  tpRx_s;
+} LinDiag_Channel_t;
+
+/* Channel bound in place to pbLinDiagBuffer / g_linDiagDataLength, to diagDefaultNode and to
+ * a periodic scheduler of its own, used by ApplLinDiagReadDataById and ApplLinDiagDispatch
+ */
+extern LinDiag_Channel_t LinDiag_DefaultChannel;
+
+/* Bind a channel to its buffers and to the DID context of its node (started with diagNodeInit).
+ * resp_pu8 may be req_pu8 (response built in place). The channel starts without periodic
+ * scheduler: set periodic_ps to serve ReadDataByPeriodicIdentifier.
+ */
+void LinDiagChannelInit(LinDiag_Channel_t *const ch_ps, uint8_t *const req_pu8, uint8_t *const resp_pu8,
+    const uint8_t nad_u8, diagNode_t *const node_ps);
+
+/* ReadDataById (0x22) on ch_ps->req_pu8: one or more DIDs per request.
+ * The response (DID + data for every supported DID) is assembled from resp_pu8[1].
+ * A single DID too long for the buffer is streamed in place by the transport layer.
+ * Returns E_OK when a positive response was sent, DIAG_E_PENDING when an asynchronous
+ * DID is still working (finished by LinDiagMainFunction). A new request cancels a pending one.
+ * A request addressed to another NAD is ignored: E_NOT_OK, no response.
+ */
+Std_ReturnType LinDiagReadDataById(LinDiag_Channel_t *const ch_ps);
+
+/* Periodic task of the channel, every LIN_DIAG_MAIN_PERIOD_MS: polls the pending
+ * asynchronous DID, sends NRC 0x78 to keep the server timing and gives up after
+ * LIN_DIAG_PENDING_TIMEOUT_MS. Same results as LinDiagReadDataById, E_NOT_OK when idle.
+ */
+Std_ReturnType LinDiagMainFunction(LinDiag_Channel_t *const ch_ps);
+
+/* Feed one master request frame to the channel, E_OK once a complete request is in req_pu8.
+ * The NAD of the frame is kept for the request: a request for another node gets no response.
+ */
+Std_ReturnType LinDiagRxFrame(LinDiag_Channel_t *const ch_ps, const uint8_t *const frame_pu8);
+
+/* Next slave response frame of the channel, E_NOT_OK when nothing to send */
+Std_ReturnType LinDiagGetTxFrame(LinDiag_Channel_t *const ch_ps, uint8_t *const frame_pu8);
+
+/* ReadDataById on pbLinDiagBuffer / g_linDiagDataLength (LinDiag_DefaultChannel) */
+void ApplLinDiagReadDataById(void);
+
+/* LinDiagMainFunction of LinDiag_DefaultChannel, updates g_linDiagDataLength on completion */
+void ApplLinDiagMainFunction(void);
+
+/* Periodic scheduler of LinDiag_DefaultChannel, every LIN_DIAG_MAIN_PERIOD_MS after ApplLinDiagMainFunction */
+void ApplLinDiagPeriodicMainFunction(void);
+
+/* Index the product services (LinDiagServices_cas) for ApplLinDiagDispatch and start the
+ * periodic scheduler of LinDiag_DefaultChannel. E_NOT_OK if the service table is invalid.
+ */
+Std_ReturnType ApplLinDiagDispatchInit(void);
+
+/* Any product service on pbLinDiagBuffer / g_linDiagDataLength (LinDiag_DefaultChannel).
+ * g_linDiagDataLength is then the response length, response SID excluded, as for ApplLinDiagReadDataById.
+ */
+void ApplLinDiagDispatch(void);
+
+#endif
@@ -0,0 +1,167 @@
+#include "unity.h"
+#include "LinDiagGatewayRxFrame.h"
+
+static LinDiagGateway_t gw;
+static LinDiag_Channel_t nodes[LIN_DIAG_GATEWAY_NODES];
+
+/* Channel stand-ins: record the channel a frame or a header reached */
+static LinDiag_Channel_t *rxChannel;
+static LinDiag_Channel_t *txChannel;
+static Std_ReturnType rxResult;
+
+Std_ReturnType LinDiagRxFrame(LinDiag_Channel_t *const ch_ps, const uint8_t *const frame_pu8)
+{
+  (void)frame_pu8;
+  rxChannel = ch_ps;
+  return rxResult;
+}
+
+Std_ReturnType LinDiagGetTxFrame(LinDiag_Channel_t *const ch_ps, uint8_t *const frame_pu8)
+{
+  (void)frame_pu8;
+  txChannel = ch_ps;
+  return E_OK;
+}
+
+static void addNodes(uint8_t count)
+{
+  uint8_t idx;
+
+  for (idx = 0u; idx < count; idx++)
+  {
+    nodes[idx].nad_u8 = (uint8_t)(0x10u + idx);
+    TEST_ASSERT_EQUAL_INT(E_OK, LinDiagGatewayAddNode(&gw, &nodes[idx]));
+  }
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  LinDiagGatewayInit(&gw);
+  rxChannel = NULL;
+  txChannel = NULL;
+  rxResult = E_OK;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Node Table
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagGatewayAddNode_Full
+ * Description: Add LIN_DIAG_GATEWAY_NODES nodes, then one more
+ * Expected: The extra node is refused
+ */
+void test_LinDiagGatewayAddNode_Full(void)
+{
+  LinDiag_Channel_t extra = {0};
+
+  addNodes(LIN_DIAG_GATEWAY_NODES);
+  extra.nad_u8 = 0x60u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagGatewayAddNode(&gw, &extra));
+  TEST_ASSERT_EQUAL_UINT8(LIN_DIAG_GATEWAY_NODES, gw.nodeCount_u8);
+}
+
+/**
+ * Test: LinDiagGatewayAddNode_ReservedOrTakenNad
+ * Description: Add nodes with the sleep, functional and wildcard NADs, then a NAD already served
+ * Expected: All refused, the table still maps the NAD to the first node
+ */
+void test_LinDiagGatewayAddNode_ReservedOrTakenNad(void)
+{
+  const uint8_t reserved[3] = {0x00, 0x7E, 0x7F};
+  LinDiag_Channel_t other = {0};
+  uint8_t idx;
+
+  addNodes(1u);
+  for (idx = 0u; idx < 3u; idx++)
+  {
+    other.nad_u8 = reserved[idx];
+    TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagGatewayAddNode(&gw, &other));
+  }
+  other.nad_u8 = 0x10u;
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagGatewayAddNode(&gw, &other));
+  TEST_ASSERT_EQUAL_UINT8(0u, gw.nadToNode_au8[0x10]);
+}
+
+/* ============================================================================
+ * Test Cases: Routing
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagGatewayRxFrame_RoutedByNad
+ * Description: Send a complete request to the last of 16 nodes
+ * Expected: That node's channel receives the frame and is returned
+ */
+void test_LinDiagGatewayRxFrame_RoutedByNad(void)
+{
+  const uint8_t frame[8] = {0x1F, 0x03, 0x22, 0xF3, 0x08, 0xFF, 0xFF, 0xFF};
+
+  addNodes(LIN_DIAG_GATEWAY_NODES);
+
+  TEST_ASSERT_EQUAL_PTR(&nodes[15], LinDiagGatewayRxFrame(&gw, frame));
+  TEST_ASSERT_EQUAL_PTR(&nodes[15], rxChannel);
+}
+
+/**
+ * Test: LinDiagGatewayRxFrame_IncompleteRequest
+ * Description: Send the first frame of a segmented request
+ * Expected: The node receives it, no channel returned yet
+ */
+void test_LinDiagGatewayRxFrame_IncompleteRequest(void)
+{
+  const uint8_t frame[8] = {0x11, 0x10, 0x08, 0x22, 0xF1, 0x90, 0xF2, 0x01};
+
+  addNodes(2u);
+  rxResult = E_NOT_OK;
+
+  TEST_ASSERT_NULL(LinDiagGatewayRxFrame(&gw, frame));
+  TEST_ASSERT_EQUAL_PTR(&nodes[1], rxChannel);
+}
+
+/**
+ * Test: LinDiagGatewayRxFrame_NadNotServed
+ * Description: Send requests to a NAD no node has and to the wildcard NAD
+ * Expected: No channel sees them and no node answers the next header
+ */
+void test_LinDiagGatewayRxFrame_NadNotServed(void)
+{
+  const uint8_t frame[8] = {0x42, 0x03, 0x22, 0xF3, 0x08, 0xFF, 0xFF, 0xFF};
+  const uint8_t wildcard[8] = {0x7F, 0x03, 0x22, 0xF3, 0x08, 0xFF, 0xFF, 0xFF};
+  uint8_t response[8];
+
+  addNodes(4u);
+
+  TEST_ASSERT_NULL(LinDiagGatewayRxFrame(&gw, frame));
+  TEST_ASSERT_NULL(LinDiagGatewayRxFrame(&gw, wildcard));
+  TEST_ASSERT_NULL(rxChannel);
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagGatewayGetTxFrame(&gw, response));
+  TEST_ASSERT_NULL(txChannel);
+}
+
+/**
+ * Test: LinDiagGatewayGetTxFrame_NodeAddressedLast
+ * Description: Address two nodes in turn, then send a slave response header
+ * Expected: Only the node addressed last answers
+ */
+void test_LinDiagGatewayGetTxFrame_NodeAddressedLast(void)
+{
+  const uint8_t first[8] = {0x12, 0x03, 0x22, 0xF3, 0x08, 0xFF, 0xFF, 0xFF};
+  const uint8_t second[8] = {0x15, 0x03, 0x22, 0xF2, 0x01, 0xFF, 0xFF, 0xFF};
+  uint8_t response[8];
+
+  addNodes(8u);
+  (void)LinDiagGatewayRxFrame(&gw, first);
+  (void)LinDiagGatewayRxFrame(&gw, second);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagGatewayGetTxFrame(&gw, response));
+  TEST_ASSERT_EQUAL_PTR(&nodes[5], txChannel);
+}
@@ -0,0 +1,134 @@
+#include "LinDiagPeriodicTick.h"
+
+#define LIN_DIAG_PDID_BIT(pdid)   ((uint8_t)(1u << ((pdid) & 7u)))
+
+
+
+void LinDiagPeriodicInit(LinDiagPeriodic_t *const sched_ps)
+{
+    static const uint16_t l_periodsMs_cau16[LIN_DIAG_PERIODIC_RATES] =
+    {
+        LIN_DIAG_PERIODIC_SLOW_MS, LIN_DIAG_PERIODIC_MEDIUM_MS, LIN_DIAG_PERIODIC_FAST_MS
+    };
+    uint8_t l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < LIN_DIAG_PERIODIC_RATES; l_idx_u8++)
+    {
+        sched_ps->buckets_as[l_idx_u8].periodTicks_u16 = LIN_DIAG_MS_TO_TICKS(l_periodsMs_cau16[l_idx_u8]);
+        sched_ps->buckets_as[l_idx_u8].countdown_u16 = sched_ps->buckets_as[l_idx_u8].periodTicks_u16;
+        sched_ps->buckets_as[l_idx_u8].count_u8 = 0u;
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < sizeof(sched_ps->queued_au8); l_idx_u8++)
+    {
+        sched_ps->queued_au8[l_idx_u8] = 0u;
+        sched_ps->scheduled_au8[l_idx_u8] = 0u;
+    }
+
+    sched_ps->scheduledCount_u8 = 0u;
+    sched_ps->dueHead_u8 = 0u;
+    sched_ps->dueCount_u8 = 0u;
+}
+
+Std_ReturnType LinDiagPeriodicRemove(LinDiagPeriodic_t *const sched_ps, const uint8_t pdid_u8)
+{
+    uint8_t l_rate_u8;
+    uint8_t l_idx_u8;
+    uint8_t l_kept_u8;
+
+    if (0u == (sched_ps->scheduled_au8[pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(pdid_u8)))
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_rate_u8 = 0u; l_rate_u8 < LIN_DIAG_PERIODIC_RATES; l_rate_u8++)
+    {
+        LinDiagPeriodicBucket_t *const l_bucket_ps = &sched_ps->buckets_as[l_rate_u8];
+
+        for (l_idx_u8 = 0u; l_idx_u8 < l_bucket_ps->count_u8; l_idx_u8++)
+        {
+            if (pdid_u8 == l_bucket_ps->pdids_au8[l_idx_u8])
+            {
+                /* Order inside a bucket does not matter: move the last one here */
+                l_bucket_ps->count_u8--;
+                l_bucket_ps->pdids_au8[l_idx_u8] = l_bucket_ps->pdids_au8[l_bucket_ps->count_u8];
+                sched_ps->scheduled_au8[pdid_u8 >> 3] &= (uint8_t)~LIN_DIAG_PDID_BIT(pdid_u8);
+                sched_ps->scheduledCount_u8--;
+
+                /* A sample already queued goes too, the FIFO keeps the order of the others */
+                if (0u != (sched_ps->queued_au8[pdid_u8 >> 3] & LIN_DIAG_PDID_BIT(pdid_u8)))
+                {
+                    sched_ps->queued_au8[pdid_u8 >> 3] &= (uint8_t)~LIN_DIAG_PDID_BIT(pdid_u8);
+                    l_kept_u8 = 0u;
+                    for (l_idx_u8 = 0u; l_idx_u8 < sched_ps->dueCount_u8; l_idx_u8++)
+                    {
+                        const uint8_t l_due_u8 = sched_ps->due_au8[(uint8_t)((sched_ps->dueHead_u8 + l_idx_u8) % LIN_DIAG_PERIODIC_MAX)];
+
+                        if (pdid_u8 != l_due_u8)
+                        {
+                            sched_ps->due_au8[(uint8_t)((sched_ps->dueHead_u8 + l_kept_u8) % LIN_DIAG_PERIODIC_MAX)] = l_due_u8;
+                            l_kept_u8++;
+                        }
+                    }
+                    sched_ps->dueCount_u8 = l_kept_u8;
+                }
+                return E_OK;
+            }
+        }
+    }
+
+    return E_NOT_OK;
+}
+
+Std_ReturnType LinDiagPeriodicAdd(LinDiagPeriodic_t *const sched_ps, const uint8_t rate_u8, const uint8_t pdid_u8)
+{
+    LinDiagPeriodicBucket_t *const l_bucket_ps = &sched_ps->buckets_as[rate_u8];
+
+    (void)LinDiagPeriodicRemove(sched_ps, pdid_u8);
+
+    if (sched_ps->scheduledCount_u8 >= LIN_DIAG_PERIODIC_MAX)
+    {
+        return E_NOT_OK;
+    }
+
+    l_bucket_ps->pdids_au8[l_bucket_ps->count_u8] = pdid_u8;
+    l_bucket_ps->count_u8++;
+    sched_ps->scheduled_au8[pdid_u8 >> 3] |= LIN_DIAG_PDID_BIT(pdid_u8);
+    sched_ps->scheduledCount_u8++;
+
+    return E_OK;
+}
+
+void LinDiagPeriodicTick(LinDiagPeriodic_t *const sched_ps)
+{
+    uint8_t l_rate_u8;
+    uint8_t l_idx_u8;
+
+    for (l_rate_u8 = 0u; l_rate_u8 < LIN_DIAG_PERIODIC_RATES; l_rate_u8++)
+    {
+        LinDiagPeriodicBucket_t *const l_bucket_ps = &sched_ps->buckets_as[l_rate_u8];
+
+        if (l_bucket_ps->countdown_u16 > 1u)
+        {
+            l_bucket_ps->countdown_u16--;
+            continue;
+        }
+        l_bucket_ps->countdown_u16 = l_bucket_ps->periodTicks_u16;
+
+        for (l_idx_u8 = 0u; l_idx_u8 < l_bucket_ps->count_u8; l_idx_u8++)
+        {
+            const uint8_t l_pdid_u8 = l_bucket_ps->pdids_au8[l_idx_u8];
+            uint8_t *const l_queued_pu8 = &sched_ps->queued_au8[l_pdid_u8 >> 3];
+
+            /* Not sent since its last period (bus too slow): keep a single sample queued */
+            if ((0u != (*l_queued_pu8 & LIN_DIAG_PDID_BIT(l_pdid_u8))) || (sched_ps->dueCount_u8 >= LIN_DIAG_PERIODIC_MAX))
+            {
+                continue;
+            }
+
+            sched_ps->due_au8[(uint8_t)((sched_ps->dueHead_u8 + sched_ps->dueCount_u8) % LIN_DIAG_PERIODIC_MAX)] = l_pdid_u8;
+            sched_ps->dueCount_u8++;
+            *l_queued_pu8 |= LIN_DIAG_PDID_BIT(l_pdid_u8);
+        }
+    }
+}
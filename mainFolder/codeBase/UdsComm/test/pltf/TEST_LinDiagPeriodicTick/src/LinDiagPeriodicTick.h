@@ -0,0 +1,63 @@
+
+
+#ifndef DIAGNOSTIC_PERIODIC_H
+#define DIAGNOSTIC_PERIODIC_H
+
+#include "diagnostic.h"
+
+/* ReadDataByPeriodicIdentifier (0x2A) transmission modes */
+#define LIN_DIAG_PERIODIC_MODE_SLOW        ((uint8_t)0x01u)
+#define LIN_DIAG_PERIODIC_MODE_MEDIUM      ((uint8_t)0x02u)
+#define LIN_DIAG_PERIODIC_MODE_FAST        ((uint8_t)0x03u)
+#define LIN_DIAG_PERIODIC_MODE_STOP        ((uint8_t)0x04u)
+#define LIN_DIAG_PERIODIC_RATES            3u
+
+/* Periodic identifier pDID reads DID 0xF200 + pDID */
+#define LIN_DIAG_PERIODIC_DID_BASE         ((uint16_t)0xF200u)
+
+/* Periodic identifiers sharing one rate */
+typedef struct
+{
+    uint16_t periodTicks_u16;
+    uint16_t countdown_u16;                        /* Ticks before the bucket is due */
+    uint8_t  count_u8;
+    uint8_t  pdids_au8[LIN_DIAG_PERIODIC_MAX];
+} LinDiagPeriodicBucket_t;
+
+/* Periodic scheduler of one channel (its periodic_ps). A tick only touches the buckets that are due,
+ * their identifiers are queued once and sent one per message when the channel is idle.
+ */
+struct LinDiagPeriodic_s
+{
+    LinDiagPeriodicBucket_t buckets_as[LIN_DIAG_PERIODIC_RATES]; /* Slow, medium, fast */
+    uint8_t  scheduledCount_u8;                    /* Identifiers in all buckets */
+    uint8_t  scheduled_au8[32];                    /* Bit per identifier: in a bucket */
+    uint8_t  due_au8[LIN_DIAG_PERIODIC_MAX];       /* Identifiers waiting for the bus, FIFO */
+    uint8_t  dueHead_u8;
+    uint8_t  dueCount_u8;
+    uint8_t  queued_au8[32];                       /* Bit per identifier: already in due_au8 */
+    uint8_t  sample_au8[LIN_DIAG_BUFFER_SIZE];     /* Periodic message in transmission */
+};
+
+void LinDiagPeriodicInit(LinDiagPeriodic_t *const sched_ps);
+
+/* ReadDataByPeriodicIdentifier (0x2A) on ch_ps->req_pu8: transmission mode then periodic identifiers,
+ * scheduled in ch_ps->periodic_ps. Slow / medium / fast (re)schedule the supported identifiers,
+ * stop removes the listed ones or all of them when none is listed. A request that does not fit
+ * the scheduler changes nothing, a channel without scheduler refuses the service.
+ * Returns E_OK when a positive response was sent.
+ */
+Std_ReturnType LinDiagReadDataByPeriodicId(LinDiag_Channel_t *const ch_ps);
+
+/* Every LIN_DIAG_MAIN_PERIOD_MS: schedule the due identifiers and, when the channel is idle,
+ * send the next periodic message (0x6A, pDID, data).
+ */
+void LinDiagPeriodicMainFunction(LinDiagPeriodic_t *const sched_ps, LinDiag_Channel_t *const ch_ps);
+
+Std_ReturnType LinDiagPeriodicAdd(LinDiagPeriodic_t *const sched_ps, const uint8_t rate_u8, const uint8_t pdid_u8);
+
+Std_ReturnType LinDiagPeriodicRemove(LinDiagPeriodic_t *const sched_ps, const uint8_t pdid_u8);
+
+void LinDiagPeriodicTick(LinDiagPeriodic_t *const sched_ps);
+
+#endif
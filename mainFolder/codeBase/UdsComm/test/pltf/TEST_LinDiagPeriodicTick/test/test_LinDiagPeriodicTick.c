@@ -0,0 +1,162 @@
+#include "unity.h"
+#include "LinDiagPeriodicTick.h"
+
+static LinDiagPeriodic_t sched;
+
+#define SLOW   0u
+#define MEDIUM 1u
+#define FAST   2u
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  LinDiagPeriodicInit(&sched);
+}
+
+void tearDown(void)
+{
+}
+
+static void tick(uint16_t count)
+{
+  while (count-- > 0u)
+  {
+    LinDiagPeriodicTick(&sched);
+  }
+}
+
+/* ============================================================================
+ * Test Cases: Rate Buckets
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagPeriodicTick_FastBucketDue
+ * Description: Schedule one identifier at the fast rate and tick one fast period
+ * Expected: Nothing queued before the period ends, the identifier queued once at its end
+ */
+void test_LinDiagPeriodicTick_FastBucketDue(void)
+{
+  const uint16_t period = LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PERIODIC_FAST_MS);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x01u));
+
+  tick((uint16_t)(period - 1u));
+  TEST_ASSERT_EQUAL_INT(0, sched.dueCount_u8);
+
+  tick(1u);
+  TEST_ASSERT_EQUAL_INT(1, sched.dueCount_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x01, sched.due_au8[sched.dueHead_u8]);
+}
+
+/**
+ * Test: LinDiagPeriodicTick_NotQueuedTwice
+ * Description: Let several periods elapse without sending anything
+ * Expected: The identifier stays queued once
+ */
+void test_LinDiagPeriodicTick_NotQueuedTwice(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x01u));
+
+  tick((uint16_t)(3u * LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PERIODIC_FAST_MS)));
+
+  TEST_ASSERT_EQUAL_INT(1, sched.dueCount_u8);
+}
+
+/**
+ * Test: LinDiagPeriodicTick_RatesIndependent
+ * Description: Schedule one identifier per rate and tick one medium period
+ * Expected: Fast and medium identifiers queued, slow one not yet
+ */
+void test_LinDiagPeriodicTick_RatesIndependent(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, SLOW, 0x10u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, MEDIUM, 0x20u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x30u));
+
+  tick(LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PERIODIC_MEDIUM_MS));
+
+  TEST_ASSERT_EQUAL_INT(2, sched.dueCount_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x30, sched.due_au8[sched.dueHead_u8]); /* Fast period ends first */
+}
+
+/* ============================================================================
+ * Test Cases: Registration
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagPeriodicAdd_MoveToOtherRate
+ * Description: Schedule an identifier at the slow rate, then at the fast rate
+ * Expected: It is scheduled once, in the fast bucket only
+ */
+void test_LinDiagPeriodicAdd_MoveToOtherRate(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, SLOW, 0x01u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x01u));
+
+  TEST_ASSERT_EQUAL_INT(1, sched.scheduledCount_u8);
+  TEST_ASSERT_EQUAL_INT(0, sched.buckets_as[SLOW].count_u8);
+  TEST_ASSERT_EQUAL_INT(1, sched.buckets_as[FAST].count_u8);
+}
+
+/**
+ * Test: LinDiagPeriodicAdd_SchedulerFull
+ * Description: Schedule one identifier more than LIN_DIAG_PERIODIC_MAX
+ * Expected: The last one is refused
+ */
+void test_LinDiagPeriodicAdd_SchedulerFull(void)
+{
+  uint8_t pdid;
+
+  for (pdid = 0u; pdid < LIN_DIAG_PERIODIC_MAX; pdid++)
+  {
+    TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, MEDIUM, pdid));
+  }
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagPeriodicAdd(&sched, MEDIUM, 0xFFu));
+  TEST_ASSERT_EQUAL_INT(LIN_DIAG_PERIODIC_MAX, sched.scheduledCount_u8);
+}
+
+/**
+ * Test: LinDiagPeriodicRemove_Stop
+ * Description: Remove a scheduled identifier, then one that is not scheduled
+ * Expected: E_OK then E_NOT_OK, the removed identifier is no longer queued
+ */
+void test_LinDiagPeriodicRemove_Stop(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x01u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x02u));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicRemove(&sched, 0x01u));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagPeriodicRemove(&sched, 0x01u));
+
+  tick(LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PERIODIC_FAST_MS));
+  TEST_ASSERT_EQUAL_INT(1, sched.dueCount_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x02, sched.due_au8[sched.dueHead_u8]);
+}
+
+/**
+ * Test: LinDiagPeriodicRemove_QueuedSample
+ * Description: Queue three identifiers, then remove the middle one before it is sent
+ * Expected: Its sample leaves the FIFO, the others keep their order, it can be queued again
+ */
+void test_LinDiagPeriodicRemove_QueuedSample(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x01u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x02u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x03u));
+  tick(LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PERIODIC_FAST_MS));
+  TEST_ASSERT_EQUAL_INT(3, sched.dueCount_u8);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicRemove(&sched, 0x02u));
+
+  TEST_ASSERT_EQUAL_INT(2, sched.dueCount_u8);
+  TEST_ASSERT_EQUAL_HEX8(0x01, sched.due_au8[sched.dueHead_u8]);
+  TEST_ASSERT_EQUAL_HEX8(0x03, sched.due_au8[(sched.dueHead_u8 + 1u) % LIN_DIAG_PERIODIC_MAX]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, sched.queued_au8[0] & 0x04u);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagPeriodicAdd(&sched, FAST, 0x02u));
+  tick(LIN_DIAG_MS_TO_TICKS(LIN_DIAG_PERIODIC_FAST_MS));
+  TEST_ASSERT_EQUAL_INT(3, sched.dueCount_u8);
+}
@@ -0,0 +1,238 @@
+#include "LinDiagQueueDrain.h"
+#include <stddef.h>
+
+_Static_assert((LIN_DIAG_QUEUE_SIZE & (LIN_DIAG_QUEUE_SIZE - 1u)) == 0u, "LIN_DIAG_QUEUE_SIZE must be a power of 2");
+_Static_assert(LIN_DIAG_QUEUE_SIZE <= 32768u, "LIN_DIAG_QUEUE_SIZE too large for 16-bit indexes");
+
+#if defined(__STDC_NO_ATOMICS__)
+uint16 LinDiagQueueLoadAcq(const LinDiagQueueIdx_t *const idx_pu16)
+{
+    const uint16 l_idx_u16 = *idx_pu16;
+
+    LIN_DIAG_QUEUE_BARRIER();
+    return l_idx_u16;
+}
+#endif
+
+void LinDiagQueueInit(LinDiagQueue_t *const q_ps)
+{
+    LIN_DIAG_QUEUE_STORE_REL(q_ps->head_u16, 0u);
+    LIN_DIAG_QUEUE_STORE_REL(q_ps->tail_u16, 0u);
+    q_ps->dropped_u16 = 0u;
+    q_ps->rx_s.expected_u16 = 0u;
+    q_ps->rx_s.received_u16 = 0u;
+    q_ps->rx_s.sn_u8 = 0u;
+    q_ps->rx_s.active_u8 = 0u;
+}
+
+LinDiagQueueEntry_t *LinDiagQueueHeadSlot(LinDiagQueue_t *const q_ps)
+{
+    /* head_u16 is ours, tail_u16 is read with acquire to see the slot released */
+    const uint16 l_head_u16 = (uint16)LIN_DIAG_QUEUE_LOAD_ACQ(q_ps->head_u16);
+    const uint16 l_tail_u16 = LIN_DIAG_QUEUE_LOAD_ACQ(q_ps->tail_u16);
+
+    if ((uint16)(l_head_u16 - l_tail_u16) >= LIN_DIAG_QUEUE_SIZE)
+    {
+        return NULL;
+    }
+
+    return &q_ps->entries_as[l_head_u16 & LIN_DIAG_QUEUE_MASK];
+}
+
+void LinDiagQueueCommit(LinDiagQueue_t *const q_ps)
+{
+    const uint16 l_head_u16 = LIN_DIAG_QUEUE_LOAD_ACQ(q_ps->head_u16);
+
+    /* Release: the slot content is visible before the new head */
+    LIN_DIAG_QUEUE_STORE_REL(q_ps->head_u16, (uint16)(l_head_u16 + 1u));
+}
+
+Std_ReturnType LinDiagQueueRxFrame(LinDiagQueue_t *const q_ps, const uint8 *const frame_pu8)
+{
+    LinDiagQueueEntry_t *const l_slot_ps = LinDiagQueueHeadSlot(q_ps);
+    const uint8 l_pciType_u8 = (uint8)(frame_pu8[1] & LIN_TP_PCI_TYPE_MASK);
+
+    if (NULL == l_slot_ps)
+    {
+        /* Count a lost request once, on its first frame */
+        if ((LIN_TP_PCI_SF == l_pciType_u8) || (LIN_TP_PCI_FF == l_pciType_u8))
+        {
+            q_ps->dropped_u16++;
+        }
+        q_ps->rx_s.active_u8 = 0u;
+        return E_NOT_OK;
+    }
+
+    /* The transmitter belongs to the consumer: no abort from here */
+    if (E_OK != LinDiagTpRxFrame(&q_ps->rx_s, NULL, frame_pu8, l_slot_ps->data_au8,
+                                 LIN_DIAG_BUFFER_SIZE, &l_slot_ps->len_u16))
+    {
+        return E_NOT_OK;
+    }
+
+    l_slot_ps->nad_u8 = frame_pu8[0];
+    LinDiagQueueCommit(q_ps);
+    return E_OK;
+}
+
+Std_ReturnType LinDiagQueuePush(LinDiagQueue_t *const q_ps, const uint8 nad_u8, const uint8 *const req_pu8,
+    const uint16 len_u16)
+{
+    LinDiagQueueEntry_t *const l_slot_ps = LinDiagQueueHeadSlot(q_ps);
+    uint16 l_idx_u16;
+
+    if (len_u16 > LIN_DIAG_BUFFER_SIZE)
+    {
+        return E_NOT_OK;
+    }
+
+    if (NULL == l_slot_ps)
+    {
+        q_ps->dropped_u16++;
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u16 = 0u; l_idx_u16 < len_u16; l_idx_u16++)
+    {
+        l_slot_ps->data_au8[l_idx_u16] = req_pu8[l_idx_u16];
+    }
+    l_slot_ps->len_u16 = len_u16;
+    l_slot_ps->nad_u8 = nad_u8;
+
+    LinDiagQueueCommit(q_ps);
+    return E_OK;
+}
+
+uint16 LinDiagQueueDrain(LinDiagQueue_t *const q_ps, const LinDiagDispatch_t *const disp_ps,
+    LinDiag_Channel_t *const ch_ps, const uint16 maxBatch_u16)
+{
+    uint8_t *const l_chReq_pu8 = ch_ps->req_pu8;
+    const uint8 l_chReqNad_cu8 = ch_ps->reqNad_u8;
+    uint16 l_tail_u16 = LIN_DIAG_QUEUE_LOAD_ACQ(q_ps->tail_u16);
+    uint16 l_served_u16 = 0u;
+
+    while ((l_served_u16 < maxBatch_u16) && (0u == ch_ps->pending_u8) && (E_OK != LinDiagTpIsTxBusy(&ch_ps->tpTx_s)))
+    {
+        /* Acquire: the slot content is visible once the head is */
+        const uint16 l_head_u16 = LIN_DIAG_QUEUE_LOAD_ACQ(q_ps->head_u16);
+        LinDiagQueueEntry_t *l_slot_ps;
+
+        if (l_head_u16 == l_tail_u16)
+        {
+            break;
+        }
+
+        l_slot_ps = &q_ps->entries_as[l_tail_u16 & LIN_DIAG_QUEUE_MASK];
+        ch_ps->req_pu8 = l_slot_ps->data_au8;
+        ch_ps->reqLen_u16 = l_slot_ps->len_u16;
+        ch_ps->reqNad_u8 = l_slot_ps->nad_u8;
+
+        /* Same checks as a direct request: NAD, SID, session, length */
+        (void)LinDiagDispatch(disp_ps, ch_ps);
+
+        /* Release: we are done reading the slot before handing it back */
+        l_tail_u16++;
+        LIN_DIAG_QUEUE_STORE_REL(q_ps->tail_u16, l_tail_u16);
+        l_served_u16++;
+    }
+
+    ch_ps->req_pu8 = l_chReq_pu8;
+    ch_ps->reqNad_u8 = l_chReqNad_cu8;
+    return l_served_u16;
+}
+
+Std_ReturnType LinDiagTpRxFrame(LinDiagTpRx_t *const rx_ps, LinDiagTpTx_t *const tx_ps,
+    const uint8 *const frame_pu8, uint8 *const reqBuf_pu8, const uint16 reqCapacity_u16,
+    uint16 *const reqLen_pu16)
+{
+    const uint8 l_pci_u8 = frame_pu8[1];
+    uint16 l_len_u16 = 0u;
+    uint16 l_idx_u16;
+
+    switch (l_pci_u8 & LIN_TP_PCI_TYPE_MASK)
+    {
+        case LIN_TP_PCI_SF:
+        {
+            l_len_u16 = (uint16)(l_pci_u8 & 0x0Fu);
+            rx_ps->active_u8 = 0u;
+
+            if ((0u == l_len_u16) || (l_len_u16 > LIN_TP_SF_MAX_DATA) || (l_len_u16 > reqCapacity_u16))
+            {
+                return E_NOT_OK;
+            }
+
+            /* A new request aborts the pending response */
+            if (NULL != tx_ps)
+            {
+                tx_ps->active_u8 = 0u;
+            }
+            for (l_idx_u16 = 0u; l_idx_u16 < l_len_u16; l_idx_u16++)
+            {
+                reqBuf_pu8[l_idx_u16] = frame_pu8[2u + l_idx_u16];
+            }
+            *reqLen_pu16 = l_len_u16;
+            return E_OK;
+        }
+
+        case LIN_TP_PCI_FF:
+        {
+            l_len_u16 = (uint16)(((uint16)(l_pci_u8 & 0x0Fu) << 8) | frame_pu8[2]);
+            rx_ps->active_u8 = 0u;
+
+            if ((l_len_u16 <= LIN_TP_SF_MAX_DATA) || (l_len_u16 > reqCapacity_u16))
+            {
+                return E_NOT_OK;
+            }
+
+            if (NULL != tx_ps)
+            {
+                tx_ps->active_u8 = 0u;
+            }
+            for (l_idx_u16 = 0u; l_idx_u16 < LIN_TP_FF_DATA; l_idx_u16++)
+            {
+                reqBuf_pu8[l_idx_u16] = frame_pu8[3u + l_idx_u16];
+            }
+            rx_ps->expected_u16 = l_len_u16;
+            rx_ps->received_u16 = LIN_TP_FF_DATA;
+            rx_ps->sn_u8 = 1u;
+            rx_ps->active_u8 = 1u;
+            return E_NOT_OK;
+        }
+
+        case LIN_TP_PCI_CF:
+        {
+            if ((0u == rx_ps->active_u8) || ((l_pci_u8 & 0x0Fu) != rx_ps->sn_u8))
+            {
+                /* Unexpected or out-of-sequence frame: drop the request */
+                rx_ps->active_u8 = 0u;
+                return E_NOT_OK;
+            }
+
+            l_len_u16 = (uint16)(rx_ps->expected_u16 - rx_ps->received_u16);
+            if (l_len_u16 > LIN_TP_CF_DATA)
+            {
+                l_len_u16 = LIN_TP_CF_DATA;
+            }
+
+            for (l_idx_u16 = 0u; l_idx_u16 < l_len_u16; l_idx_u16++)
+            {
+                reqBuf_pu8[rx_ps->received_u16 + l_idx_u16] = frame_pu8[2u + l_idx_u16];
+            }
+            rx_ps->received_u16 = (uint16)(rx_ps->received_u16 + l_len_u16);
+            rx_ps->sn_u8 = (uint8)((rx_ps->sn_u8 + 1u) & 0x0Fu);
+
+            if (rx_ps->received_u16 >= rx_ps->expected_u16)
+            {
+                rx_ps->active_u8 = 0u;
+                *reqLen_pu16 = rx_ps->expected_u16;
+                return E_OK;
+            }
+            return E_NOT_OK;
+        }
+
+        default:
+        {
+            return E_NOT_OK;
+        }
+    }
+}
@@ -0,0 +1,214 @@
+#include "unity.h"
+#include "LinDiagQueueDrain.h"
+
+static LinDiagQueue_t queue;
+static LinDiagDispatch_t disp;
+static LinDiag_Channel_t ch;
+static uint8_t chReq[LIN_DIAG_BUFFER_SIZE];
+
+/* Stand-ins of the dispatcher and of the transmitter: record the requests served */
+static uint8_t txBusy;
+static uint8_t busyAfterDispatch;
+static uint8_t served;
+static uint8_t servedSid[LIN_DIAG_QUEUE_SIZE + 2u];
+static uint16_t servedLen[LIN_DIAG_QUEUE_SIZE + 2u];
+static uint8_t servedNad[LIN_DIAG_QUEUE_SIZE + 2u];
+static uint8_t servedReq[LIN_DIAG_BUFFER_SIZE];
+
+Std_ReturnType LinDiagDispatch(const LinDiagDispatch_t *const disp_ps, LinDiag_Channel_t *const ch_ps)
+{
+  uint16_t idx;
+
+  TEST_ASSERT_EQUAL_PTR(&disp, disp_ps);
+  for (idx = 0u; idx < ch_ps->reqLen_u16; idx++)
+  {
+    servedReq[idx] = ch_ps->req_pu8[idx];
+  }
+  servedSid[served] = ch_ps->req_pu8[0];
+  servedLen[served] = ch_ps->reqLen_u16;
+  servedNad[served] = ch_ps->reqNad_u8;
+  served++;
+  txBusy = busyAfterDispatch;
+  return E_OK;
+}
+
+Std_ReturnType LinDiagTpIsTxBusy(const LinDiagTpTx_t *const tx_ps)
+{
+  (void)tx_ps;
+  return (0u != txBusy) ? E_OK : E_NOT_OK;
+}
+
+/* Queue a request of len bytes: SID sid, then bytes 1, 2, .. */
+static Std_ReturnType push(const uint8_t sid, const uint16_t len)
+{
+  uint8_t req[LIN_DIAG_BUFFER_SIZE];
+  uint16_t idx;
+
+  req[0] = sid;
+  for (idx = 1u; idx < len; idx++)
+  {
+    req[idx] = (uint8_t)idx;
+  }
+  return LinDiagQueuePush(&queue, 0x10u, req, len);
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  LinDiagQueueInit(&queue);
+  ch.req_pu8 = chReq;
+  ch.nad_u8 = 0x10u;
+  ch.reqNad_u8 = 0x10u;
+  ch.pending_u8 = 0u;
+  txBusy = 0u;
+  busyAfterDispatch = 0u;
+  served = 0u;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Queue
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagQueueDrain_FifoOrder
+ * Description: Queue three requests, drain them with a batch of two, then again
+ * Expected: Served oldest first, two then one, read in place; the channel buffer is given back
+ */
+void test_LinDiagQueueDrain_FifoOrder(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0x22u, 3u));
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0x2Eu, 5u));
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0x19u, 2u));
+
+  TEST_ASSERT_EQUAL_UINT16(2u, LinDiagQueueDrain(&queue, &disp, &ch, 2u));
+  TEST_ASSERT_EQUAL_UINT16(1u, LinDiagQueueDrain(&queue, &disp, &ch, 2u));
+  TEST_ASSERT_EQUAL_UINT16(0u, LinDiagQueueDrain(&queue, &disp, &ch, 2u));
+
+  TEST_ASSERT_EQUAL_UINT8(3u, served);
+  TEST_ASSERT_EQUAL_HEX8(0x22, servedSid[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x2E, servedSid[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x19, servedSid[2]);
+  TEST_ASSERT_EQUAL_UINT16(3u, servedLen[0]);
+  TEST_ASSERT_EQUAL_UINT16(5u, servedLen[1]);
+  TEST_ASSERT_EQUAL_UINT16(2u, servedLen[2]);
+  TEST_ASSERT_EQUAL_PTR(chReq, ch.req_pu8);
+}
+
+/**
+ * Test: LinDiagQueueDrain_FullQueue
+ * Description: Queue two requests more than the queue holds, then a single frame request on the full queue
+ * Expected: The three requests past the size refused and counted as dropped, a drained slot is free again
+ */
+void test_LinDiagQueueDrain_FullQueue(void)
+{
+  const uint8_t sf[LIN_TP_FRAME_SIZE] = {0x10, 0x03, 0x22, 0xF1, 0x90, 0xFF, 0xFF, 0xFF};
+  uint8_t idx;
+
+  for (idx = 0u; idx < LIN_DIAG_QUEUE_SIZE; idx++)
+  {
+    TEST_ASSERT_EQUAL_INT(E_OK, push(idx, 3u));
+  }
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, push(0xA0u, 3u));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, push(0xA1u, 3u));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagQueueRxFrame(&queue, sf));
+  TEST_ASSERT_EQUAL_UINT16(3u, queue.dropped_u16);
+
+  TEST_ASSERT_EQUAL_UINT16(1u, LinDiagQueueDrain(&queue, &disp, &ch, 1u));
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0xA2u, 3u));
+
+  TEST_ASSERT_EQUAL_UINT16(LIN_DIAG_QUEUE_SIZE, LinDiagQueueDrain(&queue, &disp, &ch, LIN_DIAG_QUEUE_SIZE + 2u));
+  TEST_ASSERT_EQUAL_HEX8(0x00, servedSid[0]);
+  TEST_ASSERT_EQUAL_HEX8(LIN_DIAG_QUEUE_SIZE - 1u, servedSid[LIN_DIAG_QUEUE_SIZE - 1u]);
+  TEST_ASSERT_EQUAL_HEX8(0xA2, servedSid[LIN_DIAG_QUEUE_SIZE]);
+}
+
+/**
+ * Test: LinDiagQueueDrain_MultiFrameRequest
+ * Description: Receive a 14-byte request as first frame and two consecutive frames
+ * Expected: Queued with the last frame only, served whole with the NAD of its frames
+ */
+void test_LinDiagQueueDrain_MultiFrameRequest(void)
+{
+  const uint8_t ff[LIN_TP_FRAME_SIZE]  = {0x10, 0x10, 0x0E, 0x22, 0xF1, 0x90, 0xF2, 0x01};
+  const uint8_t cf1[LIN_TP_FRAME_SIZE] = {0x10, 0x21, 0xF3, 0x08, 0xF4, 0x00, 0xF4, 0x10};
+  const uint8_t cf2[LIN_TP_FRAME_SIZE] = {0x10, 0x22, 0xFD, 0x00, 0xFD, 0xF0, 0xFF, 0xFF};
+  const uint8_t expected[14] = {0x22, 0xF1, 0x90, 0xF2, 0x01, 0xF3, 0x08, 0xF4, 0x00, 0xF4, 0x10, 0xFD, 0x00, 0xFD};
+
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagQueueRxFrame(&queue, ff));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagQueueRxFrame(&queue, cf1));
+  TEST_ASSERT_EQUAL_UINT16(0u, LinDiagQueueDrain(&queue, &disp, &ch, 1u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagQueueRxFrame(&queue, cf2));
+
+  TEST_ASSERT_EQUAL_HEX8(0x10, queue.entries_as[0].nad_u8);
+  TEST_ASSERT_EQUAL_UINT16(1u, LinDiagQueueDrain(&queue, &disp, &ch, 1u));
+  TEST_ASSERT_EQUAL_UINT16(14u, servedLen[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x10, servedNad[0]);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, servedReq, sizeof(expected));
+}
+
+/**
+ * Test: LinDiagQueueDrain_RequestNad
+ * Description: Queue requests for the node, for the wildcard NAD and for another node
+ * Expected: Each served with the NAD it was addressed to, the NAD of the channel given back
+ */
+void test_LinDiagQueueDrain_RequestNad(void)
+{
+  const uint8_t req[3] = {0x22, 0xF1, 0x90};
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagQueuePush(&queue, 0x10u, req, 3u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagQueuePush(&queue, 0x7Fu, req, 3u));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagQueuePush(&queue, 0x20u, req, 3u));
+  ch.reqNad_u8 = 0x55u;
+
+  TEST_ASSERT_EQUAL_UINT16(3u, LinDiagQueueDrain(&queue, &disp, &ch, 4u));
+  TEST_ASSERT_EQUAL_HEX8(0x10, servedNad[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x7F, servedNad[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x20, servedNad[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x55, ch.reqNad_u8);
+}
+
+/* ============================================================================
+ * Test Cases: Channel Busy
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagQueueDrain_PendingRequest
+ * Description: Drain while the channel waits for an asynchronous DID, then once it completed
+ * Expected: Nothing served while pending, the queued request served afterwards
+ */
+void test_LinDiagQueueDrain_PendingRequest(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0x22u, 3u));
+  ch.pending_u8 = 1u;
+
+  TEST_ASSERT_EQUAL_UINT16(0u, LinDiagQueueDrain(&queue, &disp, &ch, 4u));
+  TEST_ASSERT_EQUAL_UINT8(0u, served);
+
+  ch.pending_u8 = 0u;
+  TEST_ASSERT_EQUAL_UINT16(1u, LinDiagQueueDrain(&queue, &disp, &ch, 4u));
+}
+
+/**
+ * Test: LinDiagQueueDrain_TxBusy
+ * Description: Drain two queued requests whose responses take several frames
+ * Expected: The second waits until the response of the first is out
+ */
+void test_LinDiagQueueDrain_TxBusy(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0x22u, 3u));
+  TEST_ASSERT_EQUAL_INT(E_OK, push(0x23u, 4u));
+  busyAfterDispatch = 1u;
+
+  TEST_ASSERT_EQUAL_UINT16(1u, LinDiagQueueDrain(&queue, &disp, &ch, 4u));
+  TEST_ASSERT_EQUAL_UINT16(0u, LinDiagQueueDrain(&queue, &disp, &ch, 4u));
+
+  txBusy = 0u;
+  TEST_ASSERT_EQUAL_UINT16(1u, LinDiagQueueDrain(&queue, &disp, &ch, 4u));
+  TEST_ASSERT_EQUAL_HEX8(0x23, servedSid[1]);
+}
@@ -0,0 +1,80 @@
+#include "diagnostic_tp_priv.h"
+#include <stddef.h>
+
+void LinDiagTpCopyOut(LinDiagTpTx_t *const tx_ps, uint8 *const dest_pu8, const uint8 len_u8)
+{
+    uint16 l_pos_u16 = tx_ps->sent_u16;
+    uint8 l_idx_u8;
+
+    for (l_idx_u8 = 0u; l_idx_u8 < len_u8; l_idx_u8++)
+    {
+        if (l_pos_u16 < tx_ps->headLen_u16)
+        {
+            dest_pu8[l_idx_u8] = tx_ps->head_pu8[l_pos_u16];
+        }
+        else
+        {
+            dest_pu8[l_idx_u8] = tx_ps->tail_pu8[l_pos_u16 - tx_ps->headLen_u16];
+        }
+        l_pos_u16++;
+    }
+
+    tx_ps->sent_u16 = l_pos_u16;
+}
+
+/* FUNCTION TO TEST */
+Std_ReturnType LinDiagTpGetTxFrame(LinDiagTpTx_t *const tx_ps, uint8 *const frame_pu8)
+{
+    const uint16 l_total_u16 = (uint16)(tx_ps->headLen_u16 + tx_ps->tailLen_u16);
+    uint16 l_remaining_u16;
+    uint8 l_len_u8;
+    uint8 l_idx_u8;
+
+    if (0u == tx_ps->active_u8)
+    {
+        return E_NOT_OK;
+    }
+
+    for (l_idx_u8 = 0u; l_idx_u8 < LIN_TP_FRAME_SIZE; l_idx_u8++)
+    {
+        frame_pu8[l_idx_u8] = LIN_TP_PADDING;
+    }
+    frame_pu8[0] = tx_ps->nad_u8;
+
+    l_remaining_u16 = (uint16)(l_total_u16 - tx_ps->sent_u16);
+
+    if (0u == tx_ps->sent_u16)
+    {
+        if (l_total_u16 <= LIN_TP_SF_MAX_DATA)
+        {
+            /* Single frame */
+            frame_pu8[1] = (uint8)(LIN_TP_PCI_SF | (uint8)l_total_u16);
+            LinDiagTpCopyOut(tx_ps, &frame_pu8[2], (uint8)l_total_u16);
+        }
+        else
+        {
+            /* First frame: 12-bit length then the first data bytes */
+            frame_pu8[1] = (uint8)(LIN_TP_PCI_FF | (uint8)((l_total_u16 >> 8) & 0x0Fu));
+            frame_pu8[2] = (uint8)(l_total_u16 & 0xFFu);
+            LinDiagTpCopyOut(tx_ps, &frame_pu8[3], (uint8)LIN_TP_FF_DATA);
+        }
+    }
+    else
+    {
+        /* Consecutive frame */
+        l_len_u8 = (l_remaining_u16 < LIN_TP_CF_DATA) ? (uint8)l_remaining_u16 : (uint8)LIN_TP_CF_DATA;
+        frame_pu8[1] = (uint8)(LIN_TP_PCI_CF | tx_ps->sn_u8);
+        LinDiagTpCopyOut(tx_ps, &frame_pu8[2], l_len_u8);
+        tx_ps->sn_u8 = (uint8)((tx_ps->sn_u8 + 1u) & 0x0Fu);
+    }
+
+    if (tx_ps->sent_u16 >= l_total_u16)
+    {
+        tx_ps->active_u8 = 0u;
+    }
+
+    return E_OK;
+}
+
+
+
@@ -0,0 +1,69 @@
+
+
+#ifndef DIAGNOSTIC_TP_H
+#define DIAGNOSTIC_TP_H
+
+#include "diagnostic_cfg.h"
+
+/* LIN diagnostic frame: NAD, PCI, 6 data bytes */
+#define LIN_TP_FRAME_SIZE      8u
+#define LIN_TP_SF_MAX_DATA     6u
+#define LIN_TP_FF_DATA         5u
+#define LIN_TP_CF_DATA         6u
+
+#define LIN_TP_PCI_SF          ((uint8)0x00u)
+#define LIN_TP_PCI_FF          ((uint8)0x10u)
+#define LIN_TP_PCI_CF          ((uint8)0x20u)
+#define LIN_TP_PCI_TYPE_MASK   ((uint8)0xF0u)
+#define LIN_TP_PADDING         ((uint8)0xFFu)
+
+/* Transmission in progress: message = head followed by tail, both read in place */
+typedef struct
+{
+    const uint8 *head_pu8;
+    const uint8 *tail_pu8;
+    uint16       headLen_u16;
+    uint16       tailLen_u16;
+    uint16       sent_u16;        /* Bytes already framed */
+    uint8        nad_u8;
+    uint8        sn_u8;           /* Next consecutive frame sequence number */
+    uint8        active_u8;
+} LinDiagTpTx_t;
+
+/* Reception in progress */
+typedef struct
+{
+    uint16 expected_u16;
+    uint16 received_u16;
+    uint8  sn_u8;
+    uint8  active_u8;
+} LinDiagTpRx_t;
+
+/* Every function works on the contexts it is given: one pair per channel */
+void LinDiagTpInit(LinDiagTpTx_t *const tx_ps, LinDiagTpRx_t *const rx_ps);
+
+/* Start the transmission of a message made of a head and an optional tail.
+ * Both are read in place while the frames are built: they must stay unchanged
+ * until LinDiagTpIsTxBusy() returns E_NOT_OK.
+ */
+Std_ReturnType LinDiagTpStartTx(LinDiagTpTx_t *const tx_ps, const uint8 nad_u8, const uint8 *const head_pu8, const uint16 headLen_u16,
+    const uint8 *const tail_pu8, const uint16 tailLen_u16);
+
+/* Build the next slave response frame. The LIN master paces the transfer by
+ * scheduling the slave response headers: one call per header.
+ * Returns E_NOT_OK when there is nothing to send.
+ */
+Std_ReturnType LinDiagTpGetTxFrame(LinDiagTpTx_t *const tx_ps, uint8 *const frame_pu8);
+
+/* E_OK while a transmission is ongoing */
+Std_ReturnType LinDiagTpIsTxBusy(const LinDiagTpTx_t *const tx_ps);
+
+/* Feed one master request frame. Returns E_OK once a complete request is in
+ * reqBuf_pu8 (*reqLen_pu16 bytes). Requests longer than reqCapacity_u16 or with a
+ * sequence error are dropped. A new request aborts the ongoing transmission of tx_ps.
+ */
+Std_ReturnType LinDiagTpRxFrame(LinDiagTpRx_t *const rx_ps, LinDiagTpTx_t *const tx_ps,
+    const uint8 *const frame_pu8, uint8 *const reqBuf_pu8, const uint16 reqCapacity_u16,
+    uint16 *const reqLen_pu16);
+
+#endif
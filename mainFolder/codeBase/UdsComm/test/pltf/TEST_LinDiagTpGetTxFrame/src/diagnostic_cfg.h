@@ -0,0 +1,234 @@
+
+#ifndef DIAGNOSTIC_CFG_H
+#define DIAGNOSTIC_CFG_H
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint8_t Std_ReturnType;
+
+#define LIN_DIAG_BUFFER_SIZE               32u
+/* Longest message of the LIN transport layer (12-bit length of the first frame) */
+#define LIN_TP_MAX_LENGTH                  4095u
+/* Requests buffered between the bus receiver and the diagnostic task (power of 2) */
+#define LIN_DIAG_QUEUE_SIZE                8u
+/* Compiler barrier ordering the slot accesses around the queue indexes without <stdatomic.h>.
+ * Single core only: it stops compiler reordering, not the CPU, a multi-core target needs C11 atomics.
+ */
+#ifndef LIN_DIAG_QUEUE_BARRIER
+#define LIN_DIAG_QUEUE_BARRIER()           __asm__ volatile("" ::: "memory")
+#endif
+/* NAD of this node, used in the transmitted transport frames */
+#define LIN_DIAG_NODE_NAD                  ((uint8)0x01u)
+/* Wildcard NAD: a request to it is served by any node */
+#define LIN_DIAG_NAD_WILDCARD              ((uint8)0x7Fu)
+/* Nodes a gateway serves from one process (diagnostic_gateway.h), one channel each */
+#define LIN_DIAG_GATEWAY_NODES             16u
+
+/* Server timing of asynchronous DIDs, counted in calls of LinDiagMainFunction */
+#define LIN_DIAG_MAIN_PERIOD_MS            10u
+/* First response pending sent one LIN_DIAG_MAIN_PERIOD_MS before P2server is over, then repeated
+ * one period before every P2*server
+ */
+#define LIN_DIAG_P2_MS                     50u
+#define LIN_DIAG_P2STAR_MS                 2000u
+/* A handler still pending after this time is cancelled with a general reject */
+#define LIN_DIAG_PENDING_TIMEOUT_MS        10000u
+#define LIN_DIAG_MS_TO_TICKS(ms)           ((uint16)(((ms) + LIN_DIAG_MAIN_PERIOD_MS - 1u) / LIN_DIAG_MAIN_PERIOD_MS))
+
+/* ReadDataByPeriodicIdentifier: rates of the slow / medium / fast transmission modes */
+#define LIN_DIAG_PERIODIC_SLOW_MS          1000u
+#define LIN_DIAG_PERIODIC_MEDIUM_MS        200u
+#define LIN_DIAG_PERIODIC_FAST_MS          50u
+/* Periodic identifiers scheduled at the same time, all rates together */
+#define LIN_DIAG_PERIODIC_MAX              8u
+
+/* DynamicallyDefineDataIdentifier: DIDs LIN_DIAG_DYN_DID_FIRST.. reserved for composite DIDs */
+#define LIN_DIAG_DYN_DID_FIRST             0xF3F0u
+#define LIN_DIAG_DYN_DID_COUNT             4u
+/* Source DID slices per composite DID */
+#define LIN_DIAG_DYN_DID_PARTS             8u
+
+/* WriteDataById: persisted DIDs are committed together once no write came for
+ * LIN_DIAG_NVM_COMMIT_DELAY_MS, at the latest LIN_DIAG_NVM_COMMIT_MAX_MS after the first one
+ */
+#define LIN_DIAG_NVM_COMMIT_DELAY_MS       500u
+#define LIN_DIAG_NVM_COMMIT_MAX_MS         5000u
+/* Image file of the host NVM stand-in (diagnostic_nvm_file.c) */
+#define LIN_DIAG_NVM_FILE                  "udscomm_nvm.bin"
+
+/* ReadMemoryByAddress: longest memory read, one response SID in front of it */
+#define LIN_DIAG_MEM_READ_MAX              (LIN_TP_MAX_LENGTH - 1u)
+
+/* Fault memory: DTCs stored at the same time (<= 32), every one fits a ReadDTCInformation response */
+#define LIN_DIAG_DTC_CAPACITY              6u
+/* Snapshot stored with a DTC at its last failure, read as DID LIN_DIAG_DTC_SNAPSHOT_DID */
+#define LIN_DIAG_DTC_SNAPSHOT_SIZE         4u
+#define LIN_DIAG_DTC_SNAPSHOT_DID          0xDF00u
+
+/* Diagnostic statistics, read as streamed DID 0xFDF0 (DIAG_STATISTICS): handler execution time
+ * histograms per DID and response time histograms per service. Bin 0 counts times below
+ * 2^SHIFT us, every next bin doubles the limit, the last one counts everything longer.
+ */
+#define LIN_DIAG_STATS_HIST_BINS           8u
+#define LIN_DIAG_STATS_DID_HIST_SHIFT      4u     /* 16 us .. 1 ms */
+#define LIN_DIAG_STATS_SVC_HIST_SHIFT      10u    /* 1 ms .. 65 ms, P2server included */
+
+/* Request/response capture (diagnostic_capture.h): ring mapped from LIN_DIAG_CAPTURE_FILE on the
+ * host (diagnostic_capture_file.c), LIN_DIAG_CAPTURE_SIZE bytes with the ring header
+ */
+#define LIN_DIAG_CAPTURE_SIZE              65536u
+#define LIN_DIAG_CAPTURE_FILE              "udscomm_capture.bin"
+
+/* Fault events reported to the fault memory, DTC numbers in diagnostic_cfg_dtc.c */
+#define DIAG_DTC_EVENT_UNDERVOLTAGE        0u
+#define DIAG_DTC_EVENT_OVERVOLTAGE         1u
+#define DIAG_DTC_EVENT_COUNT               2u
+
+/* DTC status bits (ISO 14229-1 D.2) */
+#define DIAG_DTC_STATUS_TF                 ((uint8)0x01u)   /* testFailed */
+#define DIAG_DTC_STATUS_TFTOC              ((uint8)0x02u)   /* testFailedThisOperationCycle */
+#define DIAG_DTC_STATUS_PDTC               ((uint8)0x04u)   /* pendingDTC */
+#define DIAG_DTC_STATUS_CDTC               ((uint8)0x08u)   /* confirmedDTC */
+#define DIAG_DTC_STATUS_TFSLC              ((uint8)0x20u)   /* testFailedSinceLastClear */
+/* Status bits this fault memory maintains */
+#define DIAG_DTC_STATUS_AVAILABILITY       ((uint8)(DIAG_DTC_STATUS_TF | DIAG_DTC_STATUS_TFTOC | DIAG_DTC_STATUS_PDTC | \
+                                                    DIAG_DTC_STATUS_CDTC | DIAG_DTC_STATUS_TFSLC))
+
+#define E_OK                               ((Std_ReturnType)0x00u)
+#define E_NOT_OK                           ((Std_ReturnType)0x01u)
+/* Asynchronous DID handler not finished yet, called again with DIAG_OPSTATUS_PENDING */
+#define DIAG_E_PENDING                     ((Std_ReturnType)0x0Au)
+#define DIAG_OPSTATUS_INITIAL              ((uint8)0x00u)
+#define DIAG_OPSTATUS_PENDING              ((uint8)0x01u)
+#define DIAG_OPSTATUS_CANCEL               ((uint8)0x02u)
+#define kLinDiagNrcGeneralReject           ((uint8)0x10u)
+#define kLinDiagNrcServiceNotSupported     ((uint8)0x11u)
+#define kLinDiagNrcSubFunctionNotSupported ((uint8)0x12u)
+#define kLinDiagNrcIncorrectMsgLength      ((uint8)0x13u)
+#define kLinDiagNrcResponseTooLong         ((uint8)0x14u)
+#define kLinDiagNrcConditionsNotCorrect    ((uint8)0x22u)
+#define kLinDiagNrcRequestOutOfRange       ((uint8)0x31u)
+#define kLinDiagNrcResponsePending         ((uint8)0x78u)
+#define kLinDiagNrcServiceNotInSession     ((uint8)0x7Fu)
+
+/* DID context of one node: DID table, runtime defined DIDs, response caches, writable DIDs,
+ * fault memory and NVM staging (diagnostic_cfg_priv.h). Every channel serves its node_ps, so
+ * nodes served from one process never see each other's writes, definitions or faults.
+ */
+typedef struct diagNode_s diagNode_t;
+
+/* Node of LinDiag_DefaultChannel (diagnostic_cfg.c) */
+extern diagNode_t diagDefaultNode;
+
+/* Bind node_ps to the generated DID table and start it afresh: writable DIDs at the default of
+ * their source, no composite DID, caches empty, then its persisted DIDs and DTCs loaded from
+ * NVM slot l_index_u8 (diagNvmInit, diagDtcInit). Call once per node before serving it.
+ */
+void diagNodeInit(diagNode_t *node_ps, uint8 l_index_u8);
+
+/* E_OK when a request addressed to currentNad is for the node nodeNad (its own NAD or the wildcard) */
+void checkCurrentNad(uint8 currentNad, uint8 nodeNad, Std_ReturnType *result);
+
+void checkMsgDataLength(uint16_t dataLength, Std_ReturnType *result);
+
+/* Serve one DID into l_diagBuf_pu8 (at most l_diagBufCapacity_u8 bytes).
+ * On E_NOT_OK *l_errCode_pu8 holds the NRC; an unknown DID also sets *l_didSupported_ to E_NOT_OK.
+ * DIAG_E_PENDING: asynchronous DID started, finish it with pollHandlerForReadDataById.
+ */
+Std_ReturnType getHandlersForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16,  uint8 *l_diagBufSize_u8, Std_ReturnType *l_didSupported_,  uint8 *l_diagBuf_pu8,
+    uint8 l_diagBufCapacity_u8);
+
+/* Continue (DIAG_OPSTATUS_PENDING) or abort (DIAG_OPSTATUS_CANCEL) the asynchronous DID
+ * started by getHandlersForReadDataById, on the same buffer. Same results, DIAG_E_PENDING included.
+ */
+Std_ReturnType pollHandlerForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16, uint8 *l_diagBufSize_u8, uint8 *l_diagBuf_pu8,
+    uint8 l_diagBufCapacity_u8, uint8 l_opStatus_u8);
+
+/* *result is E_OK if DID l_did_u16 can be sent periodically: buffered, synchronous, and
+ * small enough for a periodic message (response SID + periodic identifier + data)
+ */
+void checkPeriodicDid(diagNode_t *node_ps, uint16 l_did_u16, Std_ReturnType *result);
+
+/* Append l_partCount_u8 parts to composite DID l_dynDid_u16. Each part is 4 request bytes:
+ * source DID (high, low), position of the first byte (1-based), size. Sources are table DIDs
+ * served from the buffer; the definition is left unchanged if any part is refused.
+ */
+Std_ReturnType defineDynamicDid(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_dynDid_u16, const uint8 *l_parts_pu8, uint8 l_partCount_u8);
+
+/* Clear composite DID l_dynDid_u16, or all of them with LIN_DIAG_DYN_DID_ALL */
+#define LIN_DIAG_DYN_DID_ALL               0xFFFFu
+Std_ReturnType clearDynamicDid(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_dynDid_u16);
+
+/* Write l_length_u16 bytes to DID l_did_cu16. The length must be the DID size. The RAM copy
+ * of node_ps is updated at once, a persisted DID is committed later by diagNvmMainFunction.
+ */
+Std_ReturnType setDataForWriteDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16, const uint8 *l_data_pu8,
+    uint16 l_length_u16);
+
+/* Load the persisted DIDs of node_ps from its NVM slot, DIDs keep their default when the NVM has no image */
+void diagNvmInit(diagNode_t *node_ps);
+
+/* Commit of the written DIDs of node_ps: call every LIN_DIAG_MAIN_PERIOD_MS */
+void diagNvmMainFunction(diagNode_t *node_ps);
+
+/* Commit the written DIDs now (e.g. before power down), E_NOT_OK if the NVM refused them */
+Std_ReturnType diagNvmFlush(diagNode_t *node_ps);
+
+/* Memory window [l_address_uptr, l_address_uptr + l_size_u16[ for ReadMemoryByAddress, sent in place
+ * from *l_data_ppu8. Only windows lying entirely in one whitelisted region are readable.
+ */
+Std_ReturnType getMemoryForReadMemoryByAddress(uint8 *l_errCode_pu8, uintptr_t l_address_uptr, uint16 l_size_u16,
+    const uint8 **l_data_ppu8);
+
+/* Rebuild the fault memory from the persisted store and start an operation cycle: after diagNvmInit */
+void diagDtcInit(diagNode_t *node_ps);
+
+/* Test result of fault event l_event_u8: failed (l_failed_u8 != 0) or passed. A new failure stores the
+ * LIN_DIAG_DTC_SNAPSHOT_SIZE bytes of l_snapshot_pu8 (zeros if NULL) and is persisted with the next
+ * NVM commit; repeated results change nothing. E_NOT_OK: unknown event, or fault memory full.
+ */
+Std_ReturnType diagDtcReportEvent(diagNode_t *node_ps, uint8 l_event_u8, uint8 l_failed_u8, const uint8 *l_snapshot_pu8);
+
+/* Number of stored DTCs whose status has a bit of l_statusMask_u8 set. Unless l_out_pu8 is NULL, their
+ * records (DTC high, middle, low byte, status) are written there, oldest first. Time grows with the
+ * matches only, not with the store size.
+ */
+uint8 getDtcByStatusMask(diagNode_t *node_ps, uint8 l_statusMask_u8, uint8 *l_out_pu8);
+
+/* Stored data of DTC l_dtc_u32: status, occurrence counter and snapshot (*l_snapshot_ppu8, NULL with a
+ * status of 0 when the DTC never failed). kLinDiagNrcRequestOutOfRange for a DTC this ECU does not know.
+ */
+Std_ReturnType getDtcByNumber(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint32_t l_dtc_u32, uint8 *l_status_pu8, uint8 *l_occurrence_pu8,
+    const uint8 **l_snapshot_ppu8);
+
+/* Free-running microsecond clock of the statistics, wraps around (diagnostic_stats_clock.c on the host) */
+uint32_t diagStatsNow(void);
+
+/* Count a response of service l_sid_u8: positive if l_nrc_u8 is 0, negative with NRC l_nrc_u8 otherwise
+ * (NRC 0x78 included). l_start_u32 is the diagStatsNow() value when the request was taken up.
+ */
+void diagStatsServiceDone(uint8 l_sid_u8, uint8 l_nrc_u8, uint32_t l_start_u32);
+
+/* Reset every counter and histogram of the statistics */
+void diagStatsClear(void);
+
+/* Memory of the capture ring, LIN_DIAG_CAPTURE_SIZE bytes kept across resets (the mapped file on the host).
+ * NULL when none is available: the stack then records nothing.
+ */
+uint8 *diagCaptureBackendMap(void);
+
+/* Time base of the DID response caches of node_ps: call every LIN_DIAG_MAIN_PERIOD_MS */
+void diagDidCacheMainFunction(diagNode_t *node_ps);
+
+/* Forget every cached response and restart the cache time base */
+void diagDidCacheClear(diagNode_t *node_ps);
+
+/* Serve one DID too long for pbLinDiagBuffer (getHandlersForReadDataById gave kLinDiagNrcResponseTooLong)
+ * in place: *l_data_ppu8 / *l_length_pu16 describe the data, sent without copy.
+ */
+Std_ReturnType getStreamForReadDataById(diagNode_t *node_ps, uint8 *l_errCode_pu8, uint16 l_did_cu16, const uint8 **l_data_ppu8,
+    uint16 *l_length_pu16);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "unity.h"
+#include <string.h>
+#include "LinDiagTpGetTxFrame.h"
+#include "diagnostic_tp_priv.h"
+
+static LinDiagTpTx_t tx;
+static uint8_t frame[LIN_TP_FRAME_SIZE];
+static uint8_t head[8];
+static uint8_t tail[64];
+
+static void startTx(const uint8_t *head_pu8, uint16_t headLen, const uint8_t *tail_pu8, uint16_t tailLen)
+{
+  tx.head_pu8 = head_pu8;
+  tx.tail_pu8 = tail_pu8;
+  tx.headLen_u16 = headLen;
+  tx.tailLen_u16 = tailLen;
+  tx.sent_u16 = 0u;
+  tx.nad_u8 = 0x05u;
+  tx.sn_u8 = 1u;
+  tx.active_u8 = 1u;
+}
+
+/* Test setup and teardown */
+void setUp(void)
+{
+  uint8_t i;
+  memset(&tx, 0, sizeof(tx));
+  memset(frame, 0, sizeof(frame));
+  for (i = 0; i < sizeof(head); i++) {
+    head[i] = (uint8_t)(0xA0u + i);
+  }
+  for (i = 0; i < sizeof(tail); i++) {
+    tail[i] = i;
+  }
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Idle Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagTpGetTxFrame_NothingToSend
+ * Description: Request a frame while no transmission is active
+ * Expected: E_NOT_OK, frame untouched
+ */
+void test_LinDiagTpGetTxFrame_NothingToSend(void)
+{
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagTpGetTxFrame(&tx, frame));
+  TEST_ASSERT_EQUAL_HEX8(0x00, frame[0]);
+}
+
+/* ============================================================================
+ * Test Cases: Single Frame Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagTpGetTxFrame_SingleFrame
+ * Description: Send a 4-byte message
+ * Expected: One single frame with padding, transmission completed
+ */
+void test_LinDiagTpGetTxFrame_SingleFrame(void)
+{
+  uint8_t expected[8] = {0x05, 0x04, 0xA0, 0xA1, 0xA2, 0xA3, 0xFF, 0xFF};
+  startTx(head, 4, NULL, 0);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, frame, sizeof(expected));
+  TEST_ASSERT_EQUAL_INT(0, tx.active_u8);
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagTpGetTxFrame(&tx, frame));
+}
+
+/**
+ * Test: LinDiagTpGetTxFrame_SingleFrameHeadAndTail
+ * Description: Send a message split between head and tail that fits a single frame
+ * Expected: Head bytes followed by tail bytes in the single frame
+ */
+void test_LinDiagTpGetTxFrame_SingleFrameHeadAndTail(void)
+{
+  uint8_t expected[8] = {0x05, 0x06, 0xA0, 0xA1, 0xA2, 0x00, 0x01, 0x02};
+  startTx(head, 3, tail, 3);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, frame, sizeof(expected));
+  TEST_ASSERT_EQUAL_INT(0, tx.active_u8);
+}
+
+/* ============================================================================
+ * Test Cases: Segmented Tests
+ * ============================================================================
+ */
+
+/**
+ * Test: LinDiagTpGetTxFrame_FirstAndConsecutiveFrames
+ * Description: Send 3 head bytes followed by 10 tail bytes
+ * Expected: First frame with the 13-byte length, then two consecutive frames
+ */
+void test_LinDiagTpGetTxFrame_FirstAndConsecutiveFrames(void)
+{
+  uint8_t expected_ff[8]  = {0x05, 0x10, 0x0D, 0xA0, 0xA1, 0xA2, 0x00, 0x01};
+  uint8_t expected_cf1[8] = {0x05, 0x21, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+  uint8_t expected_cf2[8] = {0x05, 0x22, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF};
+  startTx(head, 3, tail, 10);
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_ff, frame, sizeof(expected_ff));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_cf1, frame, sizeof(expected_cf1));
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_cf2, frame, sizeof(expected_cf2));
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagTpGetTxFrame(&tx, frame));
+}
+
+/**
+ * Test: LinDiagTpGetTxFrame_SequenceNumberWrap
+ * Description: Send a message needing more than 15 consecutive frames
+ * Expected: The sequence number wraps from 0xF to 0x0
+ */
+void test_LinDiagTpGetTxFrame_SequenceNumberWrap(void)
+{
+  uint8_t i;
+  startTx(head, 0, tail, 5u + (16u * 6u));
+
+  TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+  for (i = 1; i <= 16; i++) {
+    TEST_ASSERT_EQUAL_INT(E_OK, LinDiagTpGetTxFrame(&tx, frame));
+    TEST_ASSERT_EQUAL_HEX8(0x20u | (i & 0x0Fu), frame[1]);
+  }
+  TEST_ASSERT_EQUAL_INT(E_NOT_OK, LinDiagTpGetTxFrame(&tx, frame));
+}
@@ -0,0 +1,515 @@
+# -*- coding: utf-8 -*-
+"""
+DID configuration generator for the UdsComm module.
+
+Reads the declarative DID description (cfg/diagnostic_did.csv) and writes:
+    - diagnostic_did_gen.h : size defines, handler/hook prototypes, static asserts
+    - diagnostic_did_gen.c : DID key array, DID descriptor table, response caches,
+                             write descriptors, NVM image layout and the fixed-point
+                             scaling of scaled DIDs; caches and writable DIDs are
+                             placed in the RAM of each node (diagNode_t)
+
+Usage:
+    python didCfgGen.py <did_csv> <output_dir>
+"""
+
+import os
+import sys
+import csv
+import math
+from fractions import Fraction
+
+GEN_HEADER = "diagnostic_did_gen.h"
+GEN_SOURCE = "diagnostic_did_gen.c"
+
+# Request SID + DID high + DID low precede the data in pbLinDiagBuffer
+RESPONSE_HEADER_SIZE = 3
+
+DID_KINDS = ("handler", "data", "stream", "async", "scaled")
+
+WRITE_MODES = ("", "ram", "nvm")
+
+# Scaled DID sources: C type, DIAG_SIGNAL_SRC_* value, min, max
+SIGNAL_SOURCES = {
+    "u8": ("uint8", "DIAG_SIGNAL_SRC_U8", 0, 0xFF),
+    "u16": ("uint16", "DIAG_SIGNAL_SRC_U16", 0, 0xFFFF),
+    "u32": ("uint32_t", "DIAG_SIGNAL_SRC_U32", 0, 0xFFFFFFFF),
+    "s8": ("int8_t", "DIAG_SIGNAL_SRC_S8", -0x80, 0x7F),
+    "s16": ("int16_t", "DIAG_SIGNAL_SRC_S16", -0x8000, 0x7FFF),
+    "s32": ("int32_t", "DIAG_SIGNAL_SRC_S32", -0x80000000, 0x7FFFFFFF),
+}
+
+BANNER = """/*
+ * GENERATED FILE - DO NOT EDIT.
+ * Source : {src}
+ * Tool   : tools/didCfgGen.py
+ */
+"""
+
+
+# ==============================
+# CSV PARSING & VALIDATION
+# ==============================
+def parse_did(text, line_no):
+    try:
+        value = int(text, 16)
+    except ValueError:
+        raise ValueError(f"line {line_no}: invalid DID '{text}'")
+    if not 0 <= value <= 0xFFFF:
+        raise ValueError(f"line {line_no}: DID '{text}' out of range")
+    return value
+
+
+def parse_cache(text, line_no):
+    if not text:
+        return None
+    mode, _, arg = text.partition(":")
+    if mode == "ttl":
+        try:
+            ttl = int(arg, 0)
+        except ValueError:
+            raise ValueError(f"line {line_no}: invalid cache TTL '{arg}'")
+        if ttl < 1:
+            raise ValueError(f"line {line_no}: cache TTL must be at least 1 ms")
+        return ("ttl", ttl)
+    if mode == "version" and arg:
+        return ("version", arg)
+    raise ValueError(f"line {line_no}: cache must be 'ttl:<ms>' or 'version:<counter>'")
+
+
+def parse_scale(text, line_no):
+    """
+    "<source>:<factor>:<offset>:<order>:<bits>", physical = raw * factor + offset in
+    source units. factor and offset are decimals or fractions ("0.1", "1/8"), order is
+    "be" or "le", bits is 1..32 ("s" in front for a signed raw value). Returns a dict
+    with the fixed-point constants of diagSignal_t.
+    """
+    fields = text.split(":")
+    if len(fields) != 5:
+        raise ValueError(f"line {line_no}: scale must be '<source>:<factor>:<offset>:<order>:<bits>'")
+    src, factor_text, offset_text, order, bits_text = fields
+
+    if src not in SIGNAL_SOURCES:
+        raise ValueError(f"line {line_no}: unknown scale source type '{src}'")
+    try:
+        factor = Fraction(factor_text)
+        offset = Fraction(offset_text)
+    except (ValueError, ZeroDivisionError):
+        raise ValueError(f"line {line_no}: invalid scale factor '{factor_text}' or offset '{offset_text}'")
+    if factor <= 0:
+        raise ValueError(f"line {line_no}: scale factor must be positive")
+    if order not in ("be", "le"):
+        raise ValueError(f"line {line_no}: scale byte order must be 'be' or 'le'")
+    signed = bits_text.startswith("s")
+    try:
+        bits = int(bits_text[1:] if signed else bits_text)
+    except ValueError:
+        raise ValueError(f"line {line_no}: invalid scale bit width '{bits_text}'")
+    if not 1 <= bits <= 32 or (signed and bits < 2):
+        raise ValueError(f"line {line_no}: scale bit width out of range")
+
+    # raw = (phys - offset) / factor, as (phys * mul + add) / 2^shift with the largest
+    # shift that keeps mul in 31 bits; add also rounds to nearest
+    for shift in range(32, -1, -1):
+        mul = math.floor(2 ** shift / factor + Fraction(1, 2))
+        if mul < 2 ** 31:
+            break
+    if mul < 2 ** 15:
+        raise ValueError(f"line {line_no}: scale factor too large for 32-bit fixed point")
+    add = math.floor(-offset / factor * 2 ** shift) + (2 ** (shift - 1) if shift else 0)
+
+    _, _, lo, hi = SIGNAL_SOURCES[src]
+    if max(abs(lo * mul + add), abs(hi * mul + add)) >= 2 ** 63:
+        raise ValueError(f"line {line_no}: scale offset too large for 64-bit fixed point")
+
+    return {
+        "src": src,
+        "signed": signed,
+        "little": order == "le",
+        "bits": bits,
+        "shift": shift,
+        "mul": mul,
+        "add": add,
+        "text": text,
+    }
+
+
+def load_dids(csv_path):
+    """
+    Returns the DID entries sorted by first DID. Each entry is a dict with:
+        first, last, name, size, kind, target, hook, cache, write, scale
+    kind is "handler" (target is the handler function), "data" (target is
+    the source variable, served by direct copy) or "stream" (target is a
+    handler pointing at its data, or building it in the stream buffer of the
+    node, size is the maximum length) or "async"
+    (target is a handler that may complete later, polled by the stack) or
+    "scaled" (target is the source variable, encoded with scale, see
+    parse_scale). hook is the optional consistency hook of a data or scaled DID. cache is None or a
+    ("ttl", milliseconds) / ("version", counter variable) tuple, allowed on
+    handler DIDs only. write is "" (read-only), "ram" (WriteDataById
+    updates the copy of each node, the source is its default) or "nvm"
+    (and the copy is persisted), allowed on data DIDs only. Lines starting with '#' are comments.
+    """
+    entries = []
+    with open(csv_path, "r", encoding="utf-8", newline="") as file:
+        rows = csv.reader(file, delimiter=";")
+        for line_no, row in enumerate(rows, start=1):
+            if not row or row[0].strip().startswith("#"):
+                continue
+            row = [col.strip() for col in row]
+            if len(row) != 10:
+                raise ValueError(f"line {line_no}: expected 10 columns, found {len(row)}")
+
+            first = parse_did(row[0], line_no)
+            last = parse_did(row[1], line_no) if row[1] else first
+            if last < first:
+                raise ValueError(f"line {line_no}: range end {row[1]} before start {row[0]}")
+
+            try:
+                size = int(row[3], 0)
+            except ValueError:
+                raise ValueError(f"line {line_no}: invalid size '{row[3]}'")
+            if size < 1:
+                raise ValueError(f"line {line_no}: size must be at least 1 byte")
+
+            kind = row[4]
+            if kind not in DID_KINDS:
+                raise ValueError(f"line {line_no}: unknown kind '{kind}'")
+            if not row[5]:
+                raise ValueError(f"line {line_no}: missing {kind} target")
+            if row[6] and kind not in ("data", "scaled"):
+                raise ValueError(f"line {line_no}: consistency hook allowed on data and scaled DIDs only")
+            if kind in ("stream", "async") and last != first:
+                raise ValueError(f"line {line_no}: {kind} DIDs cannot be ranges")
+            cache = parse_cache(row[7], line_no)
+            if cache and kind != "handler":
+                raise ValueError(f"line {line_no}: response cache allowed on handler DIDs only")
+            if row[8] not in WRITE_MODES:
+                raise ValueError(f"line {line_no}: write must be empty, 'ram' or 'nvm'")
+            if row[8] and kind != "data":
+                raise ValueError(f"line {line_no}: writable DIDs must be data DIDs")
+            if bool(row[9]) != (kind == "scaled"):
+                raise ValueError(f"line {line_no}: scale required on scaled DIDs and allowed on them only")
+            scale = parse_scale(row[9], line_no) if row[9] else None
+            if scale and size != (scale["bits"] + 7) // 8:
+                raise ValueError(f"line {line_no}: size must be the byte length of {scale['bits']} bits")
+
+            entries.append({
+                "first": first,
+                "last": last,
+                "name": row[2],
+                "size": size,
+                "kind": kind,
+                "target": row[5],
+                "hook": row[6],
+                "cache": cache,
+                "write": row[8],
+                "scale": scale,
+                "line": line_no,
+            })
+
+    if not entries:
+        raise ValueError("no DID defined")
+
+    entries.sort(key=lambda e: e["first"])
+
+    for prev, cur in zip(entries, entries[1:]):
+        if cur["first"] <= prev["last"]:
+            raise ValueError(
+                f"line {cur['line']}: DID 0x{cur['first']:04X} ({cur['name']}) "
+                f"duplicates/overlaps line {prev['line']} ({prev['name']})"
+            )
+    return entries
+
+
+def did_define(entry, suffix):
+    if entry["first"] == entry["last"]:
+        return f"DID_{entry['first']:04X}_{suffix}"
+    return f"DID_{entry['first']:04X}_{entry['last']:04X}_{suffix}"
+
+
+def size_define(entry):
+    return did_define(entry, "SIZE")
+
+
+def first_define(entry):
+    return did_define(entry, "FIRST")
+
+
+def last_define(entry):
+    return did_define(entry, "LAST")
+
+
+def is_range(entry):
+    return entry["first"] != entry["last"]
+
+
+# ==============================
+# CODE GENERATION
+# ==============================
+def gen_header(entries, src_name):
+    out = [BANNER.format(src=src_name)]
+    out.append("#ifndef DIAGNOSTIC_DID_GEN_H\n#define DIAGNOSTIC_DID_GEN_H\n")
+    out.append('#include "diagnostic_cfg.h"\n')
+
+    out.append(f"#define DIAG_DID_TABLE_SIZE {len(entries)}u\n")
+    # Keys of the table initialiser: the checks below hold on what the table is built from
+    for e in entries:
+        out.append(f"#define {first_define(e)} 0x{e['first']:04X}u")
+        out.append(f"#define {last_define(e)} 0x{e['last']:04X}u")
+    out.append("")
+    for e in entries:
+        out.append(f"#define {size_define(e)} {e['size']}U")
+    out.append("")
+
+    # NVM image: the persisted data sources one after the other
+    offset = 0
+    nvm = [e for e in entries if e["write"] == "nvm"]
+    out.append(f"#define DIAG_NVM_BLOCK_COUNT {len(nvm)}u")
+    for e in nvm:
+        out.append(f"#define DIAG_NVM_{e['first']:04X}_OFFSET {offset}u")
+        offset += (e["last"] - e["first"] + 1) * e["size"]
+    out.append(f"#define DIAG_NVM_IMAGE_SIZE {offset}u")
+    out.append("")
+
+    # RAM of every node (diagNode_t): copies of the writable DIDs and response cache slots.
+    # At least 1 element each, C has no empty arrays
+    ram = 0
+    for e in entries:
+        if e["write"]:
+            out.append(f"#define DIAG_DID_{e['first']:04X}_RAM {ram}u")
+            ram += (e["last"] - e["first"] + 1) * e["size"]
+    out.append(f"#define DIAG_DID_RAM_SIZE {max(ram, 1)}u")
+    slots = sum(e["last"] - e["first"] + 1 for e in entries if e["cache"])
+    data = sum((e["last"] - e["first"] + 1) * e["size"] for e in entries if e["cache"])
+    out.append(f"#define DIAG_CACHE_SLOT_COUNT {max(slots, 1)}u")
+    out.append(f"#define DIAG_CACHE_DATA_SIZE {max(data, 1)}u")
+    stream = max([e["size"] for e in entries if e["kind"] == "stream"], default=1)
+    out.append(f"#define DIAG_STREAM_DATA_SIZE {stream}u")
+    out.append("")
+    out.append("_Static_assert(DIAG_NVM_BLOCK_COUNT < DIAG_NVM_NO_BLOCK, \"too many persisted DIDs\");")
+    for e in entries:
+        if e["write"]:
+            out.append(
+                f"_Static_assert({size_define(e)} <= (LIN_DIAG_BUFFER_SIZE - 3u), "
+                f"\"{e['name']}: write request does not fit pbLinDiagBuffer\");"
+            )
+    out.append("")
+
+    # Handler (sync or async) and scaled responses must fit the LIN buffer after the 3-byte header,
+    # data and stream responses are sent in place and only bounded by the transport
+    for e in entries:
+        if e["kind"] in ("handler", "async", "scaled"):
+            out.append(
+                f"_Static_assert({size_define(e)} <= (LIN_DIAG_BUFFER_SIZE - {RESPONSE_HEADER_SIZE}u), "
+                f"\"{e['name']}: response does not fit pbLinDiagBuffer\");"
+            )
+        else:
+            out.append(
+                f"_Static_assert({size_define(e)} <= (LIN_TP_MAX_LENGTH - {RESPONSE_HEADER_SIZE}u), "
+                f"\"{e['name']}: response exceeds the transport layer limit\");"
+            )
+    # DIDs reserved for DynamicallyDefineDataIdentifier cannot be in the table
+    for e in entries:
+        out.append(
+            f"_Static_assert(({last_define(e)} < LIN_DIAG_DYN_DID_FIRST) || "
+            f"({first_define(e)} >= (LIN_DIAG_DYN_DID_FIRST + LIN_DIAG_DYN_DID_COUNT)), "
+            f"\"{e['name']}: DID reserved for dynamically defined DIDs\");"
+        )
+    # Table must be strictly increasing: no duplicated or overlapping DIDs, nor a range
+    # ending before it starts (also checked on the CSV, these catch a hand-edited key)
+    for e in entries:
+        out.append(
+            f"_Static_assert({first_define(e)} <= {last_define(e)}, "
+            f"\"{e['name']}: range ends before its first DID\");"
+        )
+    for prev, cur in zip(entries, entries[1:]):
+        out.append(
+            f"_Static_assert({last_define(prev)} < {first_define(cur)}, "
+            f"\"{cur['name']}: duplicated DID\");"
+        )
+    out.append("")
+
+    seen = set()
+    for e in entries:
+        if e["kind"] == "handler" and e["target"] not in seen:
+            seen.add(e["target"])
+            out.append(f"/* {e['name']} */")
+            if is_range(e):
+                out.append(
+                    f"Std_ReturnType {e['target']}(const uint16 offset_u16, uint8*const  output_pu8,\n"
+                    f"    const uint8 capacity_u8, uint8*const  size_pu8, uint8* const errCode_pu8);\n"
+                )
+            else:
+                out.append(
+                    f"Std_ReturnType {e['target']}(uint8*const  output_pu8, const uint8 capacity_u8,\n"
+                    f"    uint8*const  size_pu8, uint8* const errCode_pu8);\n"
+                )
+        if e["kind"] == "stream" and e["target"] not in seen:
+            seen.add(e["target"])
+            out.append(f"/* {e['name']} */")
+            out.append(
+                f"Std_ReturnType {e['target']}(uint8*const buffer_pu8, const uint8 **const data_ppu8,\n"
+                f"    uint16*const length_pu16, uint8* const errCode_pu8);\n"
+            )
+        if e["kind"] == "async" and e["target"] not in seen:
+            seen.add(e["target"])
+            out.append(f"/* {e['name']} */")
+            out.append(
+                f"Std_ReturnType {e['target']}(const uint8 opStatus_u8, uint32_t*const state_pu32, uint8*const  output_pu8,\n"
+                f"    const uint8 capacity_u8, uint8*const  size_pu8, uint8* const errCode_pu8);\n"
+            )
+        if e["cache"] and e["cache"][0] == "version" and e["cache"][1] not in seen:
+            seen.add(e["cache"][1])
+            out.append(f"/* {e['name']} version counter, bumped by the producer when the value changes */")
+            out.append(f"extern volatile uint16 {e['cache'][1]};\n")
+        if e["hook"] and e["hook"] not in seen:
+            seen.add(e["hook"])
+            out.append(f"/* {e['name']} consistency hook */")
+            out.append(f"Std_ReturnType {e['hook']}(uint8* const errCode_pu8);\n")
+
+    out.append("#endif /* DIAGNOSTIC_DID_GEN_H */\n")
+    return "\n".join(out)
+
+
+def gen_source(entries, src_name):
+    out = [BANNER.format(src=src_name)]
+    out.append('#include "diagnostic_cfg_priv.h"\n#define NULL ((void *)0)\n')
+
+    # Searched keys are kept apart from the descriptors so that the binary
+    # search only touches a dense uint16 array.
+    out.append("const uint16 diagDidKeys_cau16[DIAG_DID_TABLE_SIZE] =\n{")
+    for e in entries:
+        out.append(f"    {first_define(e)}, /* {e['name']} */")
+    out.append("};\n")
+
+    # Data sources must cover every DID they serve
+    for e in entries:
+        if e["kind"] == "data":
+            count = e["last"] - e["first"] + 1
+            out.append(
+                f"_Static_assert(sizeof({e['target']}) >= ({count}u * {size_define(e)}), "
+                f"\"{e['name']}: data source smaller than the DID\");"
+            )
+        if e["kind"] == "scaled":
+            count = e["last"] - e["first"] + 1
+            ctype = SIGNAL_SOURCES[e["scale"]["src"]][0]
+            out.append(
+                f"_Static_assert(sizeof({e['target']}) == ({count}u * sizeof({ctype})), "
+                f"\"{e['name']}: source does not match the scale source type\");"
+            )
+    out.append("")
+
+    # Fixed-point scaling of the scaled DIDs, computed here so the target needs no floating point
+    for e in entries:
+        if e["kind"] != "scaled":
+            continue
+        sc = e["scale"]
+        flags = " | ".join(
+            f for f, on in (("DIAG_SIGNAL_SIGNED", sc["signed"]), ("DIAG_SIGNAL_LITTLE_ENDIAN", sc["little"])) if on
+        ) or "0u"
+        out.append(f"/* {e['name']} scale {sc['text']} */")
+        out.append(
+            f"static const diagSignal_t diagSignal_{e['first']:04X} = "
+            f"{{ (const void *)&{e['target']}, {SIGNAL_SOURCES[sc['src']][1]}, {flags}, {sc['bits']}u, "
+            f"{sc['shift']}u, {sc['mul']}, {sc['add']}LL }};\n"
+        )
+
+    # Response caches: one slot of size bytes per DID of the entry, held by every node
+    slot = 0
+    data = 0
+    for e in entries:
+        if not e["cache"]:
+            continue
+        tag = f"{e['first']:04X}"
+        count = e["last"] - e["first"] + 1
+        if e["cache"][0] == "ttl":
+            policy = f"LIN_DIAG_MS_TO_TICKS({e['cache'][1]}u), NULL"
+        else:
+            policy = f"0u, &{e['cache'][1]}"
+        out.append(f"/* {e['name']} response cache, slots {slot}..{slot + count - 1} of the node */")
+        out.append(f"static const diagDidCache_t diagCache_{tag} = {{ {slot}u, {data}u, {policy} }};\n")
+        slot += count
+        data += count * e["size"]
+
+    # WriteDataById targets, NVM blocks in image order
+    nvm = [e for e in entries if e["write"] == "nvm"]
+    for e in entries:
+        if not e["write"]:
+            continue
+        tag = f"{e['first']:04X}"
+        block = f"{nvm.index(e)}u" if e["write"] == "nvm" else "DIAG_NVM_NO_BLOCK"
+        out.append(f"/* {e['name']} write ({e['write']}) */")
+        out.append(f"static const diagDidWrite_t diagWrite_{tag} = {{ DIAG_DID_{tag}_RAM, {block} }};\n")
+
+    # The sentinel keeps the array valid when no DID is persisted
+    out.append("const diagNvmBlock_t diagNvmBlocks[DIAG_NVM_BLOCK_COUNT + 1u] =\n{")
+    for e in nvm:
+        count = e["last"] - e["first"] + 1
+        out.append(f"    /* {e['name']} */")
+        out.append(
+            f"    {{ DIAG_DID_{e['first']:04X}_RAM, DIAG_NVM_{e['first']:04X}_OFFSET, "
+            f"(uint16)({count}u * {size_define(e)}) }},"
+        )
+    out.append("    { 0u, DIAG_NVM_IMAGE_SIZE, 0u },")
+    out.append("};\n")
+
+    out.append("const diagDidEntry_t diagDidTable[DIAG_DID_TABLE_SIZE] =\n{")
+    for e in entries:
+        hook = f"&{e['hook']}" if e["hook"] else "NULL"
+        if e["kind"] == "data":
+            # Source variables are declared in diagnostic_cfg_priv.h
+            targets = f"NULL, NULL, (const uint8 *)&{e['target']}, {hook}, NULL, NULL"
+        elif e["kind"] == "stream":
+            targets = f"NULL, NULL, NULL, NULL, &{e['target']}, NULL"
+        elif e["kind"] == "async":
+            targets = f"NULL, NULL, NULL, NULL, NULL, &{e['target']}"
+        elif e["kind"] == "scaled":
+            targets = f"NULL, NULL, NULL, {hook}, NULL, NULL"
+        elif is_range(e):
+            targets = f"NULL, &{e['target']}, NULL, NULL, NULL, NULL"
+        else:
+            targets = f"&{e['target']}, NULL, NULL, NULL, NULL, NULL"
+        cache = f"&diagCache_{e['first']:04X}" if e["cache"] else "NULL"
+        write = f"&diagWrite_{e['first']:04X}" if e["write"] else "NULL"
+        signal = f"&diagSignal_{e['first']:04X}" if e["scale"] else "NULL"
+        out.append(f"    /* {e['name']} */")
+        out.append(
+            f"    {{ {first_define(e)}, {last_define(e)}, {size_define(e)}, {targets}, {cache}, {write}, {signal} }},"
+        )
+    out.append("};\n")
+
+    out.append("const uint16 diagDidTableSize_u16 = DIAG_DID_TABLE_SIZE;\n")
+    out.append(
+        "const diagDidTable_t diagDidTableCfg = { diagDidKeys_cau16, diagDidTable, DIAG_DID_TABLE_SIZE };\n"
+    )
+    return "\n".join(out)
+
+
+def write_if_changed(path, content):
+    # Keep timestamps stable when nothing changes to avoid useless rebuilds
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as file:
+            if file.read() == content:
+                print(f"✅ '{path}' up to date.")
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as file:
+        file.write(content)
+    print(f"✅ '{path}' generated.")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    csv_path, out_dir = sys.argv[1], sys.argv[2]
+    try:
+        dids = load_dids(csv_path)
+    except (OSError, ValueError) as e:
+        print(f"❌ {csv_path}: {e}")
+        sys.exit(1)
+
+    src = os.path.basename(csv_path)
+    write_if_changed(os.path.join(out_dir, GEN_HEADER), gen_header(dids, src))
+    write_if_changed(os.path.join(out_dir, GEN_SOURCE), gen_source(dids, src))
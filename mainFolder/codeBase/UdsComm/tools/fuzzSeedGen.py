@@ -0,0 +1,81 @@
+# -*- coding: utf-8 -*-
+"""
+Seed corpus generator for the ReadDataById fuzz target (fuzz/diagnostic_fuzz_rdbi.c).
+
+Writes one input file per:
+    - Unity test of ApplLinDiagReadDataById that loads a request (test_data[] and
+      g_linDiagDataLength), so the fuzzer starts from the known vectors
+    - DID of the DID description (first and last DID of a range), so every
+      configured handler is reached from the first run
+
+Input format: g_linDiagDataLength on two bytes (big endian), then pbLinDiagBuffer.
+
+Usage:
+    python fuzzSeedGen.py <unity_test_c> <did_csv> <output_dir>
+"""
+
+import os
+import re
+import sys
+
+SID_READ_DATA_BY_ID = 0x22
+
+TEST_RE = re.compile(r"^void\s+(test_\w+)\s*\(\s*void\s*\)\s*\{(.*?)^\}", re.M | re.S)
+DATA_RE = re.compile(r"uint8_t\s+test_data\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}")
+LENGTH_RE = re.compile(r"g_linDiagDataLength\s*=\s*(\w+)\s*;")
+
+
+def seed(length, data):
+    return bytes([(length >> 8) & 0xFF, length & 0xFF]) + bytes(data)
+
+
+def test_seeds(test_c):
+    with open(test_c, encoding="utf-8") as f:
+        text = f.read()
+
+    seeds = {}
+    for name, body in TEST_RE.findall(text):
+        data = DATA_RE.search(body)
+        length = LENGTH_RE.search(body)
+        if data is None or length is None:
+            continue
+        values = [int(v.strip(), 0) for v in data.group(1).split(",") if v.strip()]
+        seeds[name] = seed(int(length.group(1), 0), values)
+    return seeds
+
+
+def did_seeds(did_csv):
+    seeds = {}
+    with open(did_csv, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split(";")
+            for text in (fields[0], fields[1]):
+                if not text:
+                    continue
+                did = int(text, 16)
+                seeds["did_%04X" % did] = seed(3, [SID_READ_DATA_BY_ID, did >> 8, did & 0xFF])
+    return seeds
+
+
+def main():
+    if len(sys.argv) != 4:
+        print(__doc__)
+        sys.exit(1)
+
+    test_c, did_csv, out_dir = sys.argv[1:4]
+    seeds = test_seeds(test_c)
+    seeds.update(did_seeds(did_csv))
+
+    os.makedirs(out_dir, exist_ok=True)
+    for name, data in sorted(seeds.items()):
+        with open(os.path.join(out_dir, name), "wb") as f:
+            f.write(data)
+
+    print("%d seeds written to %s" % (len(seeds), out_dir))
+
+
+if __name__ == "__main__":
+    main()
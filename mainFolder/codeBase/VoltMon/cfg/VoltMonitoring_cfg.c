@@ -20,3 +20,6 @@ uint16_t VoltMon_ReadVoltageProject_mV(void)
     uint16_t dummyVoltage = 12000u;
     return dummyVoltage;
 }
+/* VoltMon_StateEntryProject: VoltMonitoring_cfg_entry.c nel modulo da solo,
+ * VoltMonitoring_cfg_diag.c nel prodotto con la diagnostica UdsComm
+ */
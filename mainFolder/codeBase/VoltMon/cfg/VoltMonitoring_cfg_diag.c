@@ -0,0 +1,19 @@
+#include "VoltMonitoring_cfg.h"
+#include "VoltMonitoring.h"
+#include "diagnostic_cfg.h"
+
+/* Prodotto con la diagnostica UdsComm: ogni stato diventa l'esito del test dei DTC
+ * di sotto/sovratensione nella fault memory di diagDefaultNode, con la tensione nello snapshot.
+ *
+ * Avvio (main di UdsComm/pltf/diagnostic.c): diagNodeInit(&diagDefaultNode, 0u) prima di
+ * VoltMon_Init(), così la fault memory è già caricata dalla NVM al primo cambio di stato.
+ */
+void VoltMon_StateEntryProject(uint8_t state, uint16_t voltage_mV)
+{
+    const uint8 snapshot[LIN_DIAG_DTC_SNAPSHOT_SIZE] = { (uint8)(voltage_mV >> 8), (uint8)voltage_mV, state, 0u };
+
+    (void)diagDtcReportEvent(&diagDefaultNode, DIAG_DTC_EVENT_UNDERVOLTAGE,
+                             (uint8)(VOLT_MON_STATE_UNDERVOLTAGE == state), snapshot);
+    (void)diagDtcReportEvent(&diagDefaultNode, DIAG_DTC_EVENT_OVERVOLTAGE,
+                             (uint8)(VOLT_MON_STATE_OVERVOLTAGE == state), snapshot);
+}
@@ -0,0 +1,10 @@
+#include "VoltMonitoring_cfg.h"
+
+/* Modulo da solo, senza diagnostica: i cambi di stato non vanno notificati a nessuno.
+ * Il prodotto con UdsComm collega VoltMonitoring_cfg_diag.c al posto di questo file.
+ */
+void VoltMon_StateEntryProject(uint8_t state, uint16_t voltage_mV)
+{
+    (void)state;
+    (void)voltage_mV;
+}
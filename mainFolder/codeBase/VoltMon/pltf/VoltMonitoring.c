@@ -1,6 +1,7 @@
 #include "VoltMonitoring.h"
 #include "VoltMonitoring_priv.h"
 #include "VoltMonitoring_cfg.h"
+#include "BinLog.h"
 
 VoltMon_Context_t VoltMon_Ctx;
 
@@ -39,6 +40,7 @@ void voltMonRun(uint16_t dt_ms)
 {
 
     uint16_t voltage_mV = READ_VOLT_PROJECT_MV;
+    VoltMon_State_t previousState = VoltMon_Ctx.state;
 
     uint16_t underOn_mV  = VoltMon_GetUnderOn_mV();
     uint16_t underOff_mV = VoltMon_GetUnderOff_mV();
@@ -138,6 +140,7 @@ void voltMonRun(uint16_t dt_ms)
         default:
         {
             /* Stato non valido -> reset */
+            BINLOG1(VOLTMON_INVALID_STATE, "invalid state %u, back to NORMAL", VoltMon_Ctx.state);
             VoltMon_Ctx.state = VOLT_MON_STATE_NORMAL;
             VoltMon_Ctx.uvActivationTimer_ms = 0u;
             VoltMon_Ctx.ovActivationTimer_ms = 0u;
@@ -145,6 +148,13 @@ void voltMonRun(uint16_t dt_ms)
         }
         break;
     }
+
+    /* Notifica solo sui cambi di stato, non a ogni ciclo */
+    if (VoltMon_Ctx.state != previousState)
+    {
+        BINLOG3(VOLTMON_STATE_CHANGE, "state %u -> %u at %u mV", previousState, VoltMon_Ctx.state, voltage_mV);
+        VOLT_MON_STATE_ENTRY_PROJECT((uint8_t)VoltMon_Ctx.state, voltage_mV);
+    }
 }
 
 VoltMon_State_t VoltMon_GetState(void)
@@ -153,7 +163,10 @@ VoltMon_State_t VoltMon_GetState(void)
 }
 
 
+/* Il prodotto (UdsComm/pltf/diagnostic.c) porta il suo main e compila con VOLT_MON_NO_MAIN */
+#ifndef VOLT_MON_NO_MAIN
 int main()
 {
     return 0;
 }
+#endif
@@ -0,0 +1,30 @@
+#ifndef BIN_LOG_CFG_H
+#define BIN_LOG_CFG_H
+
+#include <stdint.h>
+
+/* 0: ogni punto di log sparisce dal codice, argomenti compresi */
+#define BINLOG_ENABLED                 1
+
+/* Record nel ring (potenza di 2): 24 byte di record + 4 di sequenza ciascuno */
+#define BINLOG_RING_SLOTS              64u
+
+/* Byte scaricati per chiamata di BINLOG_OUTPUT_PROJECT da BinLog_MainFunction */
+#define BINLOG_DRAIN_CHUNK             120u
+
+/* Istante di un record, in us: letto a ogni punto di log, deve costare poco (timer libero) */
+#define BINLOG_TIMESTAMP_PROJECT()     BinLog_TimestampProject_us()
+
+/* Uscita dei record serializzati (UART, LIN, file sull'host), chiamata dal task di BinLog_MainFunction */
+#define BINLOG_OUTPUT_PROJECT(data, len) BinLog_OutputProject((data), (len))
+
+/* File del log sull'host (BinLog_cfg.c) */
+#define BINLOG_FILE                    "binlog.bin"
+
+/* Target di BINLOG_TIMESTAMP_PROJECT */
+uint32_t BinLog_TimestampProject_us(void);
+
+/* Target di BINLOG_OUTPUT_PROJECT */
+void BinLog_OutputProject(const uint8_t *data, uint16_t len);
+
+#endif /* BIN_LOG_CFG_H */
@@ -0,0 +1,22 @@
+/*
+ * GENERATED FILE - DO NOT EDIT.
+ * Source : VoltMonitoring.c, diagnostic.c
+ * Tool   : tools/binLogGen.py
+ */
+
+#ifndef BIN_LOG_IDS_H
+#define BIN_LOG_IDS_H
+
+/* CRC32 of BinLog_strings.csv: logged by BinLog_Init, checked by the decoder */
+#define BINLOG_TABLE_CRC 0x82699AD9u
+
+/* diagnostic.c: "NAD %02X: SID %02X refused, NRC %02X" */
+#define BINLOG_ID_DIAG_NEGATIVE_RESPONSE 2u
+/* diagnostic.c: "NAD %02X: SID %02X answered, %u bytes" */
+#define BINLOG_ID_DIAG_POSITIVE_RESPONSE 3u
+/* VoltMonitoring.c: "invalid state %u, back to NORMAL" */
+#define BINLOG_ID_VOLTMON_INVALID_STATE 4u
+/* VoltMonitoring.c: "state %u -> %u at %u mV" */
+#define BINLOG_ID_VOLTMON_STATE_CHANGE 5u
+
+#endif /* BIN_LOG_IDS_H */
@@ -5,6 +5,11 @@
 
 #define READ_VOLT_PROJECT_MV VoltMon_ReadVoltageProject_mV()
 
+/* Notifica di progetto a ogni cambio di stato: nuovo stato (VoltMon_State_t) e tensione
+ * che lo ha causato, ad es. per registrare un DTC nella fault memory della diagnostica.
+ */
+#define VOLT_MON_STATE_ENTRY_PROJECT(state, voltage_mV) VoltMon_StateEntryProject((state), (voltage_mV))
+
 /* Parametri di configurazione (tutti in cfg) */
 extern const uint16_t VoltMon_ThresholdUnder_mV;      /* es. 8000 mV  */
 extern const uint16_t VoltMon_ThresholdOver_mV;       /* es. 13000 mV */
@@ -25,4 +30,7 @@ extern const uint16_t VoltMon_TaskPeriod_ms;
  */
 uint16_t VoltMon_ReadVoltageProject_mV(void);
 
+/* Target di VOLT_MON_STATE_ENTRY_PROJECT */
+void VoltMon_StateEntryProject(uint8_t state, uint16_t voltage_mV);
+
 #endif /* VOLT_MONITORING_CFG_H */
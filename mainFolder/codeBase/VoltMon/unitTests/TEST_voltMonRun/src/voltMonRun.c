@@ -1,6 +1,7 @@
 #include "voltMonRun.h"
 #include "VoltMonitoring_priv.h"
 #include "VoltMonitoring_cfg.h"
+#include "BinLog.h"
 
 
 
@@ -18,6 +19,7 @@ void voltMonRun(uint16_t dt_ms)
 {
 
     uint16_t voltage_mV = READ_VOLT_PROJECT_MV;
+    VoltMon_State_t previousState = VoltMon_Ctx.state;
 
     uint16_t underOn_mV  = VoltMon_GetUnderOn_mV();
     uint16_t underOff_mV = VoltMon_GetUnderOff_mV();
@@ -117,6 +119,7 @@ void voltMonRun(uint16_t dt_ms)
         default:
         {
             /* Stato non valido -> reset */
+            BINLOG1(VOLTMON_INVALID_STATE, "invalid state %u, back to NORMAL", VoltMon_Ctx.state);
             VoltMon_Ctx.state = VOLT_MON_STATE_NORMAL;
             VoltMon_Ctx.uvActivationTimer_ms = 0u;
             VoltMon_Ctx.ovActivationTimer_ms = 0u;
@@ -124,6 +127,13 @@ void voltMonRun(uint16_t dt_ms)
         }
         break;
     }
+
+    /* Notifica solo sui cambi di stato, non a ogni ciclo */
+    if (VoltMon_Ctx.state != previousState)
+    {
+        BINLOG3(VOLTMON_STATE_CHANGE, "state %u -> %u at %u mV", previousState, VoltMon_Ctx.state, voltage_mV);
+        VOLT_MON_STATE_ENTRY_PROJECT((uint8_t)VoltMon_Ctx.state, voltage_mV);
+    }
 }
 
 VoltMon_State_t VoltMon_GetState(void)
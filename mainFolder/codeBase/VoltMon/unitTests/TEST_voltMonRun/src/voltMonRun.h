@@ -94,6 +94,8 @@ void VoltMon_Init(void);
  * - Returns to NORMAL state only when voltage re-enters the safe region for the
  *   required deactivation time.
  * - Uses three operation states: NORMAL(0), UNDERVOLTAGE(1), OVERVOLTAGE(2).
+ * - Notifies every state change through VOLT_MON_STATE_ENTRY_PROJECT, e.g. to
+ *   set or heal a DTC in the diagnostic fault memory.
  *
  * @par Interface summary
  *
@@ -111,6 +113,7 @@ void VoltMon_Init(void);
  * | VoltMon_Ctx.uvActivationTimer_ms          | X  |  X  | uint16    |   -   |      1      |           0 |         1 | [0, 65535]   | [ms]      |
  * | VoltMon_Ctx.ovActivationTimer_ms          | X  |  X  | uint16    |   -   |      1      |           0 |         1 | [0, 65535]   | [ms]      |
  * | VoltMon_Ctx.deactivationTimer_ms          | X  |  X  | uint16    |   -   |      1      |           0 |         1 | [0, 65535]   | [ms]      |
+ * | VOLT_MON_STATE_ENTRY_PROJECT              |    |  X  | uint8     | state |      1      |           0 |         1 | {0,1,2}      | [-]       |
  *
  * @par Activity diagram (PlantUML)
  *
@@ -162,6 +165,10 @@ void VoltMon_Init(void);
  *   :state = NORMAL;
  * endif
  *
+ * if (state changed) then (ENTRY)
+ *   :VOLT_MON_STATE_ENTRY_PROJECT(state, voltage_mV);
+ * endif
+ *
  * stop
  * @enduml
  *
@@ -2,6 +2,7 @@
 #include "voltMonRun.h"
 #include "mock_VoltMonitoring_priv.h"
 #include "mock_VoltMonitoring_cfg.h"
+#include "mock_BinLog.h"
 
 VoltMon_Context_t VoltMon_Ctx;
 
@@ -25,6 +26,12 @@ void setUp(void)
     VoltMon_Ctx.uvActivationTimer_ms = 0u;
     VoltMon_Ctx.ovActivationTimer_ms = 0u;
     VoltMon_Ctx.deactivationTimer_ms = 0u;
+
+    /* State change notification checked by its own tests only */
+    VoltMon_StateEntryProject_Ignore();
+
+    /* Log differito fuori dallo scopo di questi test */
+    BinLog_Write_Ignore();
 }
 
 void tearDown(void)
@@ -284,6 +291,40 @@ void test_voltMonRun_OverVoltageState_VoltageRecoveryToNormal(void)
 }
 
 
+/* ============================================================================
+ * voltMonRun Tests - State Change Notification
+ * ============================================================================ */
+
+void test_voltMonRun_OverVoltageEntry_NotifiedOnce(void)
+{
+    /* Test: entering OVERVOLTAGE notifies the project once, with the voltage that caused it */
+    /* Arrange */
+    setUp();
+    VoltMon_StateEntryProject_StopIgnore();
+
+    /* Act */
+    for(int i = 0; i < ACTIVATION_TIMER_STEPS + 2; i++)
+    {
+        VoltMon_ReadVoltageProject_mV_ExpectAndReturn(SET_OVER_VOLTAGE_TH_VAL_MV);
+        VoltMon_GetUnderOn_mV_ExpectAndReturn(8000u);
+        VoltMon_GetUnderOff_mV_ExpectAndReturn(8500u);
+        VoltMon_GetOverOn_mV_ExpectAndReturn(12500u);
+        VoltMon_GetOverOff_mV_ExpectAndReturn(13000u);
+
+        /* Only the call that changes the state notifies */
+        if (i == (ACTIVATION_TIMER_STEPS - 1))
+        {
+            VoltMon_StateEntryProject_Expect((uint8_t)VOLT_MON_STATE_OVERVOLTAGE, SET_OVER_VOLTAGE_TH_VAL_MV);
+        }
+
+        voltMonRun(SCHEDULER_BASE_TIME);
+    }
+
+    /* Assert */
+    TEST_ASSERT_EQUAL_INT(VOLT_MON_STATE_OVERVOLTAGE, VoltMon_Ctx.state);
+}
+
+
 /* ============================================================================
  * voltMonRun Tests - Normal State Debouncing (timer accumulation)
  * ============================================================================ */